@@ -13,7 +13,7 @@ GENERATED_DIR = ../../generated
 # Use common project definitions
 include(../../common.pri)
 
-QT += core widgets xml network
+QT += core widgets xml network sql
 
 LIBS += \
     -L$${DESTDIR} \
@@ -45,11 +45,13 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/libclipper.a \
 
 SOURCES += \
+    batchconverter.cpp \
     main.cpp \
     mainwindow.cpp \
     polygonsimplifier.cpp \
 
 HEADERS += \
+    batchconverter.h \
     mainwindow.h \
     polygonsimplifier.h \
 
@@ -0,0 +1,276 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <parseagle/library.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/eagleimport/symbolconverter.h>
+#include <librepcb/eagleimport/packageconverter.h>
+#include <librepcb/eagleimport/devicesetconverter.h>
+#include <librepcb/eagleimport/deviceconverter.h>
+#include "batchconverter.h"
+#include "polygonsimplifier.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+using namespace library;
+
+namespace {
+
+/**
+ * @brief Runs a function object in a QThreadPool
+ *
+ * QThreadPool::start() accepts only QRunnable objects in the supported Qt versions.
+ */
+template <typename F>
+class FunctionRunnable final : public QRunnable
+{
+    public:
+        explicit FunctionRunnable(const F& function) noexcept : mFunction(function) {}
+        void run() override {mFunction();}
+
+    private:
+        F mFunction;
+};
+
+template <typename F>
+QRunnable* createRunnable(const F& function) noexcept
+{
+    return new FunctionRunnable<F>(function); // deleted by the thread pool
+}
+
+} // namespace
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BatchConverter::BatchConverter(eagleimport::ConverterDb& db,
+                               const FilePath& outputDir) noexcept :
+    mDb(db), mOutputDir(outputDir), mWriteQueueSlots(1000), mReadElementsCount(0),
+    mWrittenElementsCount(0)
+{
+    setMaxThreadCount(QThread::idealThreadCount());
+}
+
+BatchConverter::~BatchConverter() noexcept
+{
+    mWorkerPool.waitForDone();
+    mWriterPool.waitForDone();
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QStringList BatchConverter::getErrors() const noexcept
+{
+    QMutexLocker locker(&mErrorsMutex);
+    return mErrors;
+}
+
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void BatchConverter::setMaxThreadCount(int count) noexcept
+{
+    // writing is limited by the disk rather than by the CPU, so fewer writers are enough
+    mWorkerPool.setMaxThreadCount(qMax(count, 1));
+    mWriterPool.setMaxThreadCount(qMax(count / 2, 1));
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BatchConverter::convert(const QList<FilePath>& files) noexcept
+{
+    // create the output directories before the writers access them concurrently
+    try {
+        FileUtils::makePath(mOutputDir.getPathTo("sym")); // can throw
+        FileUtils::makePath(mOutputDir.getPathTo("pkg")); // can throw
+        FileUtils::makePath(mOutputDir.getPathTo("cmp")); // can throw
+        FileUtils::makePath(mOutputDir.getPathTo("dev")); // can throw
+    } catch (const Exception& e) {
+        addError("Fatal Error: " % e.getMsg(), FilePath());
+        return;
+    }
+
+    // the UUIDs are derived from the library file name, thus libraries with the same
+    // name would generate the same elements and write them concurrently to the same
+    // directories
+    QHash<QString, FilePath> filesByName;
+    foreach (const FilePath& filepath, files) {
+        QString filename = filepath.getFilename();
+        if (filesByName.contains(filename)) {
+            addError(QString("Skipped because a library with the same file name is "
+                             "already converted: %1")
+                     .arg(filesByName.value(filename).toNative()), filepath);
+            continue;
+        }
+        filesByName.insert(filename, filepath);
+        mWorkerPool.start(createRunnable([this, filepath]() {convertFile(filepath);}));
+    }
+    mWorkerPool.waitForDone();
+    mWriterPool.waitForDone();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BatchConverter::convertFile(const FilePath& filepath) noexcept
+{
+    try {
+        if (!filepath.isExistingFile()) {
+            throw RuntimeError(__FILE__, __LINE__,
+                               "File not found: " % filepath.toNative());
+        }
+
+        parseagle::Library library(filepath.toStr());
+        eagleimport::ConverterDb db(mDb, filepath); // shares only the UUID mappings
+        foreach (const parseagle::Symbol& symbol, library.getSymbols()) {
+            convertSymbol(db, symbol);
+        }
+        foreach (const parseagle::Package& package, library.getPackages()) {
+            convertPackage(db, package);
+        }
+        foreach (const parseagle::DeviceSet& deviceSet, library.getDeviceSets()) {
+            convertDevice(db, deviceSet);
+        }
+    } catch (const std::exception& e) {
+        addError(e.what(), filepath);
+    }
+}
+
+void BatchConverter::convertSymbol(eagleimport::ConverterDb& db,
+                                   const parseagle::Symbol& symbol) noexcept
+{
+    mReadElementsCount.ref();
+    try {
+        // create symbol
+        eagleimport::SymbolConverter converter(symbol, db);
+        std::shared_ptr<Symbol> newSymbol = converter.generate();
+
+        // convert line rects to polygon rects
+        PolygonSimplifier<Symbol> polygonSimplifier(*newSymbol);
+        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+        write(newSymbol, "sym", db.getCurrentLibraryFilePath());
+    } catch (const std::exception& e) {
+        addError(e.what(), db.getCurrentLibraryFilePath());
+    }
+}
+
+void BatchConverter::convertPackage(eagleimport::ConverterDb& db,
+                                    const parseagle::Package& package) noexcept
+{
+    mReadElementsCount.ref();
+    try {
+        // create package
+        eagleimport::PackageConverter converter(package, db);
+        std::shared_ptr<Package> newPackage = converter.generate();
+
+        // convert line rects to polygon rects
+        Q_ASSERT(newPackage->getFootprints().count() == 1);
+        Footprint& footprint = *newPackage->getFootprints().first();
+        PolygonSimplifier<Footprint> polygonSimplifier(footprint);
+        polygonSimplifier.convertLineRectsToPolygonRects(false, true);
+
+        write(newPackage, "pkg", db.getCurrentLibraryFilePath());
+    } catch (const std::exception& e) {
+        addError(e.what(), db.getCurrentLibraryFilePath());
+    }
+}
+
+void BatchConverter::convertDevice(eagleimport::ConverterDb& db,
+                                   const parseagle::DeviceSet& deviceSet) noexcept
+{
+    mReadElementsCount.ref();
+    try {
+        // skip device sets whose name ends with "-US" or "-US_"
+        if (deviceSet.getName().endsWith("-US")) return;
+        if (deviceSet.getName().endsWith("-US_")) return;
+
+        // create component
+        eagleimport::DeviceSetConverter converter(deviceSet, db);
+        std::shared_ptr<Component> newComponent = converter.generate();
+
+        // create devices
+        QList<std::shared_ptr<Device>> newDevices;
+        foreach (const parseagle::Device& device, deviceSet.getDevices()) {
+            if (device.getPackage().isNull()) continue;
+
+            eagleimport::DeviceConverter devConverter(deviceSet, device, db);
+            newDevices.append(devConverter.generate());
+        }
+
+        // write the elements only if all of them were created successfully
+        write(newComponent, "cmp", db.getCurrentLibraryFilePath());
+        foreach (const std::shared_ptr<Device>& newDevice, newDevices) {
+            write(newDevice, "dev", db.getCurrentLibraryFilePath());
+        }
+    } catch (const std::exception& e) {
+        addError(e.what(), db.getCurrentLibraryFilePath());
+    }
+}
+
+void BatchConverter::write(const std::shared_ptr<LibraryBaseElement>& element,
+                           const QString& subdir, const FilePath& inputFile) noexcept
+{
+    // block the worker if the writers are too far behind, to limit the memory usage
+    mWriteQueueSlots.acquire();
+
+    FilePath parentDir = mOutputDir.getPathTo(subdir);
+    mWriterPool.start(createRunnable([this, element, parentDir, inputFile]() {
+        try {
+            element->saveIntoParentDirectory(parentDir); // can throw
+            mWrittenElementsCount.ref();
+        } catch (const std::exception& e) {
+            addError(e.what(), inputFile);
+        }
+        mWriteQueueSlots.release();
+    }));
+}
+
+void BatchConverter::addError(const QString& msg, const FilePath& inputFile) noexcept
+{
+    QMutexLocker locker(&mErrorsMutex);
+    mErrors.append(QString("%1 (%2)").arg(msg, inputFile.toNative()));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
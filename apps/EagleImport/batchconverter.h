@@ -0,0 +1,136 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BATCHCONVERTER_H
+#define BATCHCONVERTER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <memory>
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace parseagle {
+class Symbol;
+class Package;
+class DeviceSet;
+}
+
+namespace librepcb {
+
+namespace library {
+class LibraryBaseElement;
+}
+
+namespace eagleimport {
+class ConverterDb;
+}
+
+/*****************************************************************************************
+ *  Class BatchConverter
+ ****************************************************************************************/
+
+/**
+ * @brief The BatchConverter class converts many Eagle libraries without user interface
+ *
+ * The symbols, packages and device sets of all libraries are converted in parallel: Each
+ * library is parsed and converted by a worker thread, while the converted elements are
+ * serialized and written to the output directory by a separate pool of writer threads.
+ * The workers only share the UUID mappings of the librepcb::eagleimport::ConverterDb.
+ *
+ * The same rules as in the MainWindow apply, i.e. device sets ending with "-US" or "-US_"
+ * and devices without package are skipped.
+ */
+class BatchConverter final
+{
+    public:
+
+        // Constructors / Destructor
+        BatchConverter() = delete;
+        BatchConverter(const BatchConverter& other) = delete;
+        BatchConverter(eagleimport::ConverterDb& db, const FilePath& outputDir) noexcept;
+        ~BatchConverter() noexcept;
+
+        // Getters
+        int getReadElementsCount() const noexcept {return mReadElementsCount.load();}
+        int getWrittenElementsCount() const noexcept {
+            return mWrittenElementsCount.load();
+        }
+        QStringList getErrors() const noexcept;
+
+        // Setters
+        void setMaxThreadCount(int count) noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Convert Eagle libraries
+         *
+         * Blocks until all libraries are converted and all elements are written. Errors
+         * do not abort the conversion, they are available with #getErrors() afterwards.
+         * Libraries with the same file name as a previous library in the list are skipped
+         * (with an error) since they would lead to elements with the same UUIDs.
+         *
+         * @param files     The *.lbr files to convert
+         */
+        void convert(const QList<FilePath>& files) noexcept;
+
+        // Operator Overloadings
+        BatchConverter& operator=(const BatchConverter& rhs) = delete;
+
+
+    private:
+
+        // Private Methods
+        void convertFile(const FilePath& filepath) noexcept;
+        void convertSymbol(eagleimport::ConverterDb& db,
+                           const parseagle::Symbol& symbol) noexcept;
+        void convertPackage(eagleimport::ConverterDb& db,
+                            const parseagle::Package& package) noexcept;
+        void convertDevice(eagleimport::ConverterDb& db,
+                           const parseagle::DeviceSet& deviceSet) noexcept;
+        void write(const std::shared_ptr<library::LibraryBaseElement>& element,
+                   const QString& subdir, const FilePath& inputFile) noexcept;
+        void addError(const QString& msg, const FilePath& inputFile) noexcept;
+
+
+        // Attributes
+        eagleimport::ConverterDb& mDb;
+        FilePath mOutputDir;
+        QThreadPool mWorkerPool;            ///< parses and converts the libraries
+        QThreadPool mWriterPool;            ///< serializes and writes the elements
+        QSemaphore mWriteQueueSlots;        ///< limits the elements waiting to be written
+        QAtomicInt mReadElementsCount;      ///< Eagle symbols, packages and device sets
+        QAtomicInt mWrittenElementsCount;   ///< LibrePCB library elements
+        mutable QMutex mErrorsMutex;
+        QStringList mErrors;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // BATCHCONVERTER_H
@@ -21,13 +21,22 @@
  *  Includes
  ****************************************************************************************/
 
+#include <iostream>
 #include <QtCore>
 #include <QtWidgets>
 #include <librepcb/common/application.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include "batchconverter.h"
 #include "mainwindow.h"
 
 using namespace librepcb;
 
+/*****************************************************************************************
+ *  Function Prototypes
+ ****************************************************************************************/
+
+static int runBatchConversion(const QCommandLineParser& parser) noexcept;
+
 /*****************************************************************************************
  *  main()
  ****************************************************************************************/
@@ -40,8 +49,67 @@ int main(int argc, char* argv[])
     Application::setOrganizationDomain("librepcb.org");
     Application::setApplicationName("EagleImport");
 
+    // without arguments, the libraries are selected and converted in the user interface
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Converts Eagle libraries to LibrePCB library "
+                                     "elements. If libraries are passed, they are "
+                                     "converted in parallel without user interface.");
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption(QStringList() << "o" << "output",
+                                        "Output directory.", "dir"));
+    parser.addOption(QCommandLineOption(QStringList() << "d" << "db",
+                                        "UUID database (*.sqlite).", "file"));
+    parser.addOption(QCommandLineOption(QStringList() << "j" << "jobs",
+                                        "Number of worker threads.", "count"));
+    parser.addPositionalArgument("libraries", "Eagle libraries (*.lbr) to convert.",
+                                 "[libraries...]");
+    parser.process(app);
+    if (!parser.positionalArguments().isEmpty()) {
+        return runBatchConversion(parser);
+    }
+
     MainWindow w;
     w.show();
 
     return QApplication::exec();
 }
+
+/*****************************************************************************************
+ *  Helper Functions
+ ****************************************************************************************/
+
+static int runBatchConversion(const QCommandLineParser& parser) noexcept
+{
+    if ((!parser.isSet("output")) || (!parser.isSet("db"))) {
+        std::cerr << "The options --output and --db are required." << std::endl;
+        return 1;
+    }
+    FilePath outputDir(QFileInfo(parser.value("output")).absoluteFilePath());
+    FilePath dbFilePath(QFileInfo(parser.value("db")).absoluteFilePath());
+    QList<FilePath> files;
+    foreach (const QString& arg, parser.positionalArguments()) {
+        files.append(FilePath(QFileInfo(arg).absoluteFilePath()));
+    }
+
+    try {
+        eagleimport::ConverterDb db(dbFilePath); // can throw
+        BatchConverter converter(db, outputDir);
+        if (parser.isSet("jobs")) {
+            converter.setMaxThreadCount(parser.value("jobs").toInt());
+        }
+        converter.convert(files);
+        db.flush(); // can throw
+
+        foreach (const QString& error, converter.getErrors()) {
+            std::cerr << qPrintable(error) << std::endl;
+        }
+        std::cout << files.count() << " libraries with "
+                  << converter.getReadElementsCount() << " elements converted, "
+                  << converter.getWrittenElementsCount() << " library elements written."
+                  << std::endl;
+        return converter.getErrors().isEmpty() ? 0 : 1;
+    } catch (const Exception& e) {
+        std::cerr << "Fatal Error: " << qPrintable(e.getMsg()) << std::endl;
+        return 1;
+    }
+}
@@ -86,7 +86,13 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
         addError("Fatal Error: " % e.getMsg());
     }
 
-    eagleimport::ConverterDb db(FilePath(ui->uuidList->text()));
+    std::unique_ptr<eagleimport::ConverterDb> db;
+    try {
+        db = openConverterDb(); // can throw
+    } catch (const Exception& e) {
+        addError("Fatal Error: " % e.getMsg());
+        return;
+    }
 
     for (int i = 0; i < ui->input->count(); i++) {
         FilePath filepath(ui->input->item(i)->text());
@@ -95,12 +101,39 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
             continue;
         }
 
-        convertFile(type, db, filepath);
+        convertFile(type, *db, filepath);
         ui->pbarFiles->setValue(i + 1);
 
         if (mAbortConversion)
             break;
     }
+
+    try {
+        db->flush(); // can throw
+    } catch (const Exception& e) {
+        addError("Fatal Error: " % e.getMsg());
+    }
+}
+
+std::unique_ptr<eagleimport::ConverterDb> MainWindow::openConverterDb()
+{
+    FilePath filepath(ui->uuidList->text());
+    if (filepath.getSuffix() != "ini") {
+        return std::unique_ptr<eagleimport::ConverterDb>(
+            new eagleimport::ConverterDb(filepath)); // can throw
+    }
+
+    // legacy UUID list -> import it into a new database next to it
+    FilePath dbFilePath = filepath.getParentDir().getPathTo(
+        filepath.getCompleteBasename() % ".sqlite");
+    bool importIniFile = !dbFilePath.isExistingFile();
+    std::unique_ptr<eagleimport::ConverterDb> db(
+        new eagleimport::ConverterDb(dbFilePath)); // can throw
+    if (importIniFile) {
+        db->importIniFile(filepath); // can throw
+    }
+    ui->uuidList->setText(dbFilePath.toNative());
+    return db;
 }
 
 void MainWindow::convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
@@ -275,9 +308,15 @@ void MainWindow::on_btnPathsFromIni_clicked()
     FilePath inputDir(QFileDialog::getExistingDirectory(this, "Select Input Folder", mlastInputDirectory));
     if (!inputDir.isExistingDir()) return;
 
-    QSettings outputSettings(ui->uuidList->text(), QSettings::IniFormat);
+    QStringList keys;
+    try {
+        keys = openConverterDb()->getAllKeys(); // can throw
+    } catch (const Exception& e) {
+        QMessageBox::critical(this, "Error", e.getMsg());
+        return;
+    }
 
-    foreach (QString key, outputSettings.allKeys())
+    foreach (QString key, keys)
     {
         key.remove(0, key.indexOf("/")+1);
         key.remove(key.indexOf(".lbr")+4, key.length() - key.indexOf(".lbr") - 4);
@@ -351,7 +390,8 @@ void MainWindow::on_toolButton_4_clicked()
 
 void MainWindow::on_uuidListBtn_clicked()
 {
-    QString file = QFileDialog::getSaveFileName(this, "Select UUID List File", ui->uuidList->text(), "*.ini");
+    QString file = QFileDialog::getSaveFileName(this, "Select UUID Database File", ui->uuidList->text(),
+                                                "UUID Database (*.sqlite);;Legacy UUID List (*.ini)");
     if (file.isEmpty()) return;
     ui->uuidList->setText(file);
 }
@@ -55,6 +55,7 @@ class MainWindow : public QMainWindow
         void reset();
         void addError(const QString& msg, const librepcb::FilePath& inputFile = librepcb::FilePath(), int inputLine = 0);
         void convertAllFiles(ConvertFileType_t type);
+        std::unique_ptr<eagleimport::ConverterDb> openConverterDb();
         void convertFile(ConvertFileType_t type, eagleimport::ConverterDb& db,
                          const librepcb::FilePath& filepath);
         bool convertSymbol(eagleimport::ConverterDb& db,
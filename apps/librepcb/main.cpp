@@ -27,6 +27,7 @@
 #include <librepcb/common/debug.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/network/networkaccessmanager.h>
+#include <librepcb/common/fileio/backgroundfilewriter.h>
 #include <librepcb/workspace/workspace.h>
 #include "firstrunwizard/firstrunwizard.h"
 #include "controlpanel/controlpanel.h"
@@ -85,6 +86,9 @@ int main(int argc, char* argv[])
     // Start network access manager thread
     QScopedPointer<NetworkAccessManager> networkAccessManager(new NetworkAccessManager());
 
+    // Start background file writer thread (used for autosave)
+    QScopedPointer<BackgroundFileWriter> backgroundFileWriter(new BackgroundFileWriter());
+
     // --------------------------------- OPEN WORKSPACE ----------------------------------
 
     // Get the path of the workspace to open (may show the first run wizard)
@@ -98,6 +102,9 @@ int main(int argc, char* argv[])
 
     // -------------------------------- EXIT APPLICATION ---------------------------------
 
+    // Stop background file writer thread (blocks until all pending files are written)
+    backgroundFileWriter.reset();
+
     // Stop network access manager thread
     networkAccessManager.reset();
 
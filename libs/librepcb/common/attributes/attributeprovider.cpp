@@ -28,14 +28,75 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Class AttributeValueCache
+ ****************************************************************************************/
+
+/**
+ * @brief Memoized results of librepcb::AttributeProvider::getAttributeValue()
+ *
+ * Attribute providers are not allowed to contain data, so the memoized values are kept
+ * in this global object, keyed by provider.
+ */
+struct AttributeValueCache final
+{
+    QMutex mutex; ///< protects all following members
+    QHash<const AttributeProvider*, QHash<QString, QString>> values;
+    quint64 revision = 0; ///< incremented on every invalidation
+
+    static AttributeValueCache& instance() noexcept {
+        static AttributeValueCache cache;
+        return cache;
+    }
+};
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+AttributeProvider::~AttributeProvider() noexcept
+{
+    AttributeValueCache& cache = AttributeValueCache::instance();
+    QMutexLocker locker(&cache.mutex);
+    cache.values.remove(this);
+}
+
 /*****************************************************************************************
  *  Public Methods
  ****************************************************************************************/
 
 QString AttributeProvider::getAttributeValue(const QString& key) const noexcept
 {
-   QVector<const AttributeProvider*> backtrace; // for endless loop detection
-   return getAttributeValue(key, backtrace);
+    AttributeValueCache& cache = AttributeValueCache::instance();
+    quint64 revision = 0;
+    {
+        QMutexLocker locker(&cache.mutex);
+        revision = cache.revision;
+        auto provider = cache.values.constFind(this);
+        if (provider != cache.values.constEnd()) {
+            auto value = provider->constFind(key);
+            if (value != provider->constEnd()) return *value;
+        }
+    }
+
+    // not memoized yet, resolve it (without locking the mutex since other providers
+    // are called recursively)
+    QVector<const AttributeProvider*> backtrace; // for endless loop detection
+    QString value = getAttributeValue(key, backtrace);
+
+    QMutexLocker locker(&cache.mutex);
+    if (cache.revision == revision) { // don't memoize values which are already outdated
+        cache.values[this].insert(key, value);
+    }
+    return value;
+}
+
+void AttributeProvider::invalidateAttributeValues() noexcept
+{
+    AttributeValueCache& cache = AttributeValueCache::instance();
+    QMutexLocker locker(&cache.mutex);
+    cache.values.clear();
+    cache.revision++;
 }
 
 /*****************************************************************************************
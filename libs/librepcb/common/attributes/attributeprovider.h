@@ -51,6 +51,12 @@ namespace librepcb {
  * #getBuiltInAttributeValue() and #getAttributeProviderParents(), depending on what kind
  * of attributes it provides.
  *
+ * Resolved values are memoized by #getAttributeValue() since texts are substituted very
+ * often (e.g. when rendering a board). Whenever an attribute value changes, the cache
+ * needs to be invalidated with #invalidateAttributeValues() right before emitting
+ * #attributesChanged(). Forwarding the #attributesChanged() signal of another attribute
+ * provider does not need that, since the cache was already invalidated by the origin.
+ *
  * @see librepcb::AttributeSubstitutor
  * @see @ref doc_attributes_system
  *
@@ -65,7 +71,7 @@ class AttributeProvider
         AttributeProvider() noexcept {}
         AttributeProvider(const AttributeProvider& other) = delete;
         AttributeProvider& operator=(const AttributeProvider& rhs) = delete;
-        virtual ~AttributeProvider() noexcept {}
+        virtual ~AttributeProvider() noexcept;
 
         /**
          * @brief Get the value of an attribute which can be used in texts (like "#NAME")
@@ -73,9 +79,20 @@ class AttributeProvider
          * @param key   The attribute key name (e.g. "NAME" in "#NAME").
          *
          * @return The value of the specified attribute (empty if attribute not found)
+         *
+         * @note The result is memoized until the next #invalidateAttributeValues().
          */
         QString getAttributeValue(const QString& key) const noexcept;
 
+        /**
+         * @brief Discard the memoized values of all attribute providers
+         *
+         * Must be called whenever the value of an attribute might have changed, before
+         * emitting #attributesChanged(). All providers are invalidated at once because the
+         * values of child providers depend on their parents.
+         */
+        static void invalidateAttributeValues() noexcept;
+
         /**
          * @brief Get the value of a user defined attribute (if available)
          *
@@ -128,7 +145,8 @@ class AttributeProvider
 };
 
 // Make sure that the AttributeProvider class does not contain any data (except the vptr).
-// Otherwise it could introduce issues when using multiple inheritance.
+// Otherwise it could introduce issues when using multiple inheritance. This is also the
+// reason why the memoized attribute values are stored outside of the objects.
 static_assert(sizeof(AttributeProvider) == sizeof(void*),
               "AttributeProvider must not contain any data!");
 
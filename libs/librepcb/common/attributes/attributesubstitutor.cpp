@@ -70,6 +70,38 @@ QString AttributeSubstitutor::substitute(QString str, const AttributeProvider* a
     return str;
 }
 
+QString AttributeSubstitutor::substitute(const AttributeSubstitutionTemplate& tmpl,
+                                         const AttributeProvider* ap) noexcept
+{
+    if (!tmpl.mContainsKeys) {
+        return tmpl.mTokens.isEmpty() ? QString() : tmpl.mTokens.first().text;
+    }
+
+    QString str;
+    QString value;
+    QSet<QString> keyBacktrace; // avoid endless recursion
+    for (const AttributeSubstitutionTemplate::Token_t& token : tmpl.mTokens) {
+        if (token.keys.isEmpty()) {
+            str.append(token.text);
+            continue;
+        }
+        foreach (const QString& key, token.keys) {
+            if ((getValueOfKey(key, value, ap)) && (!keyBacktrace.contains(key))) {
+                if (value.contains('#')) {
+                    // the value contains variables as well, which need to be substituted
+                    // together with the rest of the string
+                    return substitute(tmpl.mString, ap);
+                }
+                str.append(value);
+                keyBacktrace.insert(key);
+                break;
+            }
+        }
+        // if no key was found, the variable is just removed
+    }
+    return str;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -101,13 +133,15 @@ bool AttributeSubstitutor::isEscapedSharp(const QString& text, int startPos) noe
 
 int AttributeSubstitutor::getLengthOfKeys(const QString& text, int startPos) noexcept
 {
-    QString allowedChars("_|0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
-    int manualEnd = text.indexOf("||", startPos);
-    if (manualEnd >= 0) {manualEnd += 2;}
+    int manualEnd = -1; // end of the first "||" (explicit end of the keys)
     for (int i = startPos; i < text.length(); ++i) {
-        if ((!allowedChars.contains(text.at(i))) || (i == manualEnd)) {
+        if ((!isKeyChar(text.at(i))) || (i == manualEnd)) {
             return i - startPos;
         }
+        if ((manualEnd < 0) && (text.at(i) == '|') && (i + 1 < text.length()) &&
+            (text.at(i + 1) == '|')) {
+            manualEnd = i + 2;
+        }
     }
     return text.length() - startPos;
 }
@@ -123,6 +157,73 @@ bool AttributeSubstitutor::getValueOfKey(const QString& key, QString& value,
     }
 }
 
+bool AttributeSubstitutor::isKeyChar(QChar c) noexcept
+{
+    ushort u = c.unicode();
+    return ((u >= '0') && (u <= '9')) || ((u >= 'A') && (u <= 'Z')) ||
+           ((u >= 'a') && (u <= 'z')) || (u == '_') || (u == '|');
+}
+
+/*****************************************************************************************
+ *  Class AttributeSubstitutionTemplate
+ ****************************************************************************************/
+
+AttributeSubstitutionTemplate::AttributeSubstitutionTemplate() noexcept :
+    mContainsKeys(false)
+{
+}
+
+AttributeSubstitutionTemplate::AttributeSubstitutionTemplate(const QString& str) noexcept :
+    mString(str), mContainsKeys(false)
+{
+    // split the string the same way as AttributeSubstitutor::substitute() processes it
+    QString literal;
+    int literalPos = 0; // start of the next literal part in str
+    int startPos = 0;
+    int length = 0;
+    QStringList keys;
+    while (AttributeSubstitutor::searchVariablesInText(str, startPos, startPos, length, keys)) {
+        literal.append(str.midRef(literalPos, startPos - literalPos));
+        if (keys.isEmpty()) {
+            // standalone "#", keep it
+            literal.append('#');
+            startPos++;
+        } else if (keys.first() == "#") {
+            // replace "##" by "#" (escaping)
+            literal.append('#');
+            startPos += 2;
+        } else {
+            if (!literal.isEmpty()) {
+                mTokens.append(Token_t{literal, QStringList()});
+                literal.clear();
+            }
+            mTokens.append(Token_t{QString(), keys});
+            mContainsKeys = true;
+            startPos += length;
+        }
+        literalPos = startPos;
+    }
+    literal.append(str.midRef(literalPos));
+    if (!literal.isEmpty()) {
+        mTokens.append(Token_t{literal, QStringList()});
+    }
+}
+
+AttributeSubstitutionTemplate::~AttributeSubstitutionTemplate() noexcept
+{
+}
+
+QStringList AttributeSubstitutionTemplate::getKeys() const noexcept
+{
+    QStringList keys;
+    for (const Token_t& token : mTokens) {
+        foreach (const QString& key, token.keys) {
+            if (!keys.contains(key)) keys.append(key);
+        }
+    }
+    return keys;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
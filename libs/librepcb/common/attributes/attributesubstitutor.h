@@ -31,6 +31,7 @@
 namespace librepcb {
 
 class AttributeProvider;
+class AttributeSubstitutionTemplate;
 
 /*****************************************************************************************
  *  Class AttributeSubstitutor
@@ -81,6 +82,20 @@ class AttributeSubstitutor final
          */
         static QString substitute(QString str, const AttributeProvider* ap = nullptr) noexcept;
 
+        /**
+         * @brief Substitute all attribute keys of a precompiled template
+         *
+         * Same as #substitute(QString, const AttributeProvider*), but without parsing the
+         * string again. Use this for texts which are substituted repeatedly.
+         *
+         * @param tmpl      The precompiled string
+         * @param ap        The attribute provider to get the values from
+         *
+         * @return The substituted string
+         */
+        static QString substitute(const AttributeSubstitutionTemplate& tmpl,
+                                  const AttributeProvider* ap = nullptr) noexcept;
+
 
     private: // Methods
 
@@ -105,6 +120,58 @@ class AttributeSubstitutor final
         static int getLengthOfKeys(const QString& text, int startPos) noexcept;
         static bool getValueOfKey(const QString& key, QString& value,
                                   const AttributeProvider* ap) noexcept;
+        static bool isKeyChar(QChar c) noexcept;
+
+        friend class AttributeSubstitutionTemplate;
+};
+
+/*****************************************************************************************
+ *  Class AttributeSubstitutionTemplate
+ ****************************************************************************************/
+
+/**
+ * @brief The AttributeSubstitutionTemplate class holds a string which is already split
+ *        into literal parts and attribute keys
+ *
+ * Parsing a string for variables ("#KEY|FALLBACK") is done once in the constructor, so
+ * AttributeSubstitutor::substitute(const AttributeSubstitutionTemplate&,
+ * const AttributeProvider*) only needs to look up the values of the keys. The result is
+ * always identical to substituting the original string.
+ *
+ * @see librepcb::AttributeSubstitutor
+ */
+class AttributeSubstitutionTemplate final
+{
+    public:
+
+        // Constructors / Destructor
+        AttributeSubstitutionTemplate() noexcept;
+        AttributeSubstitutionTemplate(const AttributeSubstitutionTemplate& other) = default;
+        explicit AttributeSubstitutionTemplate(const QString& str) noexcept;
+        ~AttributeSubstitutionTemplate() noexcept;
+
+        // Getters
+        const QString& getString() const noexcept {return mString;}
+        bool containsKeys() const noexcept {return mContainsKeys;}
+        QStringList getKeys() const noexcept; ///< all keys, including the fallback keys
+
+        // Operator Overloadings
+        AttributeSubstitutionTemplate& operator=(const AttributeSubstitutionTemplate& rhs) = default;
+
+
+    private:
+
+        /// A literal text (if #keys is empty) or a variable with its keys
+        struct Token_t {
+            QString text;
+            QStringList keys;
+        };
+
+        QString mString;            ///< the original string
+        QVector<Token_t> mTokens;   ///< the parsed string
+        bool mContainsKeys;         ///< whether #mTokens contains at least one variable
+
+        friend class AttributeSubstitutor;
 };
 
 /*****************************************************************************************
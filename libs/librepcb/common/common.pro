@@ -54,14 +54,18 @@ SOURCES += \
     dialogs/polygonpropertiesdialog.cpp \
     dialogs/textpropertiesdialog.cpp \
     exceptions.cpp \
+    fileio/backgroundfilewriter.cpp \
     fileio/directorylock.cpp \
     fileio/filepath.cpp \
     fileio/fileutils.cpp \
     fileio/sexpression.cpp \
+    fileio/sexprfilecache.cpp \
+    fileio/sexprfilepreloader.cpp \
     fileio/smartfile.cpp \
     fileio/smartsexprfile.cpp \
     fileio/smarttextfile.cpp \
     fileio/smartversionfile.cpp \
+    font/strokefont.cpp \
     geometry/cmd/cmdellipseedit.cpp \
     geometry/cmd/cmdholeedit.cpp \
     geometry/cmd/cmdpolygonedit.cpp \
@@ -75,6 +79,7 @@ SOURCES += \
     graphics/defaultgraphicslayerprovider.cpp \
     graphics/ellipsegraphicsitem.cpp \
     graphics/graphicslayer.cpp \
+    graphics/graphicslayerid.cpp \
     graphics/graphicsscene.cpp \
     graphics/graphicsview.cpp \
     graphics/holegraphicsitem.cpp \
@@ -146,6 +151,7 @@ HEADERS += \
     dialogs/polygonpropertiesdialog.h \
     dialogs/textpropertiesdialog.h \
     exceptions.h \
+    fileio/backgroundfilewriter.h \
     fileio/cmd/cmdlistelementinsert.h \
     fileio/cmd/cmdlistelementremove.h \
     fileio/cmd/cmdlistelementsswap.h \
@@ -156,10 +162,13 @@ HEADERS += \
     fileio/serializableobject.h \
     fileio/serializableobjectlist.h \
     fileio/sexpression.h \
+    fileio/sexprfilecache.h \
+    fileio/sexprfilepreloader.h \
     fileio/smartfile.h \
     fileio/smartsexprfile.h \
     fileio/smarttextfile.h \
     fileio/smartversionfile.h \
+    font/strokefont.h \
     geometry/cmd/cmdellipseedit.h \
     geometry/cmd/cmdholeedit.h \
     geometry/cmd/cmdpolygonedit.h \
@@ -173,6 +182,7 @@ HEADERS += \
     graphics/defaultgraphicslayerprovider.h \
     graphics/ellipsegraphicsitem.h \
     graphics/graphicslayer.h \
+    graphics/graphicslayerid.h \
     graphics/graphicsscene.h \
     graphics/graphicsview.h \
     graphics/holegraphicsitem.h \
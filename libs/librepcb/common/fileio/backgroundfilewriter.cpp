@@ -0,0 +1,181 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "backgroundfilewriter.h"
+#include "fileutils.h"
+#include "../exceptions.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+BackgroundFileWriter* BackgroundFileWriter::sInstance = nullptr;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BackgroundFileWriter::BackgroundFileWriter() noexcept :
+    QThread(nullptr), mStopRequested(false)
+{
+    // This thread must only be started once, and from within the main application thread!
+    Q_ASSERT(QThread::currentThread() == qApp->thread());
+    Q_ASSERT(sInstance == nullptr);
+    sInstance = this;
+    start();
+}
+
+BackgroundFileWriter::~BackgroundFileWriter() noexcept
+{
+    Q_ASSERT(QThread::currentThread() == qApp->thread());
+    stop(); // blocks until all files are written and the thread has stopped
+    sInstance = nullptr;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BackgroundFileWriter::write(const FilePath& filepath, const SExpression& dom) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    if (!mPendingJobs.contains(filepath)) {
+        mQueue.append(filepath);
+    }
+    mPendingJobs.insert(filepath, dom); // replaces an older, not yet started job
+    mJobQueued.wakeOne();
+}
+
+void BackgroundFileWriter::discard(const FilePath& filepath) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    if (mPendingJobs.remove(filepath) > 0) {
+        mQueue.removeOne(filepath);
+    }
+    while (mCurrentFilePath == filepath) {
+        mJobFinished.wait(&mMutex);
+    }
+    mWrittenHashes.remove(filepath);
+    mErrors.remove(filepath);
+}
+
+bool BackgroundFileWriter::flush(QStringList& errors) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    while ((!mQueue.isEmpty()) || mCurrentFilePath.isValid()) {
+        mJobFinished.wait(&mMutex);
+    }
+    bool success = mErrors.isEmpty();
+    errors.append(mErrors.values());
+    mErrors.clear();
+    return success;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+BackgroundFileWriter* BackgroundFileWriter::instance() noexcept
+{
+    return sInstance;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BackgroundFileWriter::run() noexcept
+{
+    Q_ASSERT(QThread::currentThread() == this);
+    qDebug() << "Started background file writer thread.";
+    QMutexLocker locker(&mMutex);
+    forever {
+        while (mQueue.isEmpty() && (!mStopRequested)) {
+            mJobQueued.wait(&mMutex);
+        }
+        if (mQueue.isEmpty()) {
+            break; // stop requested and all files written
+        }
+        mCurrentFilePath = mQueue.takeFirst();
+        SExpression dom = mPendingJobs.take(mCurrentFilePath);
+        QByteArray lastHash = mWrittenHashes.value(mCurrentFilePath);
+        locker.unlock();
+
+        // serialize and write the file without holding the lock
+        QByteArray hash;
+        QString error;
+        try {
+            QString content = dom.toString(0); // can throw
+            if (!content.endsWith('\n')) {
+                content.append('\n');
+            }
+            QByteArray data = content.toUtf8();
+            hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+            if ((hash != lastHash) || (!mCurrentFilePath.isExistingFile())) {
+                FileUtils::writeFile(mCurrentFilePath, data); // can throw
+                qDebug() << "Wrote file:" << mCurrentFilePath.toNative();
+            }
+        } catch (const Exception& e) {
+            hash.clear();
+            error = e.getMsg();
+            qCritical() << "Could not write file:" << error;
+            emit writeFailed(mCurrentFilePath, error);
+        }
+
+        locker.relock();
+        if (error.isEmpty()) {
+            mWrittenHashes.insert(mCurrentFilePath, hash);
+            mErrors.remove(mCurrentFilePath); // an older error is obsolete now
+        } else {
+            mWrittenHashes.remove(mCurrentFilePath);
+            mErrors.insert(mCurrentFilePath, error);
+        }
+        mCurrentFilePath = FilePath();
+        mJobFinished.wakeAll();
+    }
+    qDebug() << "Stopped background file writer thread.";
+}
+
+void BackgroundFileWriter::stop() noexcept
+{
+    Q_ASSERT(QThread::currentThread() != this);
+    {
+        QMutexLocker locker(&mMutex);
+        mStopRequested = true;
+        mJobQueued.wakeOne();
+    }
+    // No timeout here: queued files must not get lost, and destroying the thread while
+    // it is still writing a file would crash the application.
+    wait();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,147 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BACKGROUNDFILEWRITER_H
+#define LIBREPCB_BACKGROUNDFILEWRITER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "filepath.h"
+#include "sexpression.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class BackgroundFileWriter
+ ****************************************************************************************/
+
+/**
+ * @brief Serializes S-Expression DOM trees and writes them to files in a separate thread
+ *
+ * This is used to write the backup files (*~) of projects without blocking the main
+ * application thread. The (cheap) DOM tree is built by the caller in the main thread, the
+ * (expensive) string generation and the file I/O is done in the worker thread.
+ *
+ * Jobs for the same file are coalesced: if a file is queued again before the previous job
+ * was started, only the newest content will be written. Files whose content did not
+ * change since the last write are skipped.
+ *
+ * Errors of the worker thread are collected and reported by #flush(), which also blocks
+ * until all queued files are written. Call it before relying on the files on the disk,
+ * e.g. before saving to the original files or before quitting the application. To get
+ * notified immediately (e.g. while autosaving), connect to #writeFailed().
+ *
+ * @note    One instance of this class may be created in the main application thread, and
+ *          must be deleted before stopping the main application thread. After the
+ *          singleton was created, you can get it with the static method #instance(). If
+ *          no instance exists, librepcb::SmartSExprFile writes all files synchronously.
+ *
+ * @see librepcb::SmartSExprFile
+ */
+class BackgroundFileWriter final : public QThread
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        BackgroundFileWriter() noexcept;
+        BackgroundFileWriter(const BackgroundFileWriter& other) = delete;
+        ~BackgroundFileWriter() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Queue a DOM tree to be written to a file
+         *
+         * @param filepath  The file to write (will be created or overwritten)
+         * @param dom       The DOM tree to serialize (an implicitly shared copy is kept)
+         */
+        void write(const FilePath& filepath, const SExpression& dom) noexcept;
+
+        /**
+         * @brief Forget a file: cancel a pending job and wait until a running job finished
+         *
+         * This must be called before removing a file which was written by this class.
+         *
+         * @param filepath  The file to forget
+         */
+        void discard(const FilePath& filepath) noexcept;
+
+        /**
+         * @brief Block until all queued files are written
+         *
+         * @param errors    All (translated) errors which occurred since the last call of
+         *                  this method will be appended to this list (an error is dropped
+         *                  if the same file was written successfully afterwards)
+         *
+         * @return True on success, false if there were errors
+         */
+        bool flush(QStringList& errors) noexcept;
+
+        // Operator Overloadings
+        BackgroundFileWriter& operator=(const BackgroundFileWriter& rhs) = delete;
+
+        // Static Methods
+        static BackgroundFileWriter* instance() noexcept;
+
+
+    signals:
+
+        /**
+         * @brief A file could not be written (emitted from the worker thread)
+         *
+         * @param filepath  The file which could not be written
+         * @param error     The (translated) error message
+         */
+        void writeFailed(const FilePath& filepath, const QString& error);
+
+
+    private: // Methods
+
+        void run() noexcept override;
+        void stop() noexcept;
+
+
+    private: // Data
+
+        QMutex mMutex; ///< protects all following members
+        QWaitCondition mJobQueued; ///< wakes up the worker thread
+        QWaitCondition mJobFinished; ///< wakes up threads waiting in #flush() or #discard()
+        QList<FilePath> mQueue; ///< pending files in the order they were queued
+        QHash<FilePath, SExpression> mPendingJobs; ///< the newest DOM of each pending file
+        FilePath mCurrentFilePath; ///< the file currently being written (invalid if idle)
+        QHash<FilePath, QByteArray> mWrittenHashes; ///< content hash of each written file
+        QHash<FilePath, QString> mErrors; ///< errors not yet reported by #flush()
+        bool mStopRequested;
+        static BackgroundFileWriter* sInstance;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_BACKGROUNDFILEWRITER_H
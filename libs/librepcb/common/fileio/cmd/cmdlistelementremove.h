@@ -61,6 +61,7 @@ class CmdListElementRemove final : public UndoCommand
         /// @copydoc UndoCommand::performExecute()
         bool performExecute() override {
             mIndex = mList.indexOf(mElement); Q_ASSERT(mIndex >= 0);
+            addMemoryUsageOfObject(*mElement);
             performRedo(); // can throw
             return true;
         }
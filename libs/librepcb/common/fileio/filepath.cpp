@@ -252,7 +252,10 @@ FilePath FilePath::getApplicationTempPath() noexcept
 
 FilePath FilePath::getRandomTempPath() noexcept
 {
-    QString random = QString("%1_%2").arg(QDateTime::currentMSecsSinceEpoch()).arg(qrand());
+    // qrand() returns the same sequence in every thread, so add a process-wide counter
+    static QAtomicInt counter;
+    QString random = QString("%1_%2_%3").arg(QDateTime::currentMSecsSinceEpoch())
+                     .arg(qrand()).arg(counter.fetchAndAddRelaxed(1));
     return getApplicationTempPath().getPathTo(random);
 }
 
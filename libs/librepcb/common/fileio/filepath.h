@@ -369,6 +369,8 @@ class FilePath final
         /**
          * @brief Get a random temporary directory path (e.g. "/tmp/librepcb/42")
          *
+         * This method is thread-safe, paths created concurrently are always different.
+         *
          * @return The random filepath (in case of an error, the path can be invalid!)
          */
         static FilePath getRandomTempPath() noexcept;
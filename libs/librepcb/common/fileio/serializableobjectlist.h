@@ -46,6 +46,10 @@ namespace librepcb {
  * - The method #serialize() to serialize the whole list into a librepcb::DomElement.
  * - Iterators (for example to use in C++11 range based for loops).
  * - Methods to find elements by UUID and/or name (if supported by template type `T`).
+ *   The lookups use hash tables which are built lazily on the first lookup, and extended
+ *   or discarded when elements are added or removed. Since the list is not notified
+ *   when the UUID or name of an element changes, `T` must call #invalidateIndices()
+ *   in that case.
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by UUID.
  * - Observer pattern to get notified about added and removed elements.
  * - Undo commands librepcb::CmdListElementInsert, librepcb::CmdListElementRemove and
@@ -155,12 +159,28 @@ class SerializableObjectList : public SerializableObject
             return -1;
         }
         int indexOf(const Uuid& key) const noexcept {
-            for (int i = 0; i < count(); ++i) {if (mObjects[i]->getUuid() == key) {return i;}}
+            updateUuidIndex();
+            int index = mUuidIndex.value(key, -1);
+            if ((index >= 0) && (mObjects[index]->getUuid() == key)) {
+                return index;
+            }
+            // Not found or outdated index (e.g. an element was assigned through a
+            // reference without calling #invalidateIndices()), so fall back to a linear
+            // search and rebuild the index on the next lookup if it was wrong.
+            for (int i = 0; i < count(); ++i) {
+                if (mObjects[i]->getUuid() == key) {
+                    resetUuidIndex();
+                    return i;
+                }
+            }
+            if (index >= 0) {resetUuidIndex();}
             return -1;
         }
         int indexOf(const QString& name) const noexcept {
-            for (int i = 0; i < count(); ++i) {if (mObjects[i]->getName() == name) {return i;}}
-            return -1;
+            updateNameIndex();
+            int index = mNameIndex.value(name, -1);
+            Q_ASSERT((index < 0) || (mObjects[index]->getName() == name));
+            return index;
         }
         bool contains(int index) const noexcept {
             return index >= 0 && index < mObjects.count();
@@ -185,9 +205,9 @@ class SerializableObjectList : public SerializableObject
 
         // "Hard" Element Access (assertion or exception if not found!)
         std::shared_ptr<const T> at(int index) const noexcept {return std::const_pointer_cast<const T>(mObjects.at(index));} // always read-only!
-        std::shared_ptr<T>& first() noexcept {return mObjects.first();}
+        std::shared_ptr<T> first() noexcept {return mObjects.first();}
         std::shared_ptr<const T> first() const noexcept {return mObjects.first();}
-        std::shared_ptr<T>& last() noexcept {return mObjects.last();}
+        std::shared_ptr<T> last() noexcept {return mObjects.last();}
         std::shared_ptr<const T> last() const noexcept {return mObjects.last();}
         std::shared_ptr<T> get(const Uuid& key) {
             std::shared_ptr<T> ptr = find(key);
@@ -305,6 +325,17 @@ class SerializableObjectList : public SerializableObject
         void registerObserver(IF_Observer* o) noexcept {Q_ASSERT(o); mObservers.append(o);}
         void unregisterObserver(IF_Observer* o) noexcept {Q_ASSERT(o); mObservers.removeOne(o);}
 
+        // Static Methods
+
+        /**
+         * @brief Discard the UUID and name indices of all lists of this type
+         *
+         * Must be called by `T` whenever the UUID or name of an object changes (e.g. in
+         * its assignment operator), otherwise lookups would return outdated results. The
+         * indices are rebuilt on the next lookup.
+         */
+        static void invalidateIndices() noexcept {indicesGeneration().ref();}
+
         // Operator Overloadings
         std::shared_ptr<T> operator[](int i) noexcept {
             Q_ASSERT(contains(i));
@@ -345,15 +376,61 @@ class SerializableObjectList : public SerializableObject
 
     protected: // Methods
         void notifyObjectAdded(int index, const std::shared_ptr<T>& obj) noexcept {
+            // appended elements are added to the indices on the next lookup, but inserted
+            // elements shift the indices of all following elements
+            if (index < mUuidIndexCount) {resetUuidIndex();}
+            if (index < mNameIndexCount) {resetNameIndex();}
             foreach (IF_Observer* observer, mObservers) {
                 observer->listObjectAdded(*this, index, obj);
             }
         }
         void notifyObjectRemoved(int index, const std::shared_ptr<T>& obj) noexcept {
+            if (index < mUuidIndexCount) {resetUuidIndex();}
+            if (index < mNameIndexCount) {resetNameIndex();}
             foreach (IF_Observer* observer, mObservers) {
                 observer->listObjectRemoved(*this, index, obj);
             }
         }
+        void updateUuidIndex() const noexcept {
+            int generation = indicesGeneration().load();
+            if (generation != mUuidIndexGeneration) {
+                resetUuidIndex(); // an element of a list of this type was modified
+                mUuidIndexGeneration = generation;
+            }
+            if (mUuidIndexCount < count()) {mUuidIndex.reserve(count());}
+            for (; mUuidIndexCount < count(); ++mUuidIndexCount) {
+                const Uuid& uuid = mObjects[mUuidIndexCount]->getUuid();
+                if ((!uuid.isNull()) && (!mUuidIndex.contains(uuid))) {
+                    mUuidIndex.insert(uuid, mUuidIndexCount); // keep the first occurrence
+                }
+            }
+        }
+        void updateNameIndex() const noexcept {
+            int generation = indicesGeneration().load();
+            if (generation != mNameIndexGeneration) {
+                resetNameIndex(); // an element of a list of this type was modified
+                mNameIndexGeneration = generation;
+            }
+            if (mNameIndexCount < count()) {mNameIndex.reserve(count());}
+            for (; mNameIndexCount < count(); ++mNameIndexCount) {
+                const QString& name = mObjects[mNameIndexCount]->getName();
+                if (!mNameIndex.contains(name)) {
+                    mNameIndex.insert(name, mNameIndexCount); // keep the first occurrence
+                }
+            }
+        }
+        void resetUuidIndex() const noexcept {
+            mUuidIndex.clear();
+            mUuidIndexCount = 0;
+        }
+        void resetNameIndex() const noexcept {
+            mNameIndex.clear();
+            mNameIndexCount = 0;
+        }
+        static QAtomicInt& indicesGeneration() noexcept {
+            static QAtomicInt generation; // incremented by #invalidateIndices()
+            return generation;
+        }
         void throwKeyNotFoundException(const Uuid& key) const {
             throw RuntimeError(__FILE__, __LINE__, QString(tr("There is "
                 "no element of type \"%1\" with the UUID \"%2\" in the list."))
@@ -369,6 +446,14 @@ class SerializableObjectList : public SerializableObject
     protected: // Data
         QVector<std::shared_ptr<T>> mObjects;
         QList<IF_Observer*> mObservers;
+
+        // Lookup indices, built lazily by #indexOf() (key -> index of first element)
+        mutable QHash<Uuid, int> mUuidIndex;
+        mutable int mUuidIndexCount = 0; ///< count of elements added to #mUuidIndex
+        mutable int mUuidIndexGeneration = 0; ///< see #invalidateIndices()
+        mutable QHash<QString, int> mNameIndex;
+        mutable int mNameIndexCount = 0; ///< count of elements added to #mNameIndex
+        mutable int mNameIndexGeneration = 0; ///< see #invalidateIndices()
 };
 
 } // namespace librepcb
@@ -231,6 +231,15 @@ QString SExpression::toString(int indent) const
     }
 }
 
+void SExpression::writeBinary(QDataStream& stream) const noexcept
+{
+    // compact binary representation, e.g. for caching parsed files (see SExprFileCache)
+    stream << static_cast<quint8>(mType) << mValue << static_cast<qint32>(mChildren.count());
+    foreach (const SExpression& child, mChildren) {
+        child.writeBinary(stream);
+    }
+}
+
 /*****************************************************************************************
  *  Operator Overloadings
  ****************************************************************************************/
@@ -304,6 +313,39 @@ SExpression SExpression::parse(const QString& str, const FilePath& filePath)
     }
 }
 
+SExpression SExpression::readBinary(QDataStream& stream, const FilePath& filePath)
+{
+    return readBinary(stream, filePath, 0); // can throw
+}
+
+SExpression SExpression::readBinary(QDataStream& stream, const FilePath& filePath,
+                                    int depth)
+{
+    // Corrupt data must neither allocate huge amounts of memory nor overflow the stack,
+    // so the child count is limited by the remaining bytes (each child needs at least
+    // 9 bytes for its type, value length and child count) and the depth is limited too.
+    static const qint64 minChildSize = 9;
+    static const int maxDepth = 256;
+
+    quint8 type;
+    QString value;
+    qint32 childCount;
+    stream >> type >> value >> childCount;
+    qint64 remainingBytes = stream.device() ? stream.device()->bytesAvailable() : 0;
+    if ((stream.status() != QDataStream::Ok) || (type > static_cast<quint8>(Type::LineBreak))
+        || (childCount < 0) || (childCount > remainingBytes / minChildSize)
+        || (depth > maxDepth)) {
+        throw RuntimeError(__FILE__, __LINE__, tr("Invalid binary S-Expression data."));
+    }
+    SExpression sexpr(static_cast<Type>(type), value);
+    sexpr.mFilePath = filePath;
+    sexpr.mChildren.reserve(childCount);
+    for (qint32 i = 0; i < childCount; ++i) {
+        sexpr.mChildren.append(readBinary(stream, filePath, depth + 1)); // can throw
+    }
+    return sexpr;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -136,6 +136,7 @@ class SExpression final
         SExpression& appendChild(const SExpression& child, bool linebreak);
         void removeLineBreaks() noexcept;
         QString toString(int indent) const;
+        void writeBinary(QDataStream& stream) const noexcept;
 
         // Operator Overloadings
         SExpression& operator=(const SExpression& rhs) noexcept;
@@ -146,11 +147,14 @@ class SExpression final
         static SExpression createString(const QString& string);
         static SExpression createLineBreak();
         static SExpression parse(const QString& str, const FilePath& filePath);
+        static SExpression readBinary(QDataStream& stream, const FilePath& filePath);
 
 
     private: // Methods
         SExpression(Type type, const QString& value);
         SExpression(sexpresso::Sexp& sexp, const FilePath& filePath);
+        static SExpression readBinary(QDataStream& stream, const FilePath& filePath,
+                                      int depth);
 
         QString escapeString(const QString& string) const noexcept;
         bool isValidListName(const QString& name) const noexcept;
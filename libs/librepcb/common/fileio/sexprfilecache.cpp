@@ -0,0 +1,193 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "sexprfilecache.h"
+#include "fileutils.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constants
+ ****************************************************************************************/
+
+static const quint32 CACHE_FILE_MAGIC   = 0x4C505343; // "LPSC"
+static const quint32 CACHE_FILE_VERSION = 2;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SExprFileCache::SExprFileCache(const FilePath& cacheFile) noexcept :
+    mCacheFile(cacheFile), mModified(false), mHits(0), mMisses(0)
+{
+    if (!mCacheFile.isExistingFile()) {
+        return;
+    }
+    try {
+        QByteArray fileContent = FileUtils::readFile(mCacheFile); // can throw
+        QDataStream stream(fileContent);
+        stream.setVersion(QDataStream::Qt_5_2);
+        quint32 magic, version, count;
+        stream >> magic >> version >> count;
+        if ((magic != CACHE_FILE_MAGIC) || (version != CACHE_FILE_VERSION)) {
+            qInfo() << "Ignoring incompatible cache file:" << mCacheFile.toNative();
+            return;
+        }
+        QHash<QString, Entry> entries;
+        for (quint32 i = 0; (i < count) && (stream.status() == QDataStream::Ok); ++i) {
+            QString path;
+            Entry entry;
+            stream >> path >> entry.size >> entry.modified >> entry.hash >> entry.data
+                   >> entry.dataHash;
+            entries.insert(path, entry);
+        }
+        if (stream.status() != QDataStream::Ok) {
+            qWarning() << "Ignoring corrupt cache file:" << mCacheFile.toNative();
+            return;
+        }
+        mEntries = entries;
+    } catch (const Exception& e) {
+        qWarning() << "Could not read cache file:" << e.getMsg();
+    }
+}
+
+SExprFileCache::~SExprFileCache() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+bool SExprFileCache::get(const FilePath& filepath, const QByteArray& content,
+                         SExpression& dom) noexcept
+{
+    qint64 size, modified;
+    if (!getFileInfo(filepath, size, modified)) {
+        return false;
+    }
+
+    QString key = filepath.toStr();
+    Entry entry;
+    {
+        QMutexLocker locker(&mMutex);
+        auto it = mEntries.constFind(key);
+        if ((it == mEntries.constEnd()) || (it->size != size) || (it->modified != modified)
+            || (it->size != content.size())) {
+            ++mMisses;
+            return false;
+        }
+        entry = *it;
+    }
+
+    // validate and deserialize without holding the lock, on any mismatch the caller
+    // falls back to parsing the file content
+    bool valid = (entry.hash == QCryptographicHash::hash(content, QCryptographicHash::Sha1))
+        && (entry.dataHash == QCryptographicHash::hash(entry.data, QCryptographicHash::Sha1));
+    if (valid) {
+        try {
+            QDataStream stream(entry.data);
+            stream.setVersion(QDataStream::Qt_5_2);
+            dom = SExpression::readBinary(stream, filepath); // can throw
+        } catch (const Exception& e) {
+            valid = false;
+        }
+    }
+
+    QMutexLocker locker(&mMutex);
+    if (valid) {
+        mUsedEntries.insert(key);
+        ++mHits;
+    } else {
+        mEntries.remove(key);
+        mModified = true;
+        ++mMisses;
+    }
+    return valid;
+}
+
+void SExprFileCache::put(const FilePath& filepath, const QByteArray& content,
+                         const SExpression& dom) noexcept
+{
+    Entry entry;
+    if (!getFileInfo(filepath, entry.size, entry.modified) || (entry.size != content.size())) {
+        return; // the file was modified in the meantime
+    }
+    entry.hash = QCryptographicHash::hash(content, QCryptographicHash::Sha1);
+    QDataStream stream(&entry.data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_2);
+    dom.writeBinary(stream);
+    entry.dataHash = QCryptographicHash::hash(entry.data, QCryptographicHash::Sha1);
+
+    QMutexLocker locker(&mMutex);
+    mEntries.insert(filepath.toStr(), entry);
+    mUsedEntries.insert(filepath.toStr());
+    mModified = true;
+}
+
+void SExprFileCache::save()
+{
+    QMutexLocker locker(&mMutex);
+    qDebug() << "S-Expression file cache:" << mHits << "hits," << mMisses << "misses";
+    if ((!mModified) && (mUsedEntries.count() == mEntries.count())) {
+        return; // nothing changed
+    }
+
+    QByteArray fileContent;
+    QDataStream stream(&fileContent, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_2);
+    stream << CACHE_FILE_MAGIC << CACHE_FILE_VERSION << quint32(mUsedEntries.count());
+    foreach (const QString& path, mUsedEntries) {
+        const Entry& entry = mEntries[path];
+        stream << path << entry.size << entry.modified << entry.hash << entry.data
+               << entry.dataHash;
+    }
+    FileUtils::writeFile(mCacheFile, fileContent); // can throw
+    mModified = false;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool SExprFileCache::getFileInfo(const FilePath& filepath, qint64& size,
+                                 qint64& modified) noexcept
+{
+    QFileInfo info(filepath.toStr());
+    if (!info.isFile()) {
+        return false;
+    }
+    size = info.size();
+    modified = info.lastModified().toMSecsSinceEpoch();
+    return true;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,145 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SEXPRFILECACHE_H
+#define LIBREPCB_SEXPRFILECACHE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "filepath.h"
+#include "sexpression.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class SExprFileCache
+ ****************************************************************************************/
+
+/**
+ * @brief A binary cache of parsed S-Expression files
+ *
+ * Parsing big S-Expression files is much slower than reading a compact binary
+ * representation of the DOM tree (see SExpression::writeBinary()). This class stores
+ * such binary DOM trees of many files in a single cache file.
+ *
+ * Each entry is keyed by the file path, size, modification time and SHA-1 hash of the
+ * file content. An entry is only used if all of them still match, so the text files
+ * always stay the source of truth. Any mismatch or corrupted cache data just leads to a
+ * cache miss, i.e. the file is parsed as usual.
+ *
+ * All methods except the constructor and #save() are thread-safe.
+ *
+ * @see librepcb::SExprFilePreloader
+ */
+class SExprFileCache final
+{
+        Q_DECLARE_TR_FUNCTIONS(SExprFileCache)
+
+    public:
+
+        // Constructors / Destructor
+        SExprFileCache() = delete;
+        SExprFileCache(const SExprFileCache& other) = delete;
+
+        /**
+         * @brief Constructor which loads the cache file (if it exists and is valid)
+         *
+         * @param cacheFile     Path to the cache file
+         */
+        explicit SExprFileCache(const FilePath& cacheFile) noexcept;
+        ~SExprFileCache() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Get the cached DOM tree of a file
+         *
+         * @param filepath  The file which was read
+         * @param content   The current content of the file (used for validation)
+         * @param dom       The DOM tree is written to this object on a cache hit
+         *
+         * @return  True on a cache hit, false on a cache miss
+         */
+        bool get(const FilePath& filepath, const QByteArray& content,
+                 SExpression& dom) noexcept;
+
+        /**
+         * @brief Add or replace the cached DOM tree of a file
+         *
+         * @param filepath  The file which was read
+         * @param content   The content of the file
+         * @param dom       The DOM tree parsed from the content
+         */
+        void put(const FilePath& filepath, const QByteArray& content,
+                 const SExpression& dom) noexcept;
+
+        /**
+         * @brief Write the cache file if it was modified
+         *
+         * Entries which were neither hit nor added since the cache was loaded are dropped
+         * to keep the cache file small.
+         *
+         * @throw Exception If the file could not be written
+         */
+        void save();
+
+        // Operator Overloadings
+        SExprFileCache& operator=(const SExprFileCache& rhs) = delete;
+
+
+    private: // Types
+
+        struct Entry {
+            qint64 size;
+            qint64 modified;    ///< msecs since epoch
+            QByteArray hash;    ///< SHA-1 of the file content
+            QByteArray data;    ///< the binary DOM tree
+            QByteArray dataHash; ///< SHA-1 of #data, to detect a corrupt cache file
+        };
+
+
+    private: // Methods
+
+        static bool getFileInfo(const FilePath& filepath, qint64& size,
+                                qint64& modified) noexcept;
+
+
+    private: // Data
+
+        FilePath mCacheFile;
+        mutable QMutex mMutex; ///< protects all following members
+        QHash<QString, Entry> mEntries;
+        QSet<QString> mUsedEntries;
+        bool mModified;
+        int mHits;
+        int mMisses;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_SEXPRFILECACHE_H
@@ -0,0 +1,170 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "sexprfilepreloader.h"
+#include "sexprfilecache.h"
+#include "fileutils.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class SExprFilePreloader::Worker
+ ****************************************************************************************/
+
+class SExprFilePreloader::Worker final : public QRunnable
+{
+    public:
+        Worker(SExprFilePreloader& preloader, const FilePath& filepath) noexcept :
+            QRunnable(), mPreloader(preloader), mFilePath(filepath) {}
+        void run() noexcept override {mPreloader.parse(mFilePath);}
+    private:
+        SExprFilePreloader& mPreloader;
+        FilePath mFilePath;
+};
+
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+QThreadStorage<SExprFilePreloader*> SExprFilePreloader::sActive;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SExprFilePreloader::SExprFilePreloader(SExprFileCache* cache) noexcept :
+    mCache(cache), mWorkerTimeMs(0), mRunningWorkers(0), mPreviousActive(active())
+{
+    sActive.setLocalData(this);
+}
+
+SExprFilePreloader::~SExprFilePreloader() noexcept
+{
+    Q_ASSERT(active() == this);
+    sActive.setLocalData(mPreviousActive);
+
+    QMutexLocker locker(&mMutex);
+    while (mRunningWorkers > 0) {
+        mEntryFinished.wait(&mMutex);
+    }
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void SExprFilePreloader::preload(const QList<FilePath>& files, bool restore) noexcept
+{
+    QMutexLocker locker(&mMutex);
+    foreach (const FilePath& file, files) {
+        // choose the same file as librepcb::SmartFile would do
+        FilePath tmpFile(file.toStr() % '~');
+        FilePath filepath = (restore && tmpFile.isExistingFile()) ? tmpFile : file;
+        if (mEntries.contains(filepath) || (!filepath.isExistingFile())) {
+            continue; // missing files are reported later by the regular loading code
+        }
+        mEntries.insert(filepath, Entry{false, false, QByteArray(), SExpression(),
+                                        QSharedPointer<Exception>()});
+        ++mRunningWorkers;
+        QThreadPool::globalInstance()->start(new Worker(*this, filepath));
+    }
+}
+
+bool SExprFilePreloader::take(const FilePath& openedFilePath, QByteArray& content,
+                              SExpression& dom)
+{
+    QMutexLocker locker(&mMutex);
+    auto it = mEntries.find(openedFilePath);
+    if ((it == mEntries.end()) || it->taken) {
+        return false;
+    }
+    while (!it->finished) {
+        mEntryFinished.wait(&mMutex);
+        it = mEntries.find(openedFilePath); // iterator may be invalidated while waiting
+    }
+    it->taken = true;
+    QSharedPointer<Exception> error = it->error;
+    content = it->content;  it->content.clear();
+    dom = it->dom;          it->dom = SExpression();
+    locker.unlock();
+    if (error) {
+        error->raise();
+    }
+    return true;
+}
+
+qint64 SExprFilePreloader::getWorkerTimeMs() const noexcept
+{
+    QMutexLocker locker(&mMutex);
+    return mWorkerTimeMs;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+SExprFilePreloader* SExprFilePreloader::active() noexcept
+{
+    return sActive.hasLocalData() ? sActive.localData() : nullptr;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void SExprFilePreloader::parse(const FilePath& filepath) noexcept
+{
+    QElapsedTimer timer;
+    timer.start();
+    QByteArray content;
+    SExpression dom;
+    QSharedPointer<Exception> error;
+    try {
+        content = FileUtils::readFile(filepath); // can throw
+        if ((!mCache) || (!mCache->get(filepath, content, dom))) {
+            dom = SExpression::parse(content, filepath); // can throw
+            if (mCache) mCache->put(filepath, content, dom);
+        }
+    } catch (const Exception& e) {
+        error.reset(e.clone());
+    }
+
+    QMutexLocker locker(&mMutex);
+    Entry& entry = mEntries[filepath];
+    entry.finished = true;
+    entry.content = content;
+    entry.dom = dom;
+    entry.error = error;
+    mWorkerTimeMs += timer.elapsed();
+    --mRunningWorkers;
+    mEntryFinished.wakeAll();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
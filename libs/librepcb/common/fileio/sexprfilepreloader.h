@@ -0,0 +1,166 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SEXPRFILEPRELOADER_H
+#define LIBREPCB_SEXPRFILEPRELOADER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "filepath.h"
+#include "sexpression.h"
+#include "../exceptions.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class SExprFileCache;
+
+/*****************************************************************************************
+ *  Class SExprFilePreloader
+ ****************************************************************************************/
+
+/**
+ * @brief Reads and parses a set of S-Expression files in parallel worker threads
+ *
+ * Reading and parsing files is independent per file, but constructing the objects from
+ * the parsed DOM trees often is not (QObject parents, graphics scenes, ...). So this
+ * class only does the reading and parsing in the global QThreadPool, while the objects
+ * are still constructed sequentially in the calling thread.
+ *
+ * While an instance exists, it is registered as the active preloader of the thread which
+ * created it, and librepcb::SmartSExprFile::parseFileAndBuildDomTree() takes the DOM tree
+ * from it (blocking until the file is parsed) instead of parsing the file again. Files
+ * not known to the preloader are parsed synchronously as usual. Parse errors are
+ * transferred to the caller of #take(), so error handling stays the same.
+ *
+ * Optionally a librepcb::SExprFileCache can be passed to the constructor. Then the
+ * workers take the DOM trees from that cache instead of parsing the files if they are
+ * still up to date, and add all newly parsed DOM trees to it.
+ *
+ * Example:
+ * @code
+ * SExprFilePreloader preloader;
+ * preloader.preload(filesToLoad, restore); // starts parsing immediately
+ * Schematic* schematic = new Schematic(...); // picks up the preloaded DOM tree
+ * @endcode
+ */
+class SExprFilePreloader final
+{
+        Q_DECLARE_TR_FUNCTIONS(SExprFilePreloader)
+
+    public:
+
+        // Constructors / Destructor
+        explicit SExprFilePreloader(SExprFileCache* cache = nullptr) noexcept;
+        SExprFilePreloader(const SExprFilePreloader& other) = delete;
+
+        /**
+         * @brief Destructor which waits until all workers are finished
+         */
+        ~SExprFilePreloader() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Start reading and parsing some files in worker threads
+         *
+         * @param files     Paths to the original files (never to backups with '~').
+         *                  Non-existent files are ignored.
+         * @param restore   If true, backup files (*~) are loaded instead of the
+         *                  original files where they exist (same as in
+         *                  librepcb::SmartFile)
+         */
+        void preload(const QList<FilePath>& files, bool restore) noexcept;
+
+        /**
+         * @brief Take the DOM tree of a file out of the preloader
+         *
+         * Blocks until the worker thread has parsed the file.
+         *
+         * @param openedFilePath    The path to the file to get (backup or original)
+         * @param content           The raw file content is written to this object
+         * @param dom               The DOM tree is written to this object
+         *
+         * @retval true     If the file is known to this preloader and was not yet taken
+         * @retval false    If the caller has to parse the file on its own
+         *
+         * @throw Exception If reading or parsing the file failed
+         */
+        bool take(const FilePath& openedFilePath, QByteArray& content, SExpression& dom);
+
+        /**
+         * @brief Get the total time spent in worker threads (for profiling)
+         *
+         * @return Summed up reading and parsing time of all files in milliseconds
+         */
+        qint64 getWorkerTimeMs() const noexcept;
+
+        // Operator Overloadings
+        SExprFilePreloader& operator=(const SExprFilePreloader& rhs) = delete;
+
+        // Static Methods
+
+        /**
+         * @brief Get the active preloader of the current thread
+         *
+         * @return The preloader or nullptr if there is none
+         */
+        static SExprFilePreloader* active() noexcept;
+
+
+    private: // Types
+
+        struct Entry {
+            bool finished;
+            bool taken;
+            QByteArray content;
+            SExpression dom;
+            QSharedPointer<Exception> error;
+        };
+        class Worker;
+
+
+    private: // Methods
+
+        void parse(const FilePath& filepath) noexcept;
+
+
+    private: // Data
+
+        SExprFileCache* mCache; ///< optional, may be nullptr
+        mutable QMutex mMutex; ///< protects #mEntries and #mWorkerTimeMs
+        QWaitCondition mEntryFinished;
+        QHash<FilePath, Entry> mEntries;
+        qint64 mWorkerTimeMs;
+        int mRunningWorkers;
+        SExprFilePreloader* mPreviousActive;
+        static QThreadStorage<SExprFilePreloader*> sActive;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_SEXPRFILEPRELOADER_H
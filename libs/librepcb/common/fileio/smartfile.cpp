@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "smartfile.h"
 #include "fileutils.h"
+#include "backgroundfilewriter.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -69,6 +70,9 @@ SmartFile::SmartFile(const FilePath& filepath, bool restore, bool readOnly, bool
 SmartFile::~SmartFile() noexcept
 {
     // remove temporary file, if required
+    if ((!mIsRestored) && (!mIsReadOnly) && BackgroundFileWriter::instance()) {
+        BackgroundFileWriter::instance()->discard(mTmpFilePath);
+    }
     if ((!mIsRestored) && (!mIsReadOnly) && (mTmpFilePath.isExistingFile())) {
         try {
             FileUtils::removeFile(mTmpFilePath);
@@ -89,9 +93,13 @@ void SmartFile::removeFile(bool original)
     }
 
     FilePath filepath(original ? mFilePath : mTmpFilePath);
+    if ((!original) && BackgroundFileWriter::instance()) {
+        BackgroundFileWriter::instance()->discard(filepath);
+    }
     if (filepath.isExistingFile()) {
         FileUtils::removeFile(filepath);
     }
+    (original ? mOriginalContentHash : mTmpContentHash).clear();
 }
 
 /*****************************************************************************************
@@ -116,6 +124,32 @@ void SmartFile::updateMembersAfterSaving(bool toOriginal) noexcept
         mIsCreated = false;
 }
 
+bool SmartFile::writeContentIfModified(const QByteArray& content, bool toOriginal)
+{
+    const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal); // can throw
+    QByteArray& knownHash = toOriginal ? mOriginalContentHash : mTmpContentHash;
+    QByteArray hash = QCryptographicHash::hash(content, QCryptographicHash::Sha1);
+    if ((hash == knownHash) && filepath.isExistingFile()) {
+        updateMembersAfterSaving(toOriginal);
+        return false; // file is up to date, nothing to do
+    }
+    knownHash.clear(); // the file content is undefined if writing fails
+    FileUtils::writeFile(filepath, content); // can throw
+    knownHash = hash;
+    updateMembersAfterSaving(toOriginal);
+    return true;
+}
+
+void SmartFile::setLoadedContent(const QByteArray& content) const noexcept
+{
+    QByteArray hash = QCryptographicHash::hash(content, QCryptographicHash::Sha1);
+    if (mOpenedFilePath == mFilePath) {
+        mOriginalContentHash = hash;
+    } else {
+        mTmpContentHash = hash;
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
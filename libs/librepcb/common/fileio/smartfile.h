@@ -46,6 +46,7 @@ namespace librepcb {
  *  - Creation of backup files ('~' at the end of the filename)
  *  - Restoring backup files
  *  - Helper methods for subclasses to load/save files
+ *  - Skip writing files whose content has not changed since they were loaded or saved
  *
  * @note See @ref doc_project_save for more details about the backup/restore feature.
  *
@@ -176,6 +177,34 @@ class SmartFile
          */
         void updateMembersAfterSaving(bool toOriginal) noexcept;
 
+        /**
+         * @brief Write some content to the original or backup file, but only if it
+         *        differs from the content known to be in that file already
+         *
+         * This method calls #prepareSaveAndReturnFilePath() and
+         * #updateMembersAfterSaving(), so subclasses don't have to call them again.
+         *
+         * @param content       The whole new content of the file
+         * @param toOriginal    Specifies whether the original or the backup file should
+         *                      be overwritten/created.
+         *
+         * @retval true     If the file was written
+         * @retval false    If the file exists already with exactly this content
+         *
+         * @throw Exception If an error occurs
+         */
+        bool writeContentIfModified(const QByteArray& content, bool toOriginal);
+
+        /**
+         * @brief Remember the content which was loaded from #mOpenedFilePath
+         *
+         * Subclasses should call this method after reading the file to allow
+         * #writeContentIfModified() skipping unmodified files on the next save.
+         *
+         * @param content   The content of the file #mOpenedFilePath
+         */
+        void setLoadedContent(const QByteArray& content) const noexcept;
+
 
         // General Attributes
 
@@ -221,6 +250,17 @@ class SmartFile
          */
         bool mIsCreated;
 
+        /**
+         * @brief Hash of the content of the original file (#mFilePath) as last loaded
+         *        or written, or empty if unknown
+         */
+        mutable QByteArray mOriginalContentHash;
+
+        /**
+         * @brief Hash of the content of the backup file (#mTmpFilePath) as last loaded
+         *        or written, or empty if unknown
+         */
+        mutable QByteArray mTmpContentHash;
 };
 
 /*****************************************************************************************
@@ -24,6 +24,8 @@
 #include "smartsexprfile.h"
 #include "fileutils.h"
 #include "sexpression.h"
+#include "backgroundfilewriter.h"
+#include "sexprfilepreloader.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -49,18 +51,33 @@ SmartSExprFile::~SmartSExprFile() noexcept
 
 SExpression SmartSExprFile::parseFileAndBuildDomTree() const
 {
-    return SExpression::parse(FileUtils::readFile(mOpenedFilePath), mOpenedFilePath);
+    QByteArray content;
+    SExpression dom;
+    SExprFilePreloader* preloader = SExprFilePreloader::active();
+    if (preloader && preloader->take(mOpenedFilePath, content, dom)) { // can throw
+        setLoadedContent(content);
+        return dom;
+    }
+    content = FileUtils::readFile(mOpenedFilePath);
+    setLoadedContent(content);
+    return SExpression::parse(content, mOpenedFilePath);
 }
 
 void SmartSExprFile::save(const SExpression& domDocument, bool toOriginal)
 {
-    FilePath filepath = prepareSaveAndReturnFilePath(toOriginal); // can throw
+    if ((!toOriginal) && BackgroundFileWriter::instance()) {
+        // backup files are serialized and written in the background
+        const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal); // can throw
+        BackgroundFileWriter::instance()->write(filepath, domDocument);
+        mTmpContentHash.clear(); // the writer keeps track of the content on its own
+        updateMembersAfterSaving(toOriginal);
+        return;
+    }
     QString content = domDocument.toString(0); // can throw
     if (!content.endsWith('\n')) {
         content.append('\n');
     }
-    FileUtils::writeFile(filepath, content.toUtf8()); // can throw
-    updateMembersAfterSaving(toOriginal);
+    writeContentIfModified(content.toUtf8(), toOriginal); // can throw
 }
 
 /*****************************************************************************************
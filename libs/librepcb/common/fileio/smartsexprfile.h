@@ -87,6 +87,9 @@ class SmartSExprFile final : public SmartFile
         /**
          * @brief Open and parse the S-Expressions file and build the whole DOM tree
          *
+         * @note    If a librepcb::SExprFilePreloader is active in the current thread and
+         *          knows this file, the DOM tree is taken from it instead.
+         *
          * @return  A pointer to the created DOM tree. The caller takes the ownership of
          *          the DOM document.
          */
@@ -95,6 +98,10 @@ class SmartSExprFile final : public SmartFile
         /**
          * @brief Write the S-Expressions DOM tree to the file system
          *
+         * @note    If a librepcb::BackgroundFileWriter instance exists, backup files are
+         *          written asynchronously by it. Call BackgroundFileWriter#flush() to
+         *          wait for them and to get the errors.
+         *
          * @param domDocument   The DOM document to save
          * @param toOriginal    Specifies whether the original or the backup file should
          *                      be overwritten/created.
@@ -0,0 +1,288 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "strokefont.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Glyph Definitions
+ ****************************************************************************************/
+
+static const qreal sCapHeight = 6;      ///< cap height in font units
+static const qreal sLineSpacing = 9;    ///< baseline distance in font units
+static const qreal sLetterSpacing = 2;  ///< gap between glyphs in font units
+
+/**
+ * @brief Definition of a glyph
+ *
+ * The strokes are separated by ';', the points of a stroke by ' ' and the coordinates
+ * of a point by ','. The Y axis points upwards and the baseline is at y=0.
+ */
+struct GlyphDefinition {
+    ushort unicode;
+    qreal width;
+    const char* strokes;
+};
+
+static const GlyphDefinition sGlyphDefinitions[] = {
+    {' ',  2, ""},
+    {'!',  0, "0,6 0,2;0,0.5 0,0"},
+    {'"',  2, "0,6 0,5;2,6 2,5"},
+    {'#',  4, "1,0 1,6;3,0 3,6;0,2 4,2;0,4 4,4"},
+    {'$',  4, "4,5 3,6 1,6 0,5 0,4 1,3 3,3 4,2 4,1 3,0 1,0 0,1;2,6.5 2,-0.5"},
+    {'%',  4, "0,0 4,6;0,6 0,5 1,5 1,6 0,6;3,0 3,1 4,1 4,0 3,0"},
+    {'&',  4, "4,0 1,4 1,5 2,6 3,5 3,4 0,2 0,1 1,0 2,0 4,2"},
+    {'\'', 0, "0,6 0,5"},
+    {'(',  2, "2,7 0,5 0,1 2,-1"},
+    {')',  2, "0,7 2,5 2,1 0,-1"},
+    {'*',  4, "2,1 2,5;0,2 4,4;0,4 4,2"},
+    {'+',  4, "2,1 2,5;0,3 4,3"},
+    {',',  1, "1,0.5 1,0 0,-1"},
+    {'-',  4, "0,3 4,3"},
+    {'.',  0, "0,0.5 0,0"},
+    {'/',  4, "0,0 4,6"},
+    {'0',  4, "1,0 0,1 0,5 1,6 3,6 4,5 4,1 3,0 1,0;0,1 4,5"},
+    {'1',  4, "0,4 2,6 2,0;0,0 4,0"},
+    {'2',  4, "0,5 1,6 3,6 4,5 4,4 0,0 4,0"},
+    {'3',  4, "0,5 1,6 3,6 4,5 4,4 3,3 1,3;3,3 4,2 4,1 3,0 1,0 0,1"},
+    {'4',  4, "3,0 3,6 0,2 4,2"},
+    {'5',  4, "4,6 0,6 0,3 3,3 4,2 4,1 3,0 1,0 0,1"},
+    {'6',  4, "4,5 3,6 1,6 0,5 0,1 1,0 3,0 4,1 4,2 3,3 0,3"},
+    {'7',  4, "0,6 4,6 1,0"},
+    {'8',  4, "1,3 0,4 0,5 1,6 3,6 4,5 4,4 3,3 1,3 0,2 0,1 1,0 3,0 4,1 4,2 3,3"},
+    {'9',  4, "0,1 1,0 3,0 4,1 4,5 3,6 1,6 0,5 0,4 1,3 4,3"},
+    {':',  0, "0,4 0,3.5;0,0.5 0,0"},
+    {';',  1, "1,4 1,3.5;1,0.5 1,0 0,-1"},
+    {'<',  4, "4,5 0,3 4,1"},
+    {'=',  4, "0,2 4,2;0,4 4,4"},
+    {'>',  4, "0,5 4,3 0,1"},
+    {'?',  4, "0,5 1,6 3,6 4,5 4,4 2,2.5 2,2;2,0.5 2,0"},
+    {'@',  4, "3,2 3,4 1,4 1,2 3,2 4,3 4,5 3,6 1,6 0,5 0,1 1,0 4,0"},
+    {'A',  4, "0,0 0,4 2,6 4,4 4,0;0,3 4,3"},
+    {'B',  4, "0,0 0,6 3,6 4,5 4,4 3,3 0,3;3,3 4,2 4,1 3,0 0,0"},
+    {'C',  4, "4,5 3,6 1,6 0,5 0,1 1,0 3,0 4,1"},
+    {'D',  4, "0,0 0,6 2,6 4,4 4,2 2,0 0,0"},
+    {'E',  4, "4,6 0,6 0,0 4,0;0,3 3,3"},
+    {'F',  4, "4,6 0,6 0,0;0,3 3,3"},
+    {'G',  4, "4,5 3,6 1,6 0,5 0,1 1,0 3,0 4,1 4,3 2,3"},
+    {'H',  4, "0,0 0,6;4,0 4,6;0,3 4,3"},
+    {'I',  2, "0,0 2,0;1,0 1,6;0,6 2,6"},
+    {'J',  4, "4,6 4,1 3,0 1,0 0,1"},
+    {'K',  4, "0,0 0,6;4,6 0,2;1,3 4,0"},
+    {'L',  4, "0,6 0,0 4,0"},
+    {'M',  4, "0,0 0,6 2,3 4,6 4,0"},
+    {'N',  4, "0,0 0,6 4,0 4,6"},
+    {'O',  4, "1,0 0,1 0,5 1,6 3,6 4,5 4,1 3,0 1,0"},
+    {'P',  4, "0,0 0,6 3,6 4,5 4,4 3,3 0,3"},
+    {'Q',  4, "1,0 0,1 0,5 1,6 3,6 4,5 4,1 3,0 1,0;2,2 4,0"},
+    {'R',  4, "0,0 0,6 3,6 4,5 4,4 3,3 0,3;2,3 4,0"},
+    {'S',  4, "4,5 3,6 1,6 0,5 0,4 1,3 3,3 4,2 4,1 3,0 1,0 0,1"},
+    {'T',  4, "0,6 4,6;2,6 2,0"},
+    {'U',  4, "0,6 0,1 1,0 3,0 4,1 4,6"},
+    {'V',  4, "0,6 2,0 4,6"},
+    {'W',  4, "0,6 1,0 2,3 3,0 4,6"},
+    {'X',  4, "0,0 4,6;0,6 4,0"},
+    {'Y',  4, "0,6 2,3 4,6;2,3 2,0"},
+    {'Z',  4, "0,6 4,6 0,0 4,0"},
+    {'[',  2, "2,7 0,7 0,-1 2,-1"},
+    {'\\', 4, "0,6 4,0"},
+    {']',  2, "0,7 2,7 2,-1 0,-1"},
+    {'^',  4, "0,4 2,6 4,4"},
+    {'_',  4, "0,-1 4,-1"},
+    {'`',  1, "0,6 1,5"},
+    {'a',  4, "4,4 4,0;4,3 3,4 1,4 0,3 0,1 1,0 3,0 4,1"},
+    {'b',  4, "0,6 0,0;0,3 1,4 3,4 4,3 4,1 3,0 1,0 0,1"},
+    {'c',  4, "4,3 3,4 1,4 0,3 0,1 1,0 3,0 4,1"},
+    {'d',  4, "4,6 4,0;4,3 3,4 1,4 0,3 0,1 1,0 3,0 4,1"},
+    {'e',  4, "0,2 4,2 4,3 3,4 1,4 0,3 0,1 1,0 4,0"},
+    {'f',  3, "3,6 2,6 1,5 1,0;0,4 3,4"},
+    {'g',  4, "4,4 4,-1 3,-2 1,-2 0,-1;4,3 3,4 1,4 0,3 0,1 1,0 3,0 4,1"},
+    {'h',  4, "0,6 0,0;0,3 1,4 3,4 4,3 4,0"},
+    {'i',  0, "0,0 0,4;0,5.5 0,6"},
+    {'j',  2, "2,4 2,-1 1,-2 0,-2;2,5.5 2,6"},
+    {'k',  3, "0,6 0,0;3,4 0,1;1,2 3,0"},
+    {'l',  1, "0,6 0,1 1,0"},
+    {'m',  4, "0,0 0,4;0,3 1,4 2,3 2,0;2,3 3,4 4,3 4,0"},
+    {'n',  4, "0,0 0,4;0,3 1,4 3,4 4,3 4,0"},
+    {'o',  4, "1,0 0,1 0,3 1,4 3,4 4,3 4,1 3,0 1,0"},
+    {'p',  4, "0,4 0,-2;0,3 1,4 3,4 4,3 4,1 3,0 1,0 0,1"},
+    {'q',  4, "4,4 4,-2;4,3 3,4 1,4 0,3 0,1 1,0 3,0 4,1"},
+    {'r',  3, "0,0 0,4;0,2 2,4 3,4"},
+    {'s',  4, "4,3 3,4 1,4 0,3 1,2 3,2 4,1 3,0 1,0 0,1"},
+    {'t',  3, "1,6 1,1 2,0 3,0;0,4 3,4"},
+    {'u',  4, "0,4 0,1 1,0 3,0 4,1;4,4 4,0"},
+    {'v',  4, "0,4 2,0 4,4"},
+    {'w',  4, "0,4 1,0 2,2 3,0 4,4"},
+    {'x',  4, "0,0 4,4;0,4 4,0"},
+    {'y',  4, "0,4 2,0;4,4 1,-2"},
+    {'z',  4, "0,4 4,4 0,0 4,0"},
+    {'{',  3, "3,7 2,7 1,6 1,4 0,3 1,2 1,0 2,-1 3,-1"},
+    {'|',  0, "0,7 0,-1"},
+    {'}',  3, "0,7 1,7 2,6 2,4 3,3 2,2 2,0 1,-1 0,-1"},
+    {'~',  4, "0,3 1,4 3,2 4,3"},
+    {0x00B0, 1, "0,6 1,6 1,5 0,5 0,6"},                             // degree sign
+    {0x00B1, 4, "2,2 2,6;0,4 4,4;0,0 4,0"},                         // plus-minus sign
+    {0x00B5, 4, "0,-2 0,4;0,1 1,0 3,0 4,1;4,4 4,0"},                // micro sign
+    {0x03A9, 4, "0,0 1,0 1,1 0,3 0,5 1,6 3,6 4,5 4,3 3,1 3,0 4,0"}, // greek capital omega
+    {0x03BC, 4, "0,-2 0,4;0,1 1,0 3,0 4,1;4,4 4,0"},                // greek small mu
+    {0x2126, 4, "0,0 1,0 1,1 0,3 0,5 1,6 3,6 4,5 4,3 3,1 3,0 4,0"}, // ohm sign
+};
+
+static const GlyphDefinition sReplacementGlyph = {0, 4, "0,0 0,6 4,6 4,0 0,0"};
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+StrokeFont::StrokeFont() noexcept
+{
+}
+
+StrokeFont::~StrokeFont() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+StrokeFont::Glyph StrokeFont::getGlyph(QChar ch) const noexcept
+{
+    QMutexLocker locker(&mMutex);
+    auto it = mGlyphs.constFind(ch);
+    if (it == mGlyphs.constEnd()) {
+        it = mGlyphs.insert(ch, parseGlyph(ch));
+    }
+    return *it;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+QVector<Path> StrokeFont::stroke(const QString& text, const Length& height,
+                                 const Alignment& align) const noexcept
+{
+    QStringList lines = text.split('\n');
+    qreal scale = height.toNm() / sCapHeight; // nanometers per font unit
+
+    // vertical offset of the first baseline, depending on the alignment
+    qreal blockBottom = -(lines.count() - 1) * sLineSpacing;
+    qreal y;
+    if (align.getV() == VAlign::top()) {
+        y = -sCapHeight;
+    } else if (align.getV() == VAlign::center()) {
+        y = -(sCapHeight + blockBottom) / 2;
+    } else {
+        y = -blockBottom;
+    }
+
+    QVector<Path> paths;
+    foreach (const QString& line, lines) {
+        qreal x = 0;
+        if (align.getH() == HAlign::center()) {
+            x = -calcLineWidth(line) / 2;
+        } else if (align.getH() == HAlign::right()) {
+            x = -calcLineWidth(line);
+        }
+        foreach (const QChar& ch, line) {
+            Glyph glyph = getGlyph(ch);
+            foreach (const QPolygonF& polyline, glyph.strokes) {
+                Path path;
+                foreach (const QPointF& p, polyline) {
+                    path.addVertex(Point(Length(qRound64((x + p.x()) * scale)),
+                                         Length(qRound64((y + p.y()) * scale))));
+                }
+                paths.append(path);
+            }
+            x += glyph.advance;
+        }
+        y -= sLineSpacing;
+    }
+    return paths;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+const StrokeFont& StrokeFont::instance() noexcept
+{
+    static StrokeFont font;
+    return font;
+}
+
+Length StrokeFont::calcStrokeWidth(const Length& height) noexcept
+{
+    return qMax(height / 8, Length(1));
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+StrokeFont::Glyph StrokeFont::parseGlyph(QChar ch) noexcept
+{
+    const GlyphDefinition* definition = &sReplacementGlyph;
+    for (const GlyphDefinition& def : sGlyphDefinitions) {
+        if (def.unicode == ch.unicode()) {
+            definition = &def;
+            break;
+        }
+    }
+
+    Glyph glyph;
+    glyph.advance = definition->width + sLetterSpacing;
+    QStringList strokes = QString(definition->strokes).split(';', QString::SkipEmptyParts);
+    foreach (const QString& points, strokes) {
+        QPolygonF polyline;
+        foreach (const QString& point, points.split(' ', QString::SkipEmptyParts)) {
+            QStringList coordinates = point.split(',');
+            Q_ASSERT(coordinates.count() == 2);
+            polyline.append(QPointF(coordinates.value(0).toDouble(),
+                                    coordinates.value(1).toDouble()));
+        }
+        glyph.strokes.append(polyline);
+    }
+    return glyph;
+}
+
+qreal StrokeFont::calcLineWidth(const QString& line) const noexcept
+{
+    if (line.isEmpty()) return 0;
+    qreal width = 0;
+    foreach (const QChar& ch, line) {
+        width += getGlyph(ch).advance;
+    }
+    return width - sLetterSpacing;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
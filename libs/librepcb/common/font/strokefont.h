@@ -0,0 +1,114 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_STROKEFONT_H
+#define LIBREPCB_STROKEFONT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "../geometry/path.h"
+#include "../alignment.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class StrokeFont
+ ****************************************************************************************/
+
+/**
+ * @brief The StrokeFont class is a simple built-in vector font consisting of polylines
+ *
+ * In contrast to QFont, the geometry of a stroke font does not depend on the fonts
+ * installed on the system and it can be represented exactly in CAM output (a text is
+ * just a set of lines with round caps). It is used for texts of footprints on the
+ * screen, in the Gerber export and for the clearance of planes.
+ *
+ * The glyphs are defined on a grid where the cap height is 6 units, the x-height is 4
+ * units and descenders go down to -2 units. They are parsed on first use and cached
+ * per character, so laying out a text only involves hash lookups and transformations.
+ * Characters without a glyph are drawn as a box.
+ *
+ * This class is thread-safe.
+ */
+class StrokeFont final
+{
+    public:
+
+        // Types
+        struct Glyph {
+            QVector<QPolygonF> strokes; ///< polylines in font units
+            qreal advance;              ///< horizontal advance in font units
+        };
+
+        // Constructors / Destructor
+        StrokeFont() noexcept;
+        StrokeFont(const StrokeFont& other) = delete;
+        ~StrokeFont() noexcept;
+
+        // Getters
+        Glyph getGlyph(QChar ch) const noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Lay out a text into stroke paths
+         *
+         * @param text      The text to lay out (may contain line breaks)
+         * @param height    The cap height of the text
+         * @param align     The alignment of the text relative to the origin
+         *
+         * @return Open paths (one per stroke) in text coordinates, i.e. the origin is
+         *         the anchor point defined by the alignment. The paths need to be drawn
+         *         with round caps and a width of #calcStrokeWidth().
+         */
+        QVector<Path> stroke(const QString& text, const Length& height,
+                             const Alignment& align) const noexcept;
+
+        // Operator Overloadings
+        StrokeFont& operator=(const StrokeFont& rhs) = delete;
+
+        // Static Methods
+        static const StrokeFont& instance() noexcept;
+        static Length calcStrokeWidth(const Length& height) noexcept;
+
+
+    private:
+
+        // Private Methods
+        static Glyph parseGlyph(QChar ch) noexcept;
+        qreal calcLineWidth(const QString& line) const noexcept;
+
+
+        // Attributes
+        mutable QMutex mMutex;
+        mutable QHash<QChar, Glyph> mGlyphs; ///< parsed glyph cache
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_STROKEFONT_H
@@ -50,6 +50,17 @@ CmdPolygonEdit::~CmdPolygonEdit() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 CmdPolygonEdit::getMemoryUsage() const noexcept
+{
+    return UndoCommand::getMemoryUsage() + sizeof(CmdPolygonEdit) - sizeof(UndoCommand)
+         + (mOldPath.getVertices().capacity() + mNewPath.getVertices().capacity())
+           * sizeof(Vertex);
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
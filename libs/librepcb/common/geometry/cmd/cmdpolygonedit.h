@@ -52,6 +52,11 @@ class CmdPolygonEdit final : public UndoCommand
         explicit CmdPolygonEdit(Polygon& polygon) noexcept;
         ~CmdPolygonEdit() noexcept;
 
+        // Getters
+
+        /// @copydoc UndoCommand::getMemoryUsage()
+        qint64 getMemoryUsage() const noexcept override;
+
         // Setters
         void setLayerName(const QString& name, bool immediate) noexcept;
         void setLineWidth(const Length& width, bool immediate) noexcept;
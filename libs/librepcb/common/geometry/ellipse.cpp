@@ -46,9 +46,9 @@ Ellipse::Ellipse(const Uuid& uuid, const Ellipse& other) noexcept :
 Ellipse::Ellipse(const Uuid& uuid, const QString& layerName, const Length& lineWidth, bool fill,
                  bool isGrabArea, const Point& center, const Length& radiusX,
                  const Length& radiusY, const Angle& rotation) noexcept :
-    mUuid(uuid), mLayerName(layerName), mLineWidth(lineWidth), mIsFilled(fill),
-    mIsGrabArea(isGrabArea), mCenter(center), mRadiusX(radiusX), mRadiusY(radiusY),
-    mRotation(rotation)
+    mUuid(uuid), mLayerName(layerName), mLayerId(layerName), mLineWidth(lineWidth),
+    mIsFilled(fill), mIsGrabArea(isGrabArea), mCenter(center), mRadiusX(radiusX),
+    mRadiusY(radiusY), mRotation(rotation)
 {
 }
 
@@ -61,6 +61,7 @@ Ellipse::Ellipse(const SExpression& node)
         mUuid = Uuid::createRandom();
     }
     mLayerName = node.getValueByPath<QString>("layer", true);
+    mLayerId = GraphicsLayerId(mLayerName);
     mLineWidth = node.getValueByPath<Length>("width", true);
     mIsFilled = node.getValueByPath<bool>("fill", true);
     mIsGrabArea = node.getValueByPath<bool>("grab", true);
@@ -90,6 +91,7 @@ void Ellipse::setLayerName(const QString& name) noexcept
 {
     if (name == mLayerName) return;
     mLayerName = name;
+    mLayerId = GraphicsLayerId(name);
     foreach (IF_EllipseObserver* object, mObservers) {
         object->ellipseLayerNameChanged(mLayerName);
     }
@@ -225,6 +227,7 @@ Ellipse& Ellipse::operator=(const Ellipse& rhs) noexcept
 {
     mUuid = rhs.mUuid;
     mLayerName = rhs.mLayerName;
+    mLayerId = rhs.mLayerId;
     mLineWidth = rhs.mLineWidth;
     mIsFilled = rhs.mIsFilled;
     mIsGrabArea = rhs.mIsGrabArea;
@@ -46,8 +46,8 @@ Polygon::Polygon(const Uuid& uuid, const Polygon& other) noexcept :
 
 Polygon::Polygon(const Uuid& uuid, const QString& layerName, const Length& lineWidth,
                  bool fill, bool isGrabArea, const Path& path) noexcept :
-    mUuid(uuid), mLayerName(layerName), mLineWidth(lineWidth), mIsFilled(fill),
-    mIsGrabArea(isGrabArea), mPath(path)
+    mUuid(uuid), mLayerName(layerName), mLayerId(layerName), mLineWidth(lineWidth),
+    mIsFilled(fill), mIsGrabArea(isGrabArea), mPath(path)
 {
 }
 
@@ -60,6 +60,7 @@ Polygon::Polygon(const SExpression& node)
         mUuid = Uuid::createRandom();
     }
     mLayerName = node.getValueByPath<QString>("layer", true);
+    mLayerId = GraphicsLayerId(mLayerName);
     mLineWidth = node.getValueByPath<Length>("width", true);
     mIsFilled = node.getValueByPath<bool>("fill", true);
     mIsGrabArea = node.getValueByPath<bool>("grab", true);
@@ -91,6 +92,7 @@ void Polygon::setLayerName(const QString& name) noexcept
 {
     if (name == mLayerName) return;
     mLayerName = name;
+    mLayerId = GraphicsLayerId(name);
     foreach (IF_PolygonObserver* object, mObservers) {
         object->polygonLayerNameChanged(mLayerName);
     }
@@ -177,6 +179,7 @@ Polygon& Polygon::operator=(const Polygon& rhs) noexcept
 {
     mUuid = rhs.mUuid;
     mLayerName = rhs.mLayerName;
+    mLayerId = rhs.mLayerId;
     mLineWidth = rhs.mLineWidth;
     mIsFilled = rhs.mIsFilled;
     mIsGrabArea = rhs.mIsGrabArea;
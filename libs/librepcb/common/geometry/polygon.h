@@ -30,6 +30,7 @@
 #include "../fileio/cmd/cmdlistelementremove.h"
 #include "../fileio/cmd/cmdlistelementsswap.h"
 #include "../units/all_length_units.h"
+#include "../graphics/graphicslayerid.h"
 #include "path.h"
 
 /*****************************************************************************************
@@ -88,6 +89,7 @@ class Polygon final : public SerializableObject
         // Getters
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getLayerName() const noexcept {return mLayerName;}
+        const GraphicsLayerId& getLayerId() const noexcept {return mLayerId;}
         const Length& getLineWidth() const noexcept {return mLineWidth;}
         bool isFilled() const noexcept {return mIsFilled;}
         bool isGrabArea() const noexcept {return mIsGrabArea;}
@@ -119,7 +121,8 @@ class Polygon final : public SerializableObject
 
     private: // Data
         Uuid mUuid;
-        QString mLayerName;
+        QString mLayerName; ///< kept for serialization, even if it could not be interned
+        GraphicsLayerId mLayerId; ///< #mLayerName interned for fast comparisons
         Length mLineWidth;
         bool mIsFilled;
         bool mIsGrabArea;
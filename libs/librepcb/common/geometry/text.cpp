@@ -45,8 +45,8 @@ Text::Text(const Uuid& uuid, const Text& other) noexcept :
 
 Text::Text(const Uuid& uuid, const QString& layerName, const QString& text, const Point& pos, const Angle& rotation,
            const Length& height, const Alignment& align) noexcept :
-    mUuid(uuid), mLayerName(layerName), mText(text), mPosition(pos), mRotation(rotation),
-    mHeight(height), mAlign(align)
+    mUuid(uuid), mLayerName(layerName), mLayerId(layerName), mText(text), mPosition(pos),
+    mRotation(rotation), mHeight(height), mAlign(align)
 {
 }
 
@@ -61,6 +61,7 @@ Text::Text(const SExpression& node)
         mText = node.getChildByIndex(0).getValue<QString>(true);
     }
     mLayerName = node.getValueByPath<QString>("layer", true);
+    mLayerId = GraphicsLayerId(mLayerName);
 
     // load geometry attributes
     mPosition = Point(node.getChildByPath("pos"));
@@ -88,6 +89,7 @@ void Text::setLayerName(const QString& name) noexcept
 {
     if (name == mLayerName) return;
     mLayerName = name;
+    mLayerId = GraphicsLayerId(name);
     foreach (IF_TextObserver* object, mObservers) {
         object->textLayerNameChanged(mLayerName);
     }
@@ -185,6 +187,7 @@ Text& Text::operator=(const Text& rhs) noexcept
 {
     mUuid = rhs.mUuid;
     mLayerName = rhs.mLayerName;
+    mLayerId = rhs.mLayerId;
     mText = rhs.mText;
     mPosition = rhs.mPosition;
     mRotation = rhs.mRotation;
@@ -29,6 +29,7 @@
 #include "../fileio/cmd/cmdlistelementremove.h"
 #include "../fileio/cmd/cmdlistelementsswap.h"
 #include "../units/all_length_units.h"
+#include "../graphics/graphicslayerid.h"
 #include "../alignment.h"
 
 /*****************************************************************************************
@@ -89,6 +90,7 @@ class Text final : public SerializableObject
         // Getters
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getLayerName() const noexcept {return mLayerName;}
+        const GraphicsLayerId& getLayerId() const noexcept {return mLayerId;}
         const Point& getPosition() const noexcept {return mPosition;}
         const Angle& getRotation() const noexcept {return mRotation;}
         const Length& getHeight() const noexcept {return mHeight;}
@@ -122,7 +124,8 @@ class Text final : public SerializableObject
 
     private: // Data
         Uuid mUuid;
-        QString mLayerName;
+        QString mLayerName; ///< kept for serialization, even if it could not be interned
+        GraphicsLayerId mLayerId; ///< #mLayerName interned for fast comparisons
         QString mText;
         Point mPosition;
         Angle mRotation;
@@ -26,6 +26,7 @@
 #include <memory>
 #include <QtCore>
 #include <QtWidgets>
+#include "graphicslayerid.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -141,6 +142,7 @@ class GraphicsLayer : public QObject
 
         // Getters
         const QString& getName() const noexcept {return mName;}
+        const GraphicsLayerId& getId() const noexcept {return mId;}
         const QString& getNameTr() const noexcept {return mNameTr;}
         const QColor& getColor(bool highlighted = false) const noexcept {
             return highlighted ? mColorHighlighted : mColor;
@@ -191,6 +193,7 @@ class GraphicsLayer : public QObject
 
     protected: // Data
         QString mName;              ///< Unique name which is used for serialization
+        GraphicsLayerId mId;        ///< Interned #mName for fast comparisons at runtime
         QString mNameTr;            ///< Layer name (translated into the user's language)
         QColor mColor;              ///< Color of graphics items on that layer
         QColor mColorHighlighted;   ///< Color of hightlighted graphics items on that layer
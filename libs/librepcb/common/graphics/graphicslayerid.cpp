@@ -0,0 +1,140 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "graphicslayerid.h"
+#include "graphicslayer.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Layer Table
+ ****************************************************************************************/
+
+namespace {
+
+/**
+ * @brief Global table of all interned layer names
+ *
+ * The entries are stored in a fixed size array which is never reallocated, and an entry
+ * is completely initialized (incl. its mirror) before its ID is returned to the caller.
+ * So reading entries by ID does not need any locking, only interning new names does.
+ */
+struct LayerTable {
+    struct Entry {
+        QString name;
+        int mirrored;
+        bool copper;
+    };
+    static constexpr int sMaxCount = 1024; ///< much more than we will ever need
+    QMutex mutex;
+    QHash<QString, int> ids;
+    int count = 0;
+    Entry entries[sMaxCount];
+};
+
+LayerTable& layerTable() noexcept
+{
+    static LayerTable table; // thread-safe initialization
+    return table;
+}
+
+} // namespace
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+const QString& GraphicsLayerId::getName() const noexcept
+{
+    static const QString empty;
+    return isValid() ? layerTable().entries[mId].name : empty;
+}
+
+GraphicsLayerId GraphicsLayerId::getMirrored() const noexcept
+{
+    return isValid() ? GraphicsLayerId(layerTable().entries[mId].mirrored) : *this;
+}
+
+bool GraphicsLayerId::isCopperLayer() const noexcept
+{
+    return isValid() && layerTable().entries[mId].copper;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+GraphicsLayerId GraphicsLayerId::find(const QString& name) noexcept
+{
+    LayerTable& table = layerTable();
+    QMutexLocker locker(&table.mutex);
+    return GraphicsLayerId(table.ids.value(name, -1));
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+int GraphicsLayerId::intern(const QString& name) noexcept
+{
+    if (name.isEmpty()) {
+        return -1;
+    }
+
+    LayerTable& table = layerTable();
+    QMutexLocker locker(&table.mutex);
+    int id = table.ids.value(name, -1);
+    if (id >= 0) {
+        return id;
+    }
+
+    // add the layer and its mirrored layer at once to set up the mirror table
+    QString mirroredName = GraphicsLayer::getMirroredLayerName(name);
+    Q_ASSERT(!table.ids.contains(mirroredName)); // mirrored layers are added together
+    int count = (mirroredName != name) ? 2 : 1;
+    if (table.count + count > LayerTable::sMaxCount) {
+        qCritical() << "Too many different layer names, ignoring layer:" << name;
+        return -1;
+    }
+    id = table.count++;
+    table.entries[id] = {name, id, GraphicsLayer::isCopperLayer(name)};
+    table.ids.insert(name, id);
+    if (count == 2) {
+        int mirroredId = table.count++;
+        table.entries[mirroredId] = {mirroredName, id,
+                                     GraphicsLayer::isCopperLayer(mirroredName)};
+        table.ids.insert(mirroredName, mirroredId);
+        table.entries[id].mirrored = mirroredId;
+    }
+    return id;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
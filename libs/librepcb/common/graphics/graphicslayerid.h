@@ -0,0 +1,147 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GRAPHICSLAYERID_H
+#define LIBREPCB_GRAPHICSLAYERID_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class GraphicsLayerId
+ ****************************************************************************************/
+
+/**
+ * @brief The GraphicsLayerId class is an interned identifier of a graphics layer name
+ *
+ * Layer names (e.g. "top_cu") are still used for serialization, but comparing them as
+ * strings in hot code paths (painting, Gerber export, plane calculation, ...) is slow.
+ * Each distinct layer name gets a small integer assigned once (the first time it is
+ * used), so comparing, hashing and mirroring layer IDs are just integer operations.
+ * The name and the mirrored layer of each ID are stored in a global table, so
+ * #getName() and #getMirrored() are lock-free array lookups.
+ *
+ * A default constructed ID (and the ID of an empty name) is invalid.
+ *
+ * @note The IDs are only valid during runtime and must never be serialized!
+ */
+class GraphicsLayerId final
+{
+    public:
+
+        // Constructors / Destructor
+
+        /**
+         * @brief Default constructor (creates an invalid ID)
+         */
+        GraphicsLayerId() noexcept : mId(-1) {}
+
+        /**
+         * @brief Constructor which interns a layer name
+         *
+         * @param name      The layer name (an empty name leads to an invalid ID)
+         */
+        explicit GraphicsLayerId(const QString& name) noexcept : mId(intern(name)) {}
+
+        GraphicsLayerId(const GraphicsLayerId& other) noexcept : mId(other.mId) {}
+        ~GraphicsLayerId() noexcept {}
+
+        // Getters
+        bool isValid() const noexcept {return mId >= 0;}
+        int toInt() const noexcept {return mId;}
+
+        /**
+         * @brief Get the layer name of this ID
+         *
+         * @return The name (an empty string if the ID is invalid)
+         */
+        const QString& getName() const noexcept;
+
+        /**
+         * @brief Get the ID of the mirrored layer (top <-> bottom)
+         *
+         * @return The mirrored layer, or the same layer if it cannot be mirrored
+         */
+        GraphicsLayerId getMirrored() const noexcept;
+
+        /**
+         * @brief Check whether this is a copper layer (same as
+         *        librepcb::GraphicsLayer::isCopperLayer(), but precomputed)
+         */
+        bool isCopperLayer() const noexcept;
+
+        // Operator Overloadings
+        GraphicsLayerId& operator=(const GraphicsLayerId& rhs) noexcept {mId = rhs.mId; return *this;}
+        bool operator==(const GraphicsLayerId& rhs) const noexcept {return mId == rhs.mId;}
+        bool operator!=(const GraphicsLayerId& rhs) const noexcept {return mId != rhs.mId;}
+        bool operator<(const GraphicsLayerId& rhs) const noexcept {return mId < rhs.mId;}
+
+        // Static Methods
+
+        /**
+         * @brief Get the ID of an already interned layer name
+         *
+         * In contrast to the constructor, this does not intern unknown names, so looking
+         * up arbitrary strings does not grow the global table.
+         *
+         * @param name      The layer name
+         *
+         * @return The ID, or an invalid ID if the name was never interned
+         */
+        static GraphicsLayerId find(const QString& name) noexcept;
+
+
+    private: // Methods
+        explicit GraphicsLayerId(int id) noexcept : mId(id) {}
+        static int intern(const QString& name) noexcept;
+
+
+    private: // Data
+        int mId; ///< index in the global layer table, or -1 if invalid
+};
+
+/*****************************************************************************************
+ *  Non-Member Functions
+ ****************************************************************************************/
+
+inline uint qHash(const GraphicsLayerId& key, uint seed = 0) noexcept
+{
+    return ::qHash(key.toInt(), seed);
+}
+
+inline QDebug operator<<(QDebug stream, const GraphicsLayerId& id)
+{
+    stream << QString("GraphicsLayerId(%1)").arg(id.getName());
+    return stream;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_GRAPHICSLAYERID_H
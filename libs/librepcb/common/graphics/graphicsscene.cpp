@@ -75,6 +75,18 @@ void GraphicsScene::setSelectionRect(const Point& p1, const Point& p2) noexcept
     mSelectionRectItem->setRect(rectPx);
 }
 
+/*****************************************************************************************
+ *  Inherited from QGraphicsScene
+ ****************************************************************************************/
+
+void GraphicsScene::helpEvent(QGraphicsSceneHelpEvent* event)
+{
+    foreach (QGraphicsItem* item, items(event->scenePos())) {
+        sendEvent(item, event);
+    }
+    QGraphicsScene::helpEvent(event);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
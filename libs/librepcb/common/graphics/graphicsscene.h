@@ -56,6 +56,18 @@ class GraphicsScene final : public QGraphicsScene
         void setSelectionRect(const Point& p1, const Point& p2) noexcept;
 
 
+    protected:
+
+        /**
+         * @brief Show the tooltip of the item under the cursor
+         *
+         * Before the tooltip is determined, a help event is sent to all items at the
+         * cursor position. This allows items to generate their tooltip text on demand
+         * instead of updating it every time their state changes.
+         */
+        void helpEvent(QGraphicsSceneHelpEvent* event) override;
+
+
     private:
 
         QGraphicsRectItem* mSelectionRectItem;
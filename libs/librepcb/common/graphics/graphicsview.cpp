@@ -22,7 +22,6 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
-#include "QtOpenGL"
 #include "graphicsview.h"
 #include "graphicsscene.h"
 #include "if_graphicsvieweventhandler.h"
@@ -40,10 +39,11 @@ namespace librepcb {
 GraphicsView::GraphicsView(QWidget* parent, IF_GraphicsViewEventHandler* eventHandler) noexcept :
     QGraphicsView(parent), mEventHandlerObject(eventHandler), mScene(nullptr),
     mZoomAnimation(nullptr), mGridProperties(new GridProperties()), mOriginCrossVisible(true),
-    mUseOpenGl(false), mPanningActive(false)
+    mUseOpenGl(false), mRasterViewportUpdateMode(QGraphicsView::SmartViewportUpdate),
+    mPanningActive(false), mGridCacheIntervalPx(0)
 {
     setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-    setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    updateViewportSettings();
     setOptimizationFlags(QGraphicsView::DontSavePainterState);
     setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
@@ -78,18 +78,31 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept
 {
     if (useOpenGl != mUseOpenGl)
     {
-        if (useOpenGl)
-            setViewport(new QGLWidget(QGLFormat(QGL::DoubleBuffer | QGL::AlphaChannel | QGL::SampleBuffers)));
-        else
+        if (useOpenGl) {
+            QOpenGLWidget* widget = new QOpenGLWidget();
+            QSurfaceFormat format = widget->format();
+            format.setSamples(4); // antialiasing
+            widget->setFormat(format);
+            setViewport(widget);
+        } else {
             setViewport(nullptr);
+        }
         mUseOpenGl = useOpenGl;
+        updateViewportSettings();
     }
 }
 
+void GraphicsView::setRasterViewportUpdateMode(ViewportUpdateMode mode) noexcept
+{
+    mRasterViewportUpdateMode = mode;
+    updateViewportSettings();
+}
+
 void GraphicsView::setGridProperties(const GridProperties& properties) noexcept
 {
     *mGridProperties = properties;
-    setBackgroundBrush(backgroundBrush()); // this will repaint the background
+    mGridCache = QPixmap(); // force re-rendering the grid
+    setBackgroundBrush(backgroundBrush()); // this will repaint (and re-cache) the background
 }
 
 void GraphicsView::setScene(GraphicsScene* scene) noexcept
@@ -194,6 +207,73 @@ void GraphicsView::zoomAnimationValueChanged(const QVariant& value) noexcept
         fitInView(value.toRectF(), Qt::KeepAspectRatio); // zoom smoothly
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void GraphicsView::updateViewportSettings() noexcept
+{
+    if (mUseOpenGl) {
+        // QOpenGLWidget always repaints the whole viewport
+        setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+        setCacheMode(QGraphicsView::CacheNone);
+    } else {
+        setViewportUpdateMode(mRasterViewportUpdateMode);
+        setCacheMode(QGraphicsView::CacheBackground);
+    }
+    resetCachedContent();
+}
+
+void GraphicsView::updateGridCache(qreal intervalPx, const QSize& minSize) noexcept
+{
+    if ((!mGridCache.isNull()) && (intervalPx == mGridCacheIntervalPx) &&
+        (mGridCache.width() >= minSize.width()) && (mGridCache.height() >= minSize.height()))
+    {
+        return; // cache is still valid
+    }
+
+    // render at least one interval more than the viewport to allow blitting with offset
+    int margin = qCeil(intervalPx) + 1;
+    QSize size = minSize.expandedTo(viewport()->size() + QSize(margin, margin));
+    mGridCache = QPixmap(size);
+    mGridCache.fill(Qt::transparent);
+    mGridCacheIntervalPx = intervalPx;
+
+    QPainter painter(&mGridCache);
+    QPen gridPen(Qt::gray);
+    switch (mGridProperties->getType())
+    {
+        case GridProperties::Type_t::Lines:
+        {
+            QVector<QLineF> lines;
+            for (qreal x = 0; x < size.width(); x += intervalPx)
+                lines.append(QLineF(x, 0, x, size.height()));
+            for (qreal y = 0; y < size.height(); y += intervalPx)
+                lines.append(QLineF(0, y, size.width(), y));
+            gridPen.setWidth(1);
+            painter.setPen(gridPen);
+            painter.setOpacity(0.5);
+            painter.drawLines(lines);
+            break;
+        }
+
+        case GridProperties::Type_t::Dots:
+        {
+            QVector<QPointF> dots;
+            for (qreal x = 0; x < size.width(); x += intervalPx)
+                for (qreal y = 0; y < size.height(); y += intervalPx)
+                    dots.append(QPointF(x, y));
+            gridPen.setWidth(2);
+            painter.setPen(gridPen);
+            painter.drawPoints(dots);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
 /*****************************************************************************************
  *  Inherited from QGraphicsView
  ****************************************************************************************/
@@ -259,55 +339,37 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
 
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
 {
-    QPen gridPen(Qt::gray);
-    gridPen.setCosmetic(true);
-
     // draw background color
     painter->setPen(Qt::NoPen);
     painter->setBrush(backgroundBrush());
     painter->fillRect(rect, backgroundBrush());
 
-    // draw background grid lines
-    gridPen.setWidth((mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
-    painter->setPen(gridPen);
-    painter->setBrush(Qt::NoBrush);
-    qreal gridIntervalPixels = mGridProperties->getInterval().toPx();
-    qreal scaleFactor = width() / rect.width();
-    if (gridIntervalPixels * scaleFactor >= (qreal)5)
-    {
-        qreal left, right, top, bottom;
-        left = qFloor(rect.left() / gridIntervalPixels) * gridIntervalPixels;
-        right = rect.right();
-        top = rect.top();
-        bottom = qFloor(rect.bottom() / gridIntervalPixels) * gridIntervalPixels;
-        switch (mGridProperties->getType())
-        {
-            case GridProperties::Type_t::Lines:
-            {
-                QVarLengthArray<QLineF, 500> lines;
-                for (qreal x = left; x < right; x += gridIntervalPixels)
-                    lines.append(QLineF(x, rect.top(), x, rect.bottom()));
-                for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-                    lines.append(QLineF(rect.left(), y, rect.right(), y));
-                painter->setOpacity(0.5);
-                painter->drawLines(lines.data(), lines.size());
-                break;
-            }
-
-            case GridProperties::Type_t::Dots:
-            {
-                QVarLengthArray<QPointF, 2000> dots;
-                for (qreal x = left; x < right; x += gridIntervalPixels)
-                    for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-                        dots.append(QPointF(x, y));
-                painter->drawPoints(dots.data(), dots.size());
-                break;
-            }
-
-            default:
-                break;
-        }
-    }
+    // draw background grid
+    if (mGridProperties->getType() == GridProperties::Type_t::Off) return;
+    // note: don't use the size of "rect" here since it is only the area to update
+    QTransform transform = painter->worldTransform();
+    qreal intervalPx = mGridProperties->getInterval().toPx() * qAbs(transform.m11());
+    if (intervalPx < (qreal)5) return;
+
+    // The grid is pre-rendered in device pixels, starting at the pixmap's top left
+    // corner. To align it with the scene, blit it with an offset of less than one grid
+    // interval so that a grid line hits the (mapped) scene origin. Thus the pixmap only
+    // needs to be re-rendered if the grid properties, the zoom or the viewport size
+    // changes, but not while panning.
+    QPointF origin = transform.map(QPointF(0, 0));
+    qreal offsetX = std::fmod(origin.x(), intervalPx);
+    qreal offsetY = std::fmod(origin.y(), intervalPx);
+    if (offsetX < 0) offsetX += intervalPx;
+    if (offsetY < 0) offsetY += intervalPx;
+    QPoint offset(qRound(offsetX - intervalPx), qRound(offsetY - intervalPx));
+    QRect deviceRect = transform.mapRect(rect).toAlignedRect();
+    QRect sourceRect = deviceRect.translated(-offset);
+    updateGridCache(intervalPx, QSize(sourceRect.right() + 1, sourceRect.bottom() + 1));
+
+    painter->save();
+    painter->resetTransform();
+    painter->drawPixmap(deviceRect.topLeft(), mGridCache, sourceRect);
+    painter->restore();
 }
 
 void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
@@ -42,6 +42,19 @@ class GridProperties;
 
 /**
  * @brief The GraphicsView class
+ *
+ * By default, the view uses the raster paint engine with partial viewport updates
+ * (QGraphicsView::SmartViewportUpdate), i.e. a hover highlight or a moved item only
+ * repaints the affected area instead of the whole viewport. The background (incl. the
+ * grid) is cached in a pixmap (QGraphicsView::CacheBackground), so it is only rendered
+ * again after zooming or changing the grid properties. Scrolling just blits the cached
+ * background. The update mode can be changed with #setRasterViewportUpdateMode().
+ *
+ * Optionally, a QOpenGLWidget can be used as viewport (see #setUseOpenGl()). As
+ * QOpenGLWidget always repaints the whole viewport, the OpenGL mode always uses
+ * QGraphicsView::FullViewportUpdate without background cache. Since QOpenGLWidget
+ * works with Mesa's software renderer (e.g. with `LIBGL_ALWAYS_SOFTWARE=1`), this mode
+ * can also be used on headless machines.
  */
 class GraphicsView final : public QGraphicsView
 {
@@ -58,10 +71,21 @@ class GraphicsView final : public QGraphicsView
         GraphicsScene* getScene() const noexcept {return mScene;}
         QRectF getVisibleSceneRect() const noexcept;
         bool getUseOpenGl() const noexcept {return mUseOpenGl;}
+        ViewportUpdateMode getRasterViewportUpdateMode() const noexcept {
+            return mRasterViewportUpdateMode;
+        }
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
 
         // Setters
         void setUseOpenGl(bool useOpenGl) noexcept;
+
+        /**
+         * @brief Set the viewport update mode used if OpenGL is not used
+         *
+         * @param mode      The new update mode (e.g. QGraphicsView::FullViewportUpdate
+         *                  to get the old behaviour of repainting everything)
+         */
+        void setRasterViewportUpdateMode(ViewportUpdateMode mode) noexcept;
         void setGridProperties(const GridProperties& properties) noexcept;
         void setScene(GraphicsScene* scene) noexcept;
         void setVisibleSceneRect(const QRectF& rect) noexcept;
@@ -103,6 +127,10 @@ class GraphicsView final : public QGraphicsView
         GraphicsView(const GraphicsView& other) = delete;
         GraphicsView& operator=(const GraphicsView& rhs) = delete;
 
+        // Private Methods
+        void updateViewportSettings() noexcept;
+        void updateGridCache(qreal intervalPx, const QSize& minSize) noexcept;
+
         // Inherited Methods
         bool eventFilter(QObject* obj, QEvent* event);
         void drawBackground(QPainter* painter, const QRectF& rect);
@@ -116,9 +144,14 @@ class GraphicsView final : public QGraphicsView
         GridProperties* mGridProperties;
         bool mOriginCrossVisible;
         bool mUseOpenGl;
+        ViewportUpdateMode mRasterViewportUpdateMode;
         volatile bool mPanningActive;
         QCursor mCursorBeforePanning;
 
+        // Grid Cache
+        QPixmap mGridCache;             ///< pre-rendered grid in device pixels
+        qreal mGridCacheIntervalPx;     ///< grid interval [device px] of mGridCache
+
         // Static Variables
         static constexpr qreal sZoomStepFactor = 1.3;
 };
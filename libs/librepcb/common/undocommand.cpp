@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "undocommand.h"
+#include "fileio/serializableobject.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -33,7 +34,8 @@ namespace librepcb {
  ****************************************************************************************/
 
 UndoCommand::UndoCommand(const QString& text) noexcept :
-    mText(text), mIsExecuted(false), mRedoCount(0), mUndoCount(0)
+    mText(text), mIsExecuted(false), mRedoCount(0), mUndoCount(0),
+    mObjectsMemoryUsage(0)
 {
 }
 
@@ -42,6 +44,15 @@ UndoCommand::~UndoCommand() noexcept
     Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 UndoCommand::getMemoryUsage() const noexcept
+{
+    return sizeof(UndoCommand) + mText.capacity() * sizeof(QChar) + mObjectsMemoryUsage;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -79,6 +90,34 @@ void UndoCommand::redo()
     mRedoCount++;
 }
 
+bool UndoCommand::canMergeWith(const UndoCommand& other) const noexcept
+{
+    Q_UNUSED(other);
+    return false;
+}
+
+void UndoCommand::mergeWith(const UndoCommand& other) noexcept
+{
+    Q_UNUSED(other);
+    Q_ASSERT(false); // must only be called if canMergeWith() returned true
+}
+
+/*****************************************************************************************
+ *  Protected Methods
+ ****************************************************************************************/
+
+void UndoCommand::addMemoryUsageOfObject(const SerializableObject& obj) noexcept
+{
+    try {
+        // the serialized object contains all its data, so its size is a rough estimation
+        // of the memory needed to keep the object (including its child objects) alive
+        QString str = obj.serializeToDomElement("object").toString(0); // can throw
+        mObjectsMemoryUsage += str.size() * sizeof(QChar);
+    } catch (const Exception& e) {
+        qWarning() << "Could not estimate the memory usage of an object:" << e.getMsg();
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -31,6 +31,8 @@
  ****************************************************************************************/
 namespace librepcb {
 
+class SerializableObject;
+
 /*****************************************************************************************
  *  Class UndoCommand
  ****************************************************************************************/
@@ -81,6 +83,21 @@ class UndoCommand
          */
         bool isCurrentlyExecuted() const noexcept {return mRedoCount > mUndoCount;}
 
+        /**
+         * @brief Estimate the memory used by this command (including its child commands)
+         *
+         * This is used by librepcb::UndoStack to limit the memory of its history. The
+         * default implementation only accounts for this base class and the objects
+         * registered with #addMemoryUsageOfObject(), so derived classes which hold other
+         * large data (e.g. copies of paths) should override this method.
+         *
+         * @note The returned value must not change while the command is on the stack,
+         *       except when adding child commands or merging (see #mergeWith()).
+         *
+         * @return The estimated memory usage in bytes
+         */
+        virtual qint64 getMemoryUsage() const noexcept;
+
 
         // General Methods
 
@@ -102,12 +119,45 @@ class UndoCommand
          */
         virtual void redo() final;
 
+        /**
+         * @brief Check whether a newer command can be merged into this command
+         *
+         * This is called by librepcb::UndoStack when a command is executed directly after
+         * this one (similar to QUndoCommand#mergeWith()). If both commands modify the
+         * same object (e.g. while dragging it around), the newer command can be merged
+         * into this one, so undoing this command reverts both of them.
+         *
+         * @param other     The newer command (already executed)
+         *
+         * @return Whether #mergeWith() accepts `other` (false by default)
+         */
+        virtual bool canMergeWith(const UndoCommand& other) const noexcept;
+
+        /**
+         * @brief Take over the new state of a newer command
+         *
+         * @param other     The newer command, which must be accepted by #canMergeWith().
+         *                  It will be deleted afterwards (without undoing it).
+         */
+        virtual void mergeWith(const UndoCommand& other) noexcept;
+
         // Operator Overloadings
         UndoCommand& operator=(const UndoCommand& rhs) = delete;
 
 
     protected:
 
+        /**
+         * @brief Account for an object kept alive by this command in #getMemoryUsage()
+         *
+         * Commands which keep an object alive to be able to restore it (e.g. removed
+         * board items) should call this in #performExecute(). The memory usage of the
+         * object is estimated from the size of its serialization.
+         *
+         * @param obj       The object held by this command
+         */
+        void addMemoryUsageOfObject(const SerializableObject& obj) noexcept;
+
         /**
          * @brief Execute the command the first time
          *
@@ -141,6 +191,7 @@ class UndoCommand
         bool mIsExecuted;   ///< @brief Shows whether #execute() was called or not
         int mRedoCount;     ///< @brief Counter of how often #redo() was called
         int mUndoCount;     ///< @brief Counter of how often #undo() was called
+        qint64 mObjectsMemoryUsage; ///< @brief See #addMemoryUsageOfObject()
 };
 
 /*****************************************************************************************
@@ -20,6 +20,7 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <typeinfo>
 #include <QtCore>
 #include "undocommandgroup.h"
 #include "scopeguardlist.h"
@@ -34,7 +35,7 @@ namespace librepcb {
  ****************************************************************************************/
 
 UndoCommandGroup::UndoCommandGroup(const QString& text) noexcept :
-    UndoCommand(text)
+    UndoCommand(text), mChildsMemoryUsage(0)
 {
 }
 
@@ -46,6 +47,16 @@ UndoCommandGroup::~UndoCommandGroup() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 UndoCommandGroup::getMemoryUsage() const noexcept
+{
+    return UndoCommand::getMemoryUsage() + sizeof(UndoCommandGroup) - sizeof(UndoCommand)
+         + mChilds.count() * sizeof(UndoCommand*) + mChildsMemoryUsage;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -61,15 +72,40 @@ void UndoCommandGroup::appendChild(UndoCommand* cmd)
 
     if (wasEverExecuted()) {
         if (cmdScopeGuard->execute()) { // can throw
+            mChildsMemoryUsage += cmd->getMemoryUsage();
             mChilds.append(cmdScopeGuard.take());
         } else {
             cmdScopeGuard->undo(); // just to be sure the command has executed nothing...
         }
     } else {
+        mChildsMemoryUsage += cmd->getMemoryUsage();
         mChilds.append(cmdScopeGuard.take());
     }
 }
 
+bool UndoCommandGroup::canMergeWith(const UndoCommand& other) const noexcept
+{
+    const UndoCommandGroup* group = dynamic_cast<const UndoCommandGroup*>(&other);
+    if ((!group) || (typeid(*group) != typeid(*this))) return false;
+    if (group->getText() != getText()) return false;
+    if (mChilds.isEmpty() || (group->mChilds.count() != mChilds.count())) return false;
+    for (int i = 0; i < mChilds.count(); ++i) {
+        if (!mChilds.at(i)->canMergeWith(*group->mChilds.at(i))) return false;
+    }
+    return true;
+}
+
+void UndoCommandGroup::mergeWith(const UndoCommand& other) noexcept
+{
+    Q_ASSERT(canMergeWith(other));
+    const UndoCommandGroup& group = static_cast<const UndoCommandGroup&>(other);
+    mChildsMemoryUsage = 0;
+    for (int i = 0; i < mChilds.count(); ++i) {
+        mChilds.at(i)->mergeWith(*group.mChilds.at(i));
+        mChildsMemoryUsage += mChilds.at(i)->getMemoryUsage();
+    }
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -83,6 +119,12 @@ bool UndoCommandGroup::performExecute()
         sgl.add([cmd](){cmd->undo();});
     }
     sgl.dismiss();
+
+    // the memory usage of the childs may have changed by executing them
+    mChildsMemoryUsage = 0;
+    foreach (const UndoCommand* cmd, mChilds) {
+        mChildsMemoryUsage += cmd->getMemoryUsage();
+    }
     return (mChilds.count() > 0);
 }
 
@@ -121,6 +163,7 @@ void UndoCommandGroup::execNewChildCmd(UndoCommand* cmd)
     }
 
     if (cmdScopeGuard->execute()) { // can throw
+        mChildsMemoryUsage += cmd->getMemoryUsage();
         mChilds.append(cmdScopeGuard.take());
     } else {
         cmdScopeGuard->undo(); // just to be sure the command has executed nothing...
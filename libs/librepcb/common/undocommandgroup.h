@@ -57,6 +57,9 @@ class UndoCommandGroup : public UndoCommand
         // Getters
         int getChildCount() const noexcept {return mChilds.count();}
 
+        /// @copydoc UndoCommand::getMemoryUsage()
+        qint64 getMemoryUsage() const noexcept override;
+
         // General Methods
 
         /**
@@ -72,6 +75,18 @@ class UndoCommandGroup : public UndoCommand
          */
         void appendChild(UndoCommand* cmd);
 
+        /**
+         * @copydoc UndoCommand::canMergeWith()
+         *
+         * Groups of the same type can be merged if every child command can be merged
+         * with the corresponding child of the other group, i.e. if both groups modify
+         * the same objects (e.g. consecutive moves of the same netpoints).
+         */
+        bool canMergeWith(const UndoCommand& other) const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        void mergeWith(const UndoCommand& other) noexcept override;
+
         // Operator Overloadings
         UndoCommandGroup& operator=(const UndoCommandGroup& rhs) = delete;
 
@@ -104,6 +119,13 @@ class UndoCommandGroup : public UndoCommand
          * is at the top of the list.
          */
         QList<UndoCommand*> mChilds;
+
+        /**
+         * @brief Sum of UndoCommand#getMemoryUsage() of all #mChilds
+         *
+         * Updated when adding childs to avoid iterating over them for every new child.
+         */
+        qint64 mChildsMemoryUsage;
 };
 
 /*****************************************************************************************
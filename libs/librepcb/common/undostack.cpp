@@ -75,7 +75,8 @@ void UndoStackTransaction::commit()
  ****************************************************************************************/
 
 UndoStack::UndoStack() noexcept :
-    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr)
+    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr),
+    mUndoLimit(0), mMemoryLimit(256 * 1024 * 1024), mMemoryUsage(0)
 {
 }
 
@@ -137,6 +138,18 @@ void UndoStack::setClean() noexcept
     emit cleanChanged(true);
 }
 
+void UndoStack::setUndoLimit(int limit) noexcept
+{
+    mUndoLimit = qMax(limit, 0);
+    applyLimits();
+}
+
+void UndoStack::setMemoryLimit(qint64 limit) noexcept
+{
+    mMemoryLimit = qMax(limit, qint64(0));
+    applyLimits();
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -153,7 +166,17 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd)
 
     bool commandHasDoneSomething = cmd->execute(); // can throw
 
-    if (commandHasDoneSomething || forceKeepCmd) {
+    UndoCommand* topCmd = canUndo() ? mCommands[mCurrentIndex-1] : nullptr;
+    if (commandHasDoneSomething && (!forceKeepCmd) && (topCmd) && (!canRedo()) &&
+        (mCleanIndex != mCurrentIndex) && (topCmd->canMergeWith(*cmd))) {
+        // the top command takes over the changes, so the new command is obsolete
+        qint64 topCmdMemoryUsage = topCmd->getMemoryUsage();
+        topCmd->mergeWith(*cmd);
+        mMemoryUsage += topCmd->getMemoryUsage() - topCmdMemoryUsage;
+
+        // emit signals
+        emit stateModified();
+    } else if (commandHasDoneSomething || forceKeepCmd) {
         // the clean state will no longer exist -> make the index invalid
         if (mCleanIndex > mCurrentIndex) {
             mCleanIndex = -1;
@@ -162,13 +185,16 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd)
         // delete all commands above the current index (make redoing them impossible)
         // --> in reverse order (from top to bottom)!
         while (mCurrentIndex < mCommands.count()) {
+            mMemoryUsage -= mCommands.last()->getMemoryUsage();
             delete mCommands.takeLast();
         }
         Q_ASSERT(mCurrentIndex == mCommands.count());
 
         // add command to the command stack
+        mMemoryUsage += cmd->getMemoryUsage();
         mCommands.append(cmdScopeGuard.take()); // move ownership of "cmd" to "mCommands"
         mCurrentIndex++;
+        applyLimits();
 
         // emit signals
         emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
@@ -212,7 +238,9 @@ void UndoStack::appendToCmdGroup(UndoCommand* cmd)
 
     // append new command as a child of active command group
     // note: this will also execute the new command!
+    qint64 groupMemoryUsage = mActiveCommandGroup->getMemoryUsage();
     mActiveCommandGroup->appendChild(cmdScopeGuard.take()); // can throw
+    mMemoryUsage += mActiveCommandGroup->getMemoryUsage() - groupMemoryUsage;
 
     // emit signals
     emit stateModified();
@@ -235,6 +263,7 @@ void UndoStack::commitCmdGroup()
     // To finish the active command group, we only need to reset the pointer to the
     // currently active command group
     mActiveCommandGroup = nullptr;
+    applyLimits();
 
     // emit signals
     emit canUndoChanged(canUndo());
@@ -254,6 +283,7 @@ void UndoStack::abortCmdGroup()
         mActiveCommandGroup->undo(); // can throw (but should usually not)
         mActiveCommandGroup = nullptr;
         mCurrentIndex--;
+        mMemoryUsage -= mCommands.last()->getMemoryUsage();
         delete mCommands.takeLast(); // delete and remove the aborted command group from the stack
     } catch (Exception& e) {
         qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
@@ -338,6 +368,7 @@ void UndoStack::clear() noexcept
     mCurrentIndex = 0;
     mCleanIndex = 0;
     mActiveCommandGroup = nullptr;
+    mMemoryUsage = 0;
 
     // emit signals
     emit undoTextChanged(tr("Undo"));
@@ -347,6 +378,32 @@ void UndoStack::clear() noexcept
     emit cleanChanged(true);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void UndoStack::applyLimits() noexcept
+{
+    // never delete the newest command and never touch the active command group
+    while ((mCommands.count() > 1) && (mCurrentIndex > 1) &&
+           (mCommands.first() != mActiveCommandGroup) &&
+           (((mUndoLimit > 0) && (mCommands.count() > mUndoLimit)) ||
+            ((mMemoryLimit > 0) && (mMemoryUsage > mMemoryLimit))))
+    {
+        // delete the oldest command (bottom of the stack)
+        mMemoryUsage -= mCommands.first()->getMemoryUsage();
+        delete mCommands.takeFirst();
+        mCurrentIndex--;
+
+        // the clean state is either moved down or no longer reachable
+        if (mCleanIndex > 0) {
+            mCleanIndex--;
+        } else {
+            mCleanIndex = -1;
+        }
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
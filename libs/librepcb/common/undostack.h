@@ -101,6 +101,10 @@ class UndoStackTransaction final
  *  - <b>Added support for exclusive macro command creation:</b> @todo Don't sure if this
  *    is a good way, we need some tests first... If the tests are successful, we should
  *    complete this documentation (explain how this feature works).
+ *  - <b>Memory limit:</b> In addition to a maximum count of commands (like
+ *    QUndoStack#setUndoLimit()), the history can be limited by the estimated memory
+ *    usage of the commands (see UndoCommand#getMemoryUsage()). If a limit is exceeded,
+ *    the oldest commands are deleted.
  *
  * @see #UndoCommand, #UndoCommandGroup
  *
@@ -122,6 +126,9 @@ class UndoStack final : public QObject
 
         /**
          * @brief The default constructor
+         *
+         * The count of commands is unlimited by default, but the memory usage is limited
+         * to 256MB (see #setUndoLimit() and #setMemoryLimit()).
          */
         UndoStack() noexcept;
 
@@ -174,6 +181,23 @@ class UndoStack final : public QObject
          */
         bool isCommandGroupActive() const noexcept;
 
+        /**
+         * @brief Get the maximum count of commands on the stack (0 means unlimited)
+         */
+        int getUndoLimit() const noexcept {return mUndoLimit;}
+
+        /**
+         * @brief Get the maximum memory usage of the stack in bytes (0 means unlimited)
+         */
+        qint64 getMemoryLimit() const noexcept {return mMemoryLimit;}
+
+        /**
+         * @brief Get the estimated memory usage of all commands on the stack
+         *
+         * @return The sum of UndoCommand#getMemoryUsage() of all commands in bytes
+         */
+        qint64 getMemoryUsage() const noexcept {return mMemoryUsage;}
+
 
         // Setters
 
@@ -182,6 +206,28 @@ class UndoStack final : public QObject
          */
         void setClean() noexcept;
 
+        /**
+         * @brief Set the maximum count of commands on the stack
+         *
+         * If the stack contains more commands, the oldest ones are deleted. If the clean
+         * state was before the deleted commands, it becomes unreachable (#isClean() will
+         * not return true anymore until the next #setClean()).
+         *
+         * @param limit     Maximum count of commands (0 means unlimited)
+         */
+        void setUndoLimit(int limit) noexcept;
+
+        /**
+         * @brief Set the maximum estimated memory usage of the stack
+         *
+         * Works the same way as #setUndoLimit(), but limits #getMemoryUsage() instead of
+         * the count of commands. The newest command is always kept, even if it alone
+         * exceeds the limit.
+         *
+         * @param limit     Maximum memory usage in bytes (0 means unlimited)
+         */
+        void setMemoryLimit(qint64 limit) noexcept;
+
 
         // General Methods
 
@@ -196,6 +242,11 @@ class UndoStack final : public QObject
          *                  UndoCommand object after passing it to this method.
          * @param forceKeepCmd  Only for internal use!
          *
+         * @note If the command on top of the stack accepts to merge the new command (see
+         *       UndoCommand#canMergeWith()), the new command is deleted instead of
+         *       being pushed.
+         *       Commands are never merged across the clean state.
+         *
          * @throw Exception If the command is not executed successfully, this method
          *                  throws an exception and tries to keep the state of the stack
          *                  consistend (as the passed command did never exist).
@@ -292,6 +343,11 @@ class UndoStack final : public QObject
 
     private:
 
+        /**
+         * @brief Delete the oldest commands until #mUndoLimit and #mMemoryLimit are met
+         */
+        void applyLimits() noexcept;
+
         /**
          * @brief This list holds all commands of the undo stack
          *
@@ -321,6 +377,10 @@ class UndoStack final : public QObject
          * or #abortCmdGroup(). Otherwise, the variable contains the nullptr.
          */
         UndoCommandGroup* mActiveCommandGroup;
+
+        int mUndoLimit;         ///< @brief See #setUndoLimit()
+        qint64 mMemoryLimit;    ///< @brief See #setMemoryLimit()
+        qint64 mMemoryUsage;    ///< @brief See #getMemoryUsage()
 };
 
 /*****************************************************************************************
@@ -29,65 +29,66 @@
 namespace librepcb {
 
 /*****************************************************************************************
- *  Setters
+ *  Getters
  ****************************************************************************************/
 
-bool Uuid::setUuid(const QString& uuid) noexcept
+QString Uuid::toStr() const noexcept
 {
-    mUuid = QString(); // make UUID invalid
-    QString lowercaseUuid = uuid.toLower();
-    if (lowercaseUuid.length() != 36)       return false; // do NOT accept '{' and '}'
-    QUuid quuid(lowercaseUuid);
-    if (quuid.isNull())                     return false;
-    if (quuid.variant() != QUuid::DCE)      return false;
-    if (quuid.version() != QUuid::Random)   return false;
-    mUuid = lowercaseUuid;
-    return true;
+    if (isNull()) return QString();
+
+    static const char hexDigits[] = "0123456789abcdef";
+    QString str(36, Qt::Uninitialized);
+    QChar* out = str.data();
+    for (int i = 0; i < 32; ++i) {
+        if ((i == 8) || (i == 12) || (i == 16) || (i == 20)) {
+            *out++ = QLatin1Char('-');
+        }
+        quint64 word = (i < 16) ? mHigh : mLow;
+        int shift = (15 - (i % 16)) * 4;
+        *out++ = QLatin1Char(hexDigits[(word >> shift) & 0xF]);
+    }
+    return str;
 }
 
 /*****************************************************************************************
- *  Operators
+ *  Setters
  ****************************************************************************************/
 
-Uuid& Uuid::operator=(const Uuid& rhs) noexcept
-{
-    mUuid = rhs.mUuid;
-    return *this;
-}
-
-bool Uuid::operator==(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid == rhs.mUuid);
-}
-
-bool Uuid::operator!=(const Uuid& rhs) const noexcept
-{
-    return !(*this == rhs);
-}
-
-bool Uuid::operator<(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid < rhs.mUuid);
-}
-
-bool Uuid::operator>(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid > rhs.mUuid);
-}
-
-bool Uuid::operator<=(const Uuid& rhs) const noexcept
+bool Uuid::setUuid(const QString& uuid) noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid <= rhs.mUuid);
-}
+    mHigh = mLow = 0; // make UUID invalid
+    if (uuid.length() != 36) return false; // do NOT accept '{' and '}'
+
+    quint64 words[2] = {0, 0};
+    int digit = 0;
+    for (int i = 0; i < 36; ++i) {
+        ushort c = uuid.at(i).unicode();
+        if ((i == 8) || (i == 13) || (i == 18) || (i == 23)) {
+            if (c != '-') return false;
+            continue;
+        }
+        quint64 value;
+        if ((c >= '0') && (c <= '9')) {
+            value = c - '0';
+        } else if ((c >= 'a') && (c <= 'f')) {
+            value = c - 'a' + 10;
+        } else if ((c >= 'A') && (c <= 'F')) {
+            value = c - 'A' + 10;
+        } else {
+            return false;
+        }
+        words[digit / 16] = (words[digit / 16] << 4) | value;
+        ++digit;
+    }
+    Q_ASSERT(digit == 32);
 
-bool Uuid::operator>=(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid >= rhs.mUuid);
+    mHigh = words[0];
+    mLow = words[1];
+    if (!isValidVersion4()) {
+        mHigh = mLow = 0;
+        return false;
+    }
+    return true;
 }
 
 /*****************************************************************************************
@@ -96,13 +97,30 @@ bool Uuid::operator>=(const Uuid& rhs) const noexcept
 
 Uuid Uuid::createRandom() noexcept
 {
-    Uuid uuid(QUuid::createUuid().toString().remove("{").remove("}"));
-    if (uuid.isNull()) {
+    QUuid quuid = QUuid::createUuid();
+    Uuid uuid;
+    uuid.mHigh = (quint64(quuid.data1) << 32) | (quint64(quuid.data2) << 16) | quuid.data3;
+    for (int i = 0; i < 8; ++i) {
+        uuid.mLow = (uuid.mLow << 8) | quuid.data4[i];
+    }
+    if (!uuid.isValidVersion4()) {
         qCritical() << "Could not generate a valid random UUID!";
+        return Uuid();
     }
     return uuid;
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool Uuid::isValidVersion4() const noexcept
+{
+    bool isDce = ((mLow >> 62) == 0x2);             // variant bits "10"
+    bool isRandom = (((mHigh >> 12) & 0xF) == 0x4); // version 4
+    return isDce && isRandom;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
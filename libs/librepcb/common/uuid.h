@@ -44,6 +44,10 @@ namespace librepcb {
  *
  * A valid UUID looks like this: "d79d354b-62bd-4866-996a-78941c575e78"
  *
+ * Since UUIDs are used as keys in many containers, the 128 bits are stored as two
+ * integers instead of a string. This makes copying, comparing and hashing very cheap.
+ * The string representation is only created on demand (#toStr()).
+ *
  * @see https://de.wikipedia.org/wiki/Universally_Unique_Identifier
  * @see https://tools.ietf.org/html/rfc4122
  *
@@ -61,21 +65,21 @@ class Uuid final
         /**
          * @brief Default constructor (creates a NULL #Uuid object)
          */
-        Uuid() noexcept : mUuid() {}
+        Uuid() noexcept : mHigh(0), mLow(0) {}
 
         /**
          * @brief Constructor which creates a #Uuid object from a string
          *
          * @param uuid      The uuid as a string (without braces)
          */
-        explicit Uuid(const QString& uuid) noexcept : mUuid() {setUuid(uuid);}
+        explicit Uuid(const QString& uuid) noexcept : mHigh(0), mLow(0) {setUuid(uuid);}
 
         /**
          * @brief Copy constructor
          *
          * @param other     Another #Uuid object
          */
-        Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+        Uuid(const Uuid& other) noexcept = default;
 
         /**
          * @brief Destructor
@@ -90,14 +94,14 @@ class Uuid final
          *
          * @return true if NULL/invalid UUID, false if valid UUID
          */
-        bool isNull() const noexcept {return mUuid.isEmpty();}
+        bool isNull() const noexcept {return (mHigh == 0) && (mLow == 0);}
 
         /**
          * @brief Get the UUID as a string (without braces)
          *
          * @return The UUID as a string
          */
-        QString toStr() const noexcept {return mUuid;}
+        QString toStr() const noexcept;
 
         /**
          * @brief Serialize this object into a string
@@ -125,18 +129,30 @@ class Uuid final
         /**
          * @brief Operator overloadings
          *
+         * The comparison operators are equivalent to comparing the strings of #toStr().
+         *
          * @param rhs   The other object to compare
          *
          * @return  If at least one of both objects is invalid, false will be returned
          *          (except #operator!=() which would return true in this case)!
          */
-        Uuid& operator=(const Uuid& rhs) noexcept;
-        bool operator==(const Uuid& rhs) const noexcept;
-        bool operator!=(const Uuid& rhs) const noexcept;
-        bool operator<(const Uuid& rhs) const noexcept;
-        bool operator>(const Uuid& rhs) const noexcept;
-        bool operator<=(const Uuid& rhs) const noexcept;
-        bool operator>=(const Uuid& rhs) const noexcept;
+        Uuid& operator=(const Uuid& rhs) noexcept = default;
+        bool operator==(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (mHigh == rhs.mHigh) && (mLow == rhs.mLow);
+        }
+        bool operator!=(const Uuid& rhs) const noexcept {return !(*this == rhs);}
+        bool operator<(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) && (compare(rhs) < 0);
+        }
+        bool operator>(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) && (compare(rhs) > 0);
+        }
+        bool operator<=(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) && (compare(rhs) <= 0);
+        }
+        bool operator>=(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) && (compare(rhs) >= 0);
+        }
         //@}
 
 
@@ -170,17 +186,29 @@ class Uuid final
 
     private:
 
+        // Private Methods
+        int compare(const Uuid& rhs) const noexcept {
+            if (mHigh != rhs.mHigh) return (mHigh < rhs.mHigh) ? -1 : 1;
+            if (mLow != rhs.mLow)   return (mLow < rhs.mLow) ? -1 : 1;
+            return 0;
+        }
+        bool isValidVersion4() const noexcept;
+
         // Private Attributes
-        QString mUuid;
+        quint64 mHigh;  ///< first 8 bytes of the UUID in big endian (0 if NULL)
+        quint64 mLow;   ///< last 8 bytes of the UUID in big endian (0 if NULL)
+
+        friend uint qHash(const Uuid& key, uint seed) noexcept;
 };
 
 /*****************************************************************************************
  *  Non-Member Functions
  ****************************************************************************************/
 
-inline uint qHash(const Uuid& key, uint seed)
+inline uint qHash(const Uuid& key, uint seed) noexcept
 {
-    return qHash(key.toStr(), seed);
+    // the bits of version 4 UUIDs are random anyway, so no need to mix them much
+    return qHash(key.mHigh ^ key.mLow, seed);
 }
 
 inline QDataStream& operator<<(QDataStream& stream, const Uuid& uuid)
@@ -201,4 +229,6 @@ inline QDebug operator<<(QDebug stream, const Uuid& uuid)
 
 } // namespace librepcb
 
+Q_DECLARE_TYPEINFO(librepcb::Uuid, Q_MOVABLE_TYPE);
+
 #endif // LIBREPCB_UUID_H
@@ -21,6 +21,8 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtSql>
+#include <librepcb/common/sqlitedatabase.h>
 #include "converterdb.h"
 
 /*****************************************************************************************
@@ -33,13 +35,53 @@ namespace eagleimport {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-ConverterDb::ConverterDb(const FilePath& ini) noexcept :
-    mIniFile(ini.toStr(), QSettings::IniFormat)
+ConverterDb::ConverterDb(const FilePath& db) :
+    mRoot(this), mDb(new SQLiteDatabase(db)) // can throw
+{
+    mDb->exec("CREATE TABLE IF NOT EXISTS uuids ("
+              "`key` TEXT PRIMARY KEY NOT NULL, "
+              "`uuid` TEXT NOT NULL"
+              ")"); // can throw
+
+    // load all mappings at once, the lookups during the conversion are done in memory
+    QSqlQuery query = mDb->prepareQuery("SELECT key, uuid FROM uuids"); // can throw
+    mDb->exec(query); // can throw
+    while (query.next()) {
+        QString key = query.value(0).toString();
+        Uuid uuid(query.value(1).toString());
+        if (uuid.isNull()) {
+            throw RuntimeError(__FILE__, __LINE__, "Invalid UUID in database: " % key);
+        }
+        mUuids.insert(key, uuid);
+    }
+}
+
+ConverterDb::ConverterDb(ConverterDb& db, const FilePath& libFilePath) noexcept :
+    mRoot(db.mRoot), mLibFilePath(libFilePath)
 {
 }
 
 ConverterDb::~ConverterDb() noexcept
 {
+    if (mRoot != this) {
+        return; // views have nothing to write
+    }
+
+    try {
+        flush(); // can throw
+    } catch (const Exception& e) {
+        qCritical() << "Could not write the converter database:" << e.getMsg();
+    }
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QStringList ConverterDb::getAllKeys() const noexcept
+{
+    QMutexLocker locker(&mRoot->mMutex);
+    return mRoot->mUuids.keys();
 }
 
 /*****************************************************************************************
@@ -99,34 +141,104 @@ Uuid ConverterDb::getDeviceUuid(const QString& deviceSetName, const QString& dev
     return getOrCreateUuid("devices_to_devices", deviceSetName, deviceName);
 }
 
+int ConverterDb::importIniFile(const FilePath& ini)
+{
+    if (mRoot != this) {
+        return mRoot->importIniFile(ini); // can throw
+    }
+
+    if (!ini.isExistingFile()) {
+        throw RuntimeError(__FILE__, __LINE__, "File not found: " % ini.toNative());
+    }
+
+    // read and check all entries before adding any of them
+    QSettings settings(ini.toStr(), QSettings::IniFormat);
+    QMutexLocker locker(&mMutex);
+    QHash<QString, Uuid> entries;
+    foreach (const QString& key, settings.allKeys()) {
+        Uuid uuid(settings.value(key).toString());
+        if (uuid.isNull()) {
+            throw RuntimeError(__FILE__, __LINE__, "Invalid UUID in *.ini file: " % key);
+        }
+        if (!mUuids.contains(key)) {
+            entries.insert(key, uuid);
+        }
+    }
+
+    mUuids.unite(entries);
+    mNewUuids.unite(entries);
+    locker.unlock();
+    flush(); // can throw
+    return entries.count();
+}
+
+void ConverterDb::flush()
+{
+    if (mRoot != this) {
+        mRoot->flush(); // can throw
+        return;
+    }
+
+    // views in other threads might add new mappings in the meantime
+    QMutexLocker locker(&mMutex);
+    if (mNewUuids.isEmpty()) {
+        return;
+    }
+
+    SQLiteDatabase::TransactionScopeGuard transactionGuard(*mDb); // can throw
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT OR REPLACE INTO uuids (key, uuid) VALUES (:key, :uuid)"); // can throw
+    for (auto it = mNewUuids.constBegin(); it != mNewUuids.constEnd(); ++it) {
+        query.bindValue(":key", it.key());
+        query.bindValue(":uuid", it.value().toStr());
+        mDb->exec(query); // can throw
+    }
+    transactionGuard.commit(); // can throw
+    mNewUuids.clear();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+QString ConverterDb::getKey(const QString& cat, const QString& key1,
+                           const QString& key2) const noexcept
+{
+    // Same escaping as used for the keys of the former INI file, so imported mappings
+    // are found again. Done in a single pass since it's called for every lookup.
+    QString raw = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
+    QString key;
+    key.reserve(cat.length() + 1 + raw.length() * 2);
+    key.append(cat).append('/');
+    foreach (const QChar& c, raw) {
+        ushort u = c.unicode();
+        if ((u == '{') || (u == '}')) {
+            continue;
+        } else if (u == ' ') {
+            key.append('_');
+        } else if (((u >= '0') && (u <= '9')) || ((u >= 'A') && (u <= 'Z')) ||
+                   ((u >= 'a') && (u <= 'z')) || (u == '_') || (u == '-') || (u == '.')) {
+            key.append(c);
+        } else {
+            key += "__U" % QString::number(u, 16).toUpper() % "__";
+        }
+    }
+    return key;
+}
+
 Uuid ConverterDb::getOrCreateUuid(const QString& cat, const QString& key1,
                                   const QString& key2)
 {
-    QString allowedChars("_-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
-
-    QString settingsKey = mLibFilePath.getFilename() % '_' % key1 % '_' % key2;
-    settingsKey.replace("{", "");
-    settingsKey.replace("}", "");
-    settingsKey.replace(" ", "_");
-    for (int i=0; i<settingsKey.length(); i++)
-    {
-        if (!allowedChars.contains(settingsKey[i]))
-            settingsKey.replace(i, 1, QString("__U%1__").arg(QString::number(settingsKey[i].unicode(), 16).toUpper()));
+    QString key = getKey(cat, key1, key2);
+    QMutexLocker locker(&mRoot->mMutex);
+    QHash<QString, Uuid>::const_iterator it = mRoot->mUuids.constFind(key);
+    if (it != mRoot->mUuids.constEnd()) {
+        return it.value();
     }
-    settingsKey.prepend(cat % '/');
 
     Uuid uuid = Uuid::createRandom();
-    QString value = mIniFile.value(settingsKey).toString();
-    if (!value.isEmpty()) uuid = Uuid(value); //Uuid(QString("{%1}").arg(value));
-
-    if (uuid.isNull()) {
-        throw RuntimeError(__FILE__, __LINE__, "Invalid UUID in *.ini file: " % settingsKey);
-    }
-    mIniFile.setValue(settingsKey, uuid.toStr());
+    mRoot->mUuids.insert(key, uuid);
+    mRoot->mNewUuids.insert(key, uuid);
     return uuid;
 }
 
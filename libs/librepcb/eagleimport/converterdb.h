@@ -33,6 +33,7 @@
 namespace librepcb {
 
 class FilePath;
+class SQLiteDatabase;
 
 namespace eagleimport {
 
@@ -41,7 +42,19 @@ namespace eagleimport {
  ****************************************************************************************/
 
 /**
- * @brief The ConverterDb class
+ * @brief The ConverterDb class maps Eagle element names to LibrePCB UUIDs
+ *
+ * The mapping is stored in an SQLite database, but it is kept in memory during the
+ * conversion: All entries are loaded when the database is opened and the UUIDs created
+ * since then are written back within a single transaction by #flush() (which is also
+ * called by the destructor). Mappings stored in the former INI file format can be
+ * imported with #importIniFile().
+ *
+ * To convert several libraries in parallel, each worker thread creates its own view of
+ * the database with #ConverterDb(ConverterDb&, const FilePath&). Views have their own
+ * current library file path but share (and synchronize) the mappings of the database
+ * they were created from. As the SQLite connection belongs to the thread which opened
+ * the database, #importIniFile() and #flush() must only be called from that thread.
  */
 class ConverterDb final
 {
@@ -50,9 +63,33 @@ class ConverterDb final
         // Constructors / Destructor
         ConverterDb() = delete;
         ConverterDb(const ConverterDb& other) = delete;
-        ConverterDb(const FilePath& ini) noexcept;
+
+        /**
+         * @brief Open (or create) a converter database
+         *
+         * @param db    The SQLite database file
+         *
+         * @throw Exception If the database could not be opened or read.
+         */
+        explicit ConverterDb(const FilePath& db);
+
+        /**
+         * @brief Create a view of a database for converting a single library
+         *
+         * @param db            The database to share the mappings with (must outlive
+         *                      the view)
+         * @param libFilePath   The current library file path of the view
+         */
+        ConverterDb(ConverterDb& db, const FilePath& libFilePath) noexcept;
         ~ConverterDb() noexcept;
 
+        // Getters
+
+        /**
+         * @brief Get the keys of all mappings, in the same format as the INI file keys
+         */
+        QStringList getAllKeys() const noexcept;
+
         // General Methods
         void setCurrentLibraryFilePath(const FilePath& fp) noexcept {mLibFilePath = fp;}
         const FilePath& getCurrentLibraryFilePath() const noexcept {return mLibFilePath;}
@@ -68,16 +105,40 @@ class ConverterDb final
         Uuid getSymbolVariantItemUuid(const Uuid& componentUuid, const QString& gateName);
         Uuid getDeviceUuid(const QString& deviceSetName, const QString& deviceName);
 
+        /**
+         * @brief Import the mappings of an INI file as written by former versions
+         *
+         * Keys which already exist in the database are left untouched.
+         *
+         * @param ini   The INI file to import
+         *
+         * @return The number of imported mappings
+         *
+         * @throw Exception If the file does not exist or contains invalid UUIDs.
+         */
+        int importIniFile(const FilePath& ini);
+
+        /**
+         * @brief Write all new mappings to the database, within a single transaction
+         *
+         * @throw Exception If the database could not be written.
+         */
+        void flush();
 
         // Operator Overloadings
         ConverterDb& operator=(const ConverterDb& rhs) = delete;
 
 
     private:
+        QString getKey(const QString& cat, const QString& key1, const QString& key2) const noexcept;
         Uuid getOrCreateUuid(const QString& cat, const QString& key1,
                              const QString& key2 = QString());
 
-        QSettings mIniFile;
+        ConverterDb* mRoot; ///< the database holding the mappings (this if not a view)
+        QScopedPointer<SQLiteDatabase> mDb; ///< nullptr for views
+        mutable QMutex mMutex;          ///< protects #mUuids and #mNewUuids
+        QHash<QString, Uuid> mUuids;    ///< all mappings, key: see #getKey()
+        QHash<QString, Uuid> mNewUuids; ///< mappings not yet written to #mDb
         FilePath mLibFilePath;
 };
 
@@ -74,6 +74,7 @@ void ComponentSignal::setName(const QString& name) noexcept
 {
     if (name == mName) return;
     mName = name;
+    ComponentSignalList::invalidateIndices();
     emit nameChanged(mName);
     emit edited();
 }
@@ -155,6 +156,7 @@ ComponentSignal& ComponentSignal::operator=(const ComponentSignal& rhs) noexcept
 {
     if (mUuid != rhs.mUuid) {
         mUuid = rhs.mUuid;
+        ComponentSignalList::invalidateIndices();
         emit edited();
     }
     setName(rhs.mName);
@@ -145,6 +145,7 @@ ComponentSymbolVariant& ComponentSymbolVariant::operator=(const ComponentSymbolV
 {
     if (mUuid != rhs.mUuid) {
         mUuid = rhs.mUuid;
+        ComponentSymbolVariantList::invalidateIndices();
         emit edited();
     }
     setNorm(rhs.mNorm);
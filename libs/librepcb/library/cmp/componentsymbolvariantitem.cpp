@@ -101,7 +101,10 @@ bool ComponentSymbolVariantItem::operator==(const ComponentSymbolVariantItem& rh
 
 ComponentSymbolVariantItem& ComponentSymbolVariantItem::operator=(const ComponentSymbolVariantItem& rhs) noexcept
 {
-    mUuid = rhs.mUuid;
+    if (mUuid != rhs.mUuid) {
+        mUuid = rhs.mUuid;
+        ComponentSymbolVariantItemList::invalidateIndices();
+    }
     mSymbolUuid = rhs.mSymbolUuid;
     mSymbolPos = rhs.mSymbolPos;
     mSymbolRot = rhs.mSymbolRot;
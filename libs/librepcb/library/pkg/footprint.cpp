@@ -121,7 +121,10 @@ bool Footprint::operator==(const Footprint& rhs) const noexcept
 
 Footprint& Footprint::operator=(const Footprint& rhs) noexcept
 {
-    mUuid = rhs.mUuid;
+    if (mUuid != rhs.mUuid) {
+        mUuid = rhs.mUuid;
+        FootprintList::invalidateIndices();
+    }
     mNames = rhs.mNames;
     mDescriptions = rhs.mDescriptions;
     mPads = rhs.mPads;
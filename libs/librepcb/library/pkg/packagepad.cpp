@@ -62,6 +62,7 @@ PackagePad::~PackagePad() noexcept
 void PackagePad::setName(const QString& name) noexcept
 {
     mName = name;
+    PackagePadList::invalidateIndices();
 }
 
 /*****************************************************************************************
@@ -91,6 +92,7 @@ PackagePad& PackagePad::operator=(const PackagePad& rhs) noexcept
 {
     mUuid = rhs.mUuid;
     mName = rhs.mName;
+    PackagePadList::invalidateIndices();
     return *this;
 }
 
@@ -76,6 +76,7 @@ void SymbolPin::setName(const QString& name) noexcept
 {
     Q_ASSERT(!name.isEmpty());
     mName = name;
+    SymbolPinList::invalidateIndices();
     if (mRegisteredGraphicsItem) mRegisteredGraphicsItem->setName(mName);
 }
 
@@ -143,6 +144,7 @@ SymbolPin& SymbolPin::operator=(const SymbolPin& rhs) noexcept
 {
     mUuid = rhs.mUuid;
     mName = rhs.mName;
+    SymbolPinList::invalidateIndices();
     mPosition = rhs.mPosition;
     mLength = rhs.mLength;
     mRotation = rhs.mRotation;
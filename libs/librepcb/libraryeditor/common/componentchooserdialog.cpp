@@ -110,19 +110,13 @@ void ComponentChooserDialog::setSelectedCategory(const Uuid& uuid) noexcept
 
     mSelectedCategoryUuid = uuid;
     try {
-        QSet<Uuid> components = mWorkspace.getLibraryDb().getComponentsByCategory(uuid); // can throw
-        foreach (const Uuid& uuid, components) {
-            try {
-                FilePath fp = mWorkspace.getLibraryDb().getLatestComponent(uuid); // can throw
-                QString name;
-                mWorkspace.getLibraryDb().getElementTranslations<Component>(fp, localeOrder(),
-                                                                            &name); // can throw
-                QListWidgetItem* item = new QListWidgetItem(name);
-                item->setData(Qt::UserRole, uuid.toStr());
-                mUi->listComponents->addItem(item);
-            } catch (const Exception& e) {
-                continue; // should we do something here?
-            }
+        QList<workspace::WorkspaceLibraryDb::ElementMetadata_t> components =
+            mWorkspace.getLibraryDb().getElementsMetadataByCategory<Component>(
+                uuid, localeOrder()); // can throw
+        foreach (const workspace::WorkspaceLibraryDb::ElementMetadata_t& cmp, components) {
+            QListWidgetItem* item = new QListWidgetItem(cmp.name);
+            item->setData(Qt::UserRole, cmp.uuid.toStr());
+            mUi->listComponents->addItem(item);
         }
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not load components"), e.getMsg());
@@ -111,19 +111,13 @@ void PackageChooserDialog::setSelectedCategory(const Uuid& uuid) noexcept
 
     mSelectedCategoryUuid = uuid;
     try {
-        QSet<Uuid> packages = mWorkspace.getLibraryDb().getPackagesByCategory(uuid); // can throw
-        foreach (const Uuid& uuid, packages) {
-            try {
-                FilePath fp = mWorkspace.getLibraryDb().getLatestPackage(uuid); // can throw
-                QString name;
-                mWorkspace.getLibraryDb().getElementTranslations<Package>(fp, localeOrder(),
-                                                                          &name); // can throw
-                QListWidgetItem* item = new QListWidgetItem(name);
-                item->setData(Qt::UserRole, uuid.toStr());
-                mUi->listPackages->addItem(item);
-            } catch (const Exception& e) {
-                continue; // should we do something here?
-            }
+        QList<workspace::WorkspaceLibraryDb::ElementMetadata_t> packages =
+            mWorkspace.getLibraryDb().getElementsMetadataByCategory<Package>(
+                uuid, localeOrder()); // can throw
+        foreach (const workspace::WorkspaceLibraryDb::ElementMetadata_t& pkg, packages) {
+            QListWidgetItem* item = new QListWidgetItem(pkg.name);
+            item->setData(Qt::UserRole, pkg.uuid.toStr());
+            mUi->listPackages->addItem(item);
         }
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not load packages"), e.getMsg());
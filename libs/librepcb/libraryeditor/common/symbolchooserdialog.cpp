@@ -128,18 +128,13 @@ void SymbolChooserDialog::setSelectedCategory(const Uuid& uuid) noexcept
 
     mSelectedCategoryUuid = uuid;
     try {
-        QSet<Uuid> symbols = mWorkspace.getLibraryDb().getSymbolsByCategory(uuid); // can throw
-        foreach (const Uuid& symbolUuid, symbols) {
-            try {
-                QString symName;
-                FilePath symFp = mWorkspace.getLibraryDb().getLatestSymbol(symbolUuid); // can throw
-                mWorkspace.getLibraryDb().getElementTranslations<Symbol>(symFp, localeOrder(), &symName); // can throw
-                QListWidgetItem* item = new QListWidgetItem(symName);
-                item->setData(Qt::UserRole, symFp.toStr());
-                mUi->listSymbols->addItem(item);
-            } catch (const Exception& e) {
-                continue; // should we do something here?
-            }
+        QList<workspace::WorkspaceLibraryDb::ElementMetadata_t> symbols =
+            mWorkspace.getLibraryDb().getElementsMetadataByCategory<Symbol>(
+                uuid, localeOrder()); // can throw
+        foreach (const workspace::WorkspaceLibraryDb::ElementMetadata_t& sym, symbols) {
+            QListWidgetItem* item = new QListWidgetItem(sym.name);
+            item->setData(Qt::UserRole, sym.filepath.toStr());
+            mUi->listSymbols->addItem(item);
         }
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not load symbols"), e.getMsg());
@@ -27,6 +27,7 @@
 #include <librepcb/library/elements.h>
 #include <librepcb/workspace/workspace.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/library/libraryelementlistmodel.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include "librarylisteditorwidget.h"
 
@@ -81,26 +82,47 @@ LibraryOverviewWidget::LibraryOverviewWidget(const Context& context,
     connect(mDependenciesEditorWidget.data(), &LibraryListEditorWidget::libraryRemoved,
             this, &LibraryOverviewWidget::setDirty);
 
+    using workspace::LibraryElementListModel;
+    mCmpCatModel.reset(new LibraryElementListModel(QIcon(":/img/places/folder.png")));
+    mPkgCatModel.reset(new LibraryElementListModel(QIcon(":/img/places/folder_green.png")));
+    mSymModel.reset(new LibraryElementListModel(QIcon(":/img/library/symbol.png")));
+    mPkgModel.reset(new LibraryElementListModel(QIcon(":/img/library/package.png")));
+    mCmpModel.reset(new LibraryElementListModel(QIcon(":/img/library/component.png")));
+    mDevModel.reset(new LibraryElementListModel(QIcon(":/img/library/device.png")));
+    mUi->lstCmpCat->setModel(mCmpCatModel.data());
+    mUi->lstPkgCat->setModel(mPkgCatModel.data());
+    mUi->lstSym->setModel(mSymModel.data());
+    mUi->lstPkg->setModel(mPkgModel.data());
+    mUi->lstCmp->setModel(mCmpModel.data());
+    mUi->lstDev->setModel(mDevModel.data());
+
     updateElementLists();
     connect(&mContext.workspace.getLibraryDb(), &workspace::WorkspaceLibraryDb::scanSucceeded,
             this, &LibraryOverviewWidget::updateElementLists);
 
-    connect(mUi->lstCmpCat, &QListWidget::doubleClicked, this,
+    connect(mUi->lstCmpCat, &QListView::doubleClicked, this,
             &LibraryOverviewWidget::lstCmpCatDoubleClicked);
-    connect(mUi->lstPkgCat, &QListWidget::doubleClicked, this,
+    connect(mUi->lstPkgCat, &QListView::doubleClicked, this,
             &LibraryOverviewWidget::lstPkgCatDoubleClicked);
-    connect(mUi->lstSym, &QListWidget::doubleClicked, this,
+    connect(mUi->lstSym, &QListView::doubleClicked, this,
             &LibraryOverviewWidget::lstSymDoubleClicked);
-    connect(mUi->lstPkg, &QListWidget::doubleClicked, this,
+    connect(mUi->lstPkg, &QListView::doubleClicked, this,
             &LibraryOverviewWidget::lstPkgDoubleClicked);
-    connect(mUi->lstCmp, &QListWidget::doubleClicked, this,
+    connect(mUi->lstCmp, &QListView::doubleClicked, this,
             &LibraryOverviewWidget::lstCmpDoubleClicked);
-    connect(mUi->lstDev, &QListWidget::doubleClicked, this,
+    connect(mUi->lstDev, &QListView::doubleClicked, this,
             &LibraryOverviewWidget::lstDevDoubleClicked);
 }
 
 LibraryOverviewWidget::~LibraryOverviewWidget() noexcept
 {
+    // detach the models before they get destroyed
+    mUi->lstCmpCat->setModel(nullptr);
+    mUi->lstPkgCat->setModel(nullptr);
+    mUi->lstSym->setModel(nullptr);
+    mUi->lstPkg->setModel(nullptr);
+    mUi->lstCmp->setModel(nullptr);
+    mUi->lstDev->setModel(nullptr);
 }
 
 /*****************************************************************************************
@@ -152,59 +174,23 @@ void LibraryOverviewWidget::updateIcon() noexcept
 
 void LibraryOverviewWidget::updateElementLists() noexcept
 {
-    updateElementList<ComponentCategory>(*mUi->lstCmpCat, QIcon(":/img/places/folder.png"));
-    updateElementList<PackageCategory>(  *mUi->lstPkgCat, QIcon(":/img/places/folder_green.png"));
-    updateElementList<Symbol>(           *mUi->lstSym,    QIcon(":/img/library/symbol.png"));
-    updateElementList<Package>(          *mUi->lstPkg,    QIcon(":/img/library/package.png"));
-    updateElementList<Component>(        *mUi->lstCmp,    QIcon(":/img/library/component.png"));
-    updateElementList<Device>(           *mUi->lstDev,    QIcon(":/img/library/device.png"));
+    updateElementList<ComponentCategory>(*mCmpCatModel);
+    updateElementList<PackageCategory>(  *mPkgCatModel);
+    updateElementList<Symbol>(           *mSymModel);
+    updateElementList<Package>(          *mPkgModel);
+    updateElementList<Component>(        *mCmpModel);
+    updateElementList<Device>(           *mDevModel);
 }
 
 template <typename ElementType>
-void LibraryOverviewWidget::updateElementList(QListWidget& listWidget, const QIcon& icon) noexcept
+void LibraryOverviewWidget::updateElementList(workspace::LibraryElementListModel& model) noexcept
 {
-    QHash<FilePath, QString> elementNames;
-
     try {
-        // get all library element names
-        QList<FilePath> elements = mContext.workspace.getLibraryDb().getLibraryElements
-                                   <ElementType>(mLibrary->getFilePath()); // can throw
-        foreach (const FilePath& filepath, elements) {
-            QString name;
-            mContext.workspace.getLibraryDb().getElementTranslations<ElementType>(
-                filepath, getLibLocaleOrder(), &name); // can throw
-            elementNames.insert(filepath, name);
-        }
+        // get the names of all library elements with a single database query
+        model.setElements(mContext.workspace.getLibraryDb().getLibraryElementsMetadata
+            <ElementType>(mLibrary->getFilePath(), getLibLocaleOrder())); // can throw
     } catch (const Exception& e) {
-        listWidget.clear();
-        QListWidgetItem* item = new QListWidgetItem(&listWidget);
-        item->setText(e.getMsg());
-        item->setToolTip(e.getMsg());
-        item->setIcon(QIcon(":/img/status/dialog_error.png"));
-        item->setBackground(Qt::red);
-        item->setForeground(Qt::white);
-        return;
-    }
-
-    // update/remove existing list widget items
-    for (int i = listWidget.count() - 1; i >= 0; --i) {
-        QListWidgetItem* item = listWidget.item(i); Q_ASSERT(item);
-        FilePath filePath(item->data(Qt::UserRole).toString());
-        if (elementNames.contains(filePath)) {
-            item->setText(elementNames.take(filePath));
-        } else {
-            delete item;
-        }
-    }
-
-    // add new list widget items
-    foreach (const FilePath& fp, elementNames.keys()) {
-        QString name = elementNames.value(fp);
-        QListWidgetItem* item = new QListWidgetItem(&listWidget);
-        item->setText(name);
-        item->setToolTip(name);
-        item->setData(Qt::UserRole, fp.toStr());
-        item->setIcon(icon);
+        model.setErrorMessage(e.getMsg());
     }
 }
 
@@ -224,8 +210,7 @@ void LibraryOverviewWidget::btnIconClicked() noexcept
 
 void LibraryOverviewWidget::lstCmpCatDoubleClicked(const QModelIndex& index) noexcept
 {
-    QListWidgetItem* item = mUi->lstCmpCat->item(index.row());
-    FilePath fp = item ? FilePath(item->data(Qt::UserRole).toString()) : FilePath();
+    FilePath fp = mCmpCatModel->getFilePath(index);
     if (fp.isValid()) {
         emit editComponentCategoryTriggered(fp);
     }
@@ -233,8 +218,7 @@ void LibraryOverviewWidget::lstCmpCatDoubleClicked(const QModelIndex& index) noe
 
 void LibraryOverviewWidget::lstPkgCatDoubleClicked(const QModelIndex& index) noexcept
 {
-    QListWidgetItem* item = mUi->lstPkgCat->item(index.row());
-    FilePath fp = item ? FilePath(item->data(Qt::UserRole).toString()) : FilePath();
+    FilePath fp = mPkgCatModel->getFilePath(index);
     if (fp.isValid()) {
         emit editPackageCategoryTriggered(fp);
     }
@@ -242,8 +226,7 @@ void LibraryOverviewWidget::lstPkgCatDoubleClicked(const QModelIndex& index) noe
 
 void LibraryOverviewWidget::lstSymDoubleClicked(const QModelIndex& index) noexcept
 {
-    QListWidgetItem* item = mUi->lstSym->item(index.row());
-    FilePath fp = item ? FilePath(item->data(Qt::UserRole).toString()) : FilePath();
+    FilePath fp = mSymModel->getFilePath(index);
     if (fp.isValid()) {
         emit editSymbolTriggered(fp);
     }
@@ -251,8 +234,7 @@ void LibraryOverviewWidget::lstSymDoubleClicked(const QModelIndex& index) noexce
 
 void LibraryOverviewWidget::lstPkgDoubleClicked(const QModelIndex& index) noexcept
 {
-    QListWidgetItem* item = mUi->lstPkg->item(index.row());
-    FilePath fp = item ? FilePath(item->data(Qt::UserRole).toString()) : FilePath();
+    FilePath fp = mPkgModel->getFilePath(index);
     if (fp.isValid()) {
         emit editPackageTriggered(fp);
     }
@@ -260,8 +242,7 @@ void LibraryOverviewWidget::lstPkgDoubleClicked(const QModelIndex& index) noexce
 
 void LibraryOverviewWidget::lstCmpDoubleClicked(const QModelIndex& index) noexcept
 {
-    QListWidgetItem* item = mUi->lstCmp->item(index.row());
-    FilePath fp = item ? FilePath(item->data(Qt::UserRole).toString()) : FilePath();
+    FilePath fp = mCmpModel->getFilePath(index);
     if (fp.isValid()) {
         emit editComponentTriggered(fp);
     }
@@ -269,8 +250,7 @@ void LibraryOverviewWidget::lstCmpDoubleClicked(const QModelIndex& index) noexce
 
 void LibraryOverviewWidget::lstDevDoubleClicked(const QModelIndex& index) noexcept
 {
-    QListWidgetItem* item = mUi->lstDev->item(index.row());
-    FilePath fp = item ? FilePath(item->data(Qt::UserRole).toString()) : FilePath();
+    FilePath fp = mDevModel->getFilePath(index);
     if (fp.isValid()) {
         emit editDeviceTriggered(fp);
     }
@@ -32,6 +32,11 @@
  *  Namespace / Forward Declarations
  ****************************************************************************************/
 namespace librepcb {
+
+namespace workspace {
+class LibraryElementListModel;
+}
+
 namespace library {
 
 class Library;
@@ -89,7 +94,7 @@ class LibraryOverviewWidget final : public EditorWidgetBase
         void updateIcon() noexcept;
         void updateElementLists() noexcept;
         template <typename ElementType>
-        void updateElementList(QListWidget& listWidget, const QIcon& icon) noexcept;
+        void updateElementList(workspace::LibraryElementListModel& model) noexcept;
 
         // Event Handlers
         void btnIconClicked() noexcept;
@@ -105,6 +110,12 @@ class LibraryOverviewWidget final : public EditorWidgetBase
         QSharedPointer<Library> mLibrary;
         QScopedPointer<Ui::LibraryOverviewWidget> mUi;
         QScopedPointer<LibraryListEditorWidget> mDependenciesEditorWidget;
+        QScopedPointer<workspace::LibraryElementListModel> mCmpCatModel;
+        QScopedPointer<workspace::LibraryElementListModel> mPkgCatModel;
+        QScopedPointer<workspace::LibraryElementListModel> mSymModel;
+        QScopedPointer<workspace::LibraryElementListModel> mPkgModel;
+        QScopedPointer<workspace::LibraryElementListModel> mCmpModel;
+        QScopedPointer<workspace::LibraryElementListModel> mDevModel;
 };
 
 /*****************************************************************************************
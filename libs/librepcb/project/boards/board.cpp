@@ -35,6 +35,7 @@
 #include <librepcb/common/gridproperties.h>
 #include "../circuit/circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../circuit/componentinstance.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
@@ -64,12 +65,10 @@ namespace project {
 
 Board::Board(const Board& other, const FilePath& filepath, const QString& name) :
     QObject(&other.getProject()), mProject(other.getProject()), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mSelectionRectActive(false), mDeferGraphicsUpdatesCount(0)
 {
     try
     {
-        mGraphicsScene.reset(new GraphicsScene());
-
         // copy the other board
         mFile.reset(SmartSExprFile::create(mFilePath));
 
@@ -119,13 +118,12 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
 
         // rebuildAllPlanes(); --> fragments are copied too, so no need to rebuild them
         updateErcMessages();
-        updateIcon();
 
         // emit the "attributesChanged" signal when the project has emited it
         connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
 
-        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::updateErcMessages);
-        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::updateErcMessages);
+        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::scheduleErcMessagesUpdate);
+        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::scheduleErcMessagesUpdate);
 
         if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
     }
@@ -149,12 +147,11 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
 
 Board::Board(Project& project, const FilePath& filepath, bool restore,
              bool readOnly, bool create, const QString& newName) :
-    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false)
+    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false),
+    mSelectionRectActive(false), mDeferGraphicsUpdatesCount(0)
 {
     try
     {
-        mGraphicsScene.reset(new GraphicsScene());
-
         // try to open/create the board file
         if (create)
         {
@@ -245,13 +242,12 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
 
         rebuildAllPlanes();
         updateErcMessages();
-        updateIcon();
 
         // emit the "attributesChanged" signal when the project has emited it
         connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
 
-        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::updateErcMessages);
-        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::updateErcMessages);
+        connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::scheduleErcMessagesUpdate);
+        connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::scheduleErcMessagesUpdate);
 
         if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
     }
@@ -275,6 +271,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
 
 Board::~Board() noexcept
 {
+    mProject.getErcMsgList().unscheduleUpdate(*this);
     Q_ASSERT(!mIsAddedToProject);
 
     qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
@@ -297,6 +294,20 @@ Board::~Board() noexcept
  *  Getters: General
  ****************************************************************************************/
 
+GraphicsScene& Board::getGraphicsScene() const noexcept
+{
+    // The scene and all its graphics items are only built when they are needed (e.g.
+    // when shown in a view the first time) to avoid wasting memory for boards which are
+    // never looked at.
+    if (!mGraphicsScene) {
+        mGraphicsScene.reset(new GraphicsScene());
+        foreach (BI_Base* owner, mSceneItems.keys()) {
+            createGraphicsItem(*owner);
+        }
+    }
+    return *mGraphicsScene;
+}
+
 bool Board::isEmpty() const noexcept
 {
     return (mDeviceInstances.isEmpty() && mNetSegments.isEmpty() && mPlanes.isEmpty());
@@ -398,7 +409,7 @@ QList<BI_FootprintPad*> Board::getPadsAtScenePos(const Point& pos, const Graphic
         foreach (BI_FootprintPad* pad, device->getFootprint().getPads())
         {
             if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
-                && ((!layer) || (pad->isOnLayer(layer->getName())))
+                && ((!layer) || (pad->isOnLayer(layer->getId())))
                 && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
             {
                 list.append(pad);
@@ -431,6 +442,18 @@ void Board::setGridProperties(const GridProperties& grid) noexcept
     *mGridProperties = grid;
 }
 
+/*****************************************************************************************
+ *  Getters: Attributes
+ ****************************************************************************************/
+
+const QIcon& Board::getIcon() noexcept
+{
+    if (mIcon.isNull()) {
+        updateIcon();
+    }
+    return mIcon;
+}
+
 /*****************************************************************************************
  *  DeviceInstance Methods
  ****************************************************************************************/
@@ -454,7 +477,7 @@ void Board::addDeviceInstance(BI_Device& instance)
     // add to board
     instance.addToBoard(); // can throw
     mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     emit deviceAdded(instance);
 }
 
@@ -466,7 +489,7 @@ void Board::removeDeviceInstance(BI_Device& instance)
     // remove from board
     instance.removeFromBoard(); // can throw
     mDeviceInstances.remove(instance.getComponentInstanceUuid());
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     emit deviceRemoved(instance);
 }
 
@@ -587,7 +610,8 @@ void Board::addToProject()
         sgl.add([item](){item->removeFromBoard();});
     }
     mIsAddedToProject = true;
-    updateErcMessages();
+    mIcon = QIcon(); // will be rendered on demand
+    scheduleErcMessagesUpdate();
     sgl.dismiss();
 }
 
@@ -604,7 +628,7 @@ void Board::removeFromProject()
         sgl.add([item](){item->addToBoard();});
     }
     mIsAddedToProject = false;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     sgl.dismiss();
 }
 
@@ -641,35 +665,91 @@ bool Board::save(bool toOriginal, QStringList& errors) noexcept
 
 void Board::showInView(GraphicsView& view) noexcept
 {
-    view.setScene(mGraphicsScene.data());
+    view.setScene(&getGraphicsScene()); // builds the scene on first use
+    mIcon = QIcon(); // the board may be modified while it is shown
 }
 
-void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept
+void Board::releaseGraphicsScene() noexcept
 {
-    mGraphicsScene->setSelectionRect(p1, p2);
-    if (updateItems) {
-        QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
-        foreach (BI_Device* component, mDeviceInstances) {
-            BI_Footprint& footprint = component->getFootprint();
-            bool selectFootprint = footprint.isSelectable() && footprint.getGrabAreaScenePx().intersects(rectPx);
-            footprint.setSelected(selectFootprint);
-            foreach (BI_FootprintPad* pad, footprint.getPads()) {
-                bool selectPad = pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
-                pad->setSelected(selectFootprint || selectPad);
+    if (mGraphicsScene) {
+        updateIcon(); // keep the last state of the scene for the icon
+        for (auto it = mSceneItems.begin(); it != mSceneItems.end(); ++it) {
+            if (it.value()) {
+                mGraphicsScene->removeItem(*it.value());
+                it.key()->destroyGraphicsItem();
+                it.value() = nullptr;
             }
         }
-        foreach (BI_NetSegment* segment, mNetSegments) {
-            segment->setSelectionRect(rectPx);
-        }
-        foreach (BI_Plane* plane, mPlanes) {
-            bool select = plane->isSelectable() && plane->getGrabAreaScenePx().intersects(rectPx);
-            plane->setSelected(select);
-        }
-        foreach (BI_Polygon* polygon, mPolygons) {
-            bool select = polygon->isSelectable() && polygon->getGrabAreaScenePx().intersects(rectPx);
-            polygon->setSelected(select);
+        mGraphicsItemOwners.clear();
+        mItemsInSelectionRect.clear();
+        mSelectionRectActive = false;
+        mGraphicsScene.reset();
+    }
+}
+
+void Board::addGraphicsItem(BI_Base& owner) noexcept
+{
+    Q_ASSERT(!mSceneItems.contains(&owner));
+    mSceneItems.insert(&owner, nullptr);
+    if (mGraphicsScene) {
+        createGraphicsItem(owner);
+    }
+}
+
+void Board::removeGraphicsItem(BI_Base& owner) noexcept
+{
+    Q_ASSERT(mSceneItems.contains(&owner));
+    mItemsInSelectionRect.remove(&owner);
+    if (QGraphicsItem* item = mSceneItems.take(&owner)) {
+        mGraphicsItemOwners.remove(item);
+        mGraphicsScene->removeItem(*item);
+        owner.destroyGraphicsItem();
+    }
+}
+
+void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept
+{
+    getGraphicsScene().setSelectionRect(p1, p2);
+    if (!updateItems) {
+        // the selection rect is released, keep the selection state of all items
+        mItemsInSelectionRect.clear();
+        mSelectionRectActive = false;
+        return;
+    }
+    if (!mSelectionRectActive) {
+        // a new selection rect replaces the previous selection
+        clearSelection();
+        mSelectionRectActive = true;
+    }
+
+    // Query candidates from the spatial index of the graphics scene instead of testing
+    // every item of the board, since this is called on every mouse move.
+    QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+    QSet<BI_Base*> items;
+    foreach (QGraphicsItem* graphicsItem,
+             mGraphicsScene->items(rectPx, Qt::IntersectsItemBoundingRect))
+    {
+        BI_Base* item = mGraphicsItemOwners.value(graphicsItem, nullptr);
+        if ((!item) || (!item->isSelectable())) continue;
+        if (!item->getGrabAreaScenePx().intersects(rectPx)) continue;
+        items.insert(item);
+        if (item->getType() == BI_Base::Type_t::Footprint) {
+            // pads are always selected together with their footprint
+            foreach (BI_FootprintPad* pad, static_cast<BI_Footprint*>(item)->getPads()) {
+                items.insert(pad);
+            }
         }
     }
+
+    // only touch items whose selection state has changed to avoid needless repaints
+    foreach (BI_Base* item, mItemsInSelectionRect) {
+        if (!items.contains(item)) item->setSelected(false);
+    }
+    foreach (BI_Base* item, items) {
+        // note: deselecting a footprint above has also deselected its pads
+        if (!item->isSelected()) item->setSelected(true);
+    }
+    mItemsInSelectionRect = items;
 }
 
 void Board::clearSelection() const noexcept
@@ -718,16 +798,27 @@ QVector<const AttributeProvider*> Board::getAttributeProviderParents() const noe
 
 void Board::updateIcon() noexcept
 {
-    QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
     QRect target(0, 0, 297, 210); // DIN A4 format :-)
 
     QPixmap pixmap(target.size());
     pixmap.fill(Qt::white);
-    QPainter painter(&pixmap);
-    mGraphicsScene->render(&painter, target, source);
+    if (mGraphicsScene) { // don't build the scene just for the icon
+        QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
+        QPainter painter(&pixmap);
+        mGraphicsScene->render(&painter, target, source);
+    }
     mIcon = QIcon(pixmap);
 }
 
+void Board::createGraphicsItem(BI_Base& owner) const noexcept
+{
+    if (QGraphicsItem* item = owner.createGraphicsItem()) {
+        mSceneItems.insert(&owner, item);
+        mGraphicsItemOwners.insert(item, &owner);
+        mGraphicsScene->addItem(*item);
+    }
+}
+
 bool Board::checkAttributesValidity() const noexcept
 {
     if (mUuid.isNull())     return false;
@@ -755,6 +846,11 @@ void Board::serialize(SExpression& root) const
     root.appendLineBreak();
 }
 
+void Board::scheduleErcMessagesUpdate() noexcept
+{
+    mProject.getErcMsgList().scheduleUpdate(*this);
+}
+
 void Board::updateErcMessages() noexcept
 {
     // type: UnplacedComponent (ComponentInstances without DeviceInstance)
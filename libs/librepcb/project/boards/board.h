@@ -52,6 +52,7 @@ class NetSignal;
 class Project;
 class BI_Device;
 class BI_Base;
+class BGI_Base;
 class BI_FootprintPad;
 class BI_Via;
 class BI_NetSegment;
@@ -112,7 +113,8 @@ class Board final : public QObject, public AttributeProvider,
         Project& getProject() const noexcept {return mProject;}
         const FilePath& getFilePath() const noexcept {return mFilePath;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
-        GraphicsScene& getGraphicsScene () const noexcept {return *mGraphicsScene;}
+        GraphicsScene& getGraphicsScene() const noexcept;
+        bool isGraphicsSceneBuilt() const noexcept {return !mGraphicsScene.isNull();}
         BoardLayerStack& getLayerStack() noexcept {return *mLayerStack;}
         BoardDesignRules& getDesignRules() noexcept {return *mDesignRules;}
         const BoardDesignRules& getDesignRules() const noexcept {return *mDesignRules;}
@@ -133,7 +135,14 @@ class Board final : public QObject, public AttributeProvider,
         // Getters: Attributes
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getName() const noexcept {return mName;}
-        const QIcon& getIcon() const noexcept {return mIcon;}
+
+        /**
+         * @brief Get a preview image of the board
+         *
+         * The icon is rendered from the graphics scene, but the scene is never built
+         * only for the icon. So as long as the board was not shown, the icon is empty.
+         */
+        const QIcon& getIcon() noexcept;
 
         // DeviceInstance Methods
         const QMap<Uuid, BI_Device*>& getDeviceInstances() const noexcept {return mDeviceInstances;}
@@ -163,6 +172,9 @@ class Board final : public QObject, public AttributeProvider,
         void removeFromProject();
         bool save(bool toOriginal, QStringList& errors) noexcept;
         void showInView(GraphicsView& view) noexcept;
+        void releaseGraphicsScene() noexcept;
+        void addGraphicsItem(BI_Base& owner) noexcept;
+        void removeGraphicsItem(BI_Base& owner) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
         void setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept;
@@ -199,8 +211,10 @@ class Board final : public QObject, public AttributeProvider,
         Board(Project& project, const FilePath& filepath, bool restore,
               bool readOnly, bool create, const QString& newName);
         void updateIcon() noexcept;
+        void createGraphicsItem(BI_Base& owner) const noexcept;
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
@@ -212,7 +226,16 @@ class Board final : public QObject, public AttributeProvider,
         QScopedPointer<SmartSExprFile> mFile;
         bool mIsAddedToProject;
 
-        QScopedPointer<GraphicsScene> mGraphicsScene;
+        mutable QScopedPointer<GraphicsScene> mGraphicsScene; ///< built on demand
+        /// all items which belong to the scene, with their graphics item (if built)
+        mutable QHash<BI_Base*, QGraphicsItem*> mSceneItems;
+        /// the owners of all graphics items of the built scene
+        mutable QHash<QGraphicsItem*, BI_Base*> mGraphicsItemOwners;
+        QSet<BI_Base*> mItemsInSelectionRect; ///< items selected by the selection rect
+        bool mSelectionRectActive; ///< whether the selection rect is currently dragged
+        friend class BGI_Base; // for the deferred updates of the graphics items
+        int mDeferGraphicsUpdatesCount; ///< see BGI_Base::DeferUpdatesGuard
+        QSet<BGI_Base*> mDirtyGraphicsItems; ///< items to update after deferring
         QScopedPointer<BoardLayerStack> mLayerStack;
         QScopedPointer<GridProperties> mGridProperties;
         QScopedPointer<BoardDesignRules> mDesignRules;
@@ -222,7 +245,7 @@ class Board final : public QObject, public AttributeProvider,
         // Attributes
         Uuid mUuid;
         QString mName;
-        QIcon mIcon;
+        QIcon mIcon; ///< rendered from the scene (if built) by #getIcon()
 
         // items
         QMap<Uuid, BI_Device*> mDeviceInstances;
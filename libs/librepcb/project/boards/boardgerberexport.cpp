@@ -27,6 +27,8 @@
 #include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/boarddesignrules.h>
 #include <librepcb/common/geometry/hole.h>
+#include <librepcb/common/geometry/text.h>
+#include <librepcb/common/font/strokefont.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 #include "../metadata/projectmetadata.h"
@@ -114,7 +116,7 @@ void BoardGerberExport::exportLayerBoardOutlines() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBoardOutlines);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sBoardOutlines));
     gen.generate();
     gen.saveToFile(getOutputFilePath("OUTLINES.gbr"));
 }
@@ -123,7 +125,7 @@ void BoardGerberExport::exportLayerTopCopper() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sTopCopper);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sTopCopper));
     gen.generate();
     gen.saveToFile(getOutputFilePath("COPPER-TOP.gbr"));
 }
@@ -132,7 +134,7 @@ void BoardGerberExport::exportLayerTopSolderMask() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sTopStopMask);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sTopStopMask));
     gen.generate();
     gen.saveToFile(getOutputFilePath("SOLDERMASK-TOP.gbr"));
 }
@@ -141,10 +143,10 @@ void BoardGerberExport::exportLayerTopSilkscreen() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sTopPlacement);
-    drawLayer(gen, GraphicsLayer::sTopNames);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sTopPlacement));
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sTopNames));
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, GraphicsLayer::sTopStopMask);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sTopStopMask));
     gen.generate();
     gen.saveToFile(getOutputFilePath("SILKSCREEN-TOP.gbr"));
 }
@@ -153,7 +155,7 @@ void BoardGerberExport::exportLayerBottomCopper() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBotCopper);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sBotCopper));
     gen.generate();
     gen.saveToFile(getOutputFilePath("COPPER-BOTTOM.gbr"));
 }
@@ -162,7 +164,7 @@ void BoardGerberExport::exportLayerBottomSolderMask() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBotStopMask);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sBotStopMask));
     gen.generate();
     gen.saveToFile(getOutputFilePath("SOLDERMASK-BOTTOM.gbr"));
 }
@@ -171,20 +173,20 @@ void BoardGerberExport::exportLayerBottomSilkscreen() const
 {
     GerberGenerator gen(mProject.getMetadata().getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::sBotPlacement);
-    drawLayer(gen, GraphicsLayer::sBotNames);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sBotPlacement));
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sBotNames));
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, GraphicsLayer::sBotStopMask);
+    drawLayer(gen, GraphicsLayerId(GraphicsLayer::sBotStopMask));
     gen.generate();
     gen.saveToFile(getOutputFilePath("SILKSCREEN-BOTTOM.gbr"));
 }
 
-void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName) const
+void BoardGerberExport::drawLayer(GerberGenerator& gen, const GraphicsLayerId& layer) const
 {
     // draw footprints incl. pads
     foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
         Q_ASSERT(device);
-        drawFootprint(gen, device->getFootprint(), layerName);
+        drawFootprint(gen, device->getFootprint(), layer);
     }
 
     // draw vias
@@ -192,7 +194,7 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
         Q_ASSERT(netsegment);
         foreach (const BI_Via* via, netsegment->getVias()) {
             Q_ASSERT(via);
-            drawVia(gen, *via, layerName);
+            drawVia(gen, *via, layer);
         }
     }
 
@@ -201,7 +203,7 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
         Q_ASSERT(netsegment);
         foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
             Q_ASSERT(netline);
-            if (netline->getLayer().getName() == layerName) {
+            if (netline->getLayer().getId() == layer) {
                 gen.drawLine(netline->getStartPoint().getPosition(),
                              netline->getEndPoint().getPosition(),
                              netline->getWidth());
@@ -211,7 +213,7 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
 
     // draw planes
     foreach (const BI_Plane* plane, mBoard.getPlanes()) { Q_ASSERT(plane);
-        if (plane->getLayerName() == layerName) {
+        if (plane->getLayerId() == layer) {
             foreach (const Path& fragment, plane->getFragments()) {
                 gen.drawPathArea(fragment);
             }
@@ -221,17 +223,19 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen, const QString& layerName
     // draw polygons
     foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
         Q_ASSERT(polygon);
-        if (layerName == polygon->getPolygon().getLayerName()) {
-            Length lineWidth = calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
+        if (layer == polygon->getPolygon().getLayerId()) {
+            Length lineWidth = calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layer);
             gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth);
         }
     }
 }
 
-void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const
+void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const GraphicsLayerId& layer) const
 {
-    bool drawCopper = via.isOnLayer(layerName);
-    bool drawStopMask = (layerName == GraphicsLayer::sTopStopMask || layerName == GraphicsLayer::sBotStopMask)
+    static const GraphicsLayerId topStopMask(GraphicsLayer::sTopStopMask);
+    static const GraphicsLayerId botStopMask(GraphicsLayer::sBotStopMask);
+    bool drawCopper = via.isOnLayer(layer);
+    bool drawStopMask = (layer == topStopMask || layer == botStopMask)
                         && mBoard.getDesignRules().doesViaRequireStopMask(via.getDrillDiameter());
     if (drawCopper || drawStopMask) {
         Length outerDiameter = via.getSize();
@@ -261,22 +265,24 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const Q
     }
 }
 
-void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const
+void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const GraphicsLayerId& layer) const
 {
     // draw pads
     foreach (const BI_FootprintPad* pad, footprint.getPads()) {
-        drawFootprintPad(gen, *pad, layerName);
+        drawFootprintPad(gen, *pad, layer);
     }
 
+    // the layer in the coordinate system of the library footprint
+    GraphicsLayerId fptLayer = footprint.getIsMirrored() ? layer.getMirrored() : layer;
+
     // draw polygons
     for (const Polygon& polygon : footprint.getLibFootprint().getPolygons()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == polygon.getLayerName()) {
+        if (fptLayer == polygon.getLayerId()) {
             Path path = polygon.getPath();
             if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
             path.rotate(footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation());
             path.translate(footprint.getPosition());
-            gen.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), layer));
+            gen.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), fptLayer));
             if (polygon.isFilled()) {
                 gen.drawPathArea(path);
             }
@@ -285,13 +291,12 @@ void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint&
 
     // draw ellipses
     for (const Ellipse& ellipse : footprint.getLibFootprint().getEllipses()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
-        if (layer == ellipse.getLayerName()) {
+        if (fptLayer == ellipse.getLayerId()) {
             Ellipse e = ellipse;
             if (footprint.getIsMirrored()) e.setCenter(e.getCenter().mirrored(Qt::Horizontal));
             e.rotate(footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation());
             e.translate(footprint.getPosition());
-            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), layer));
+            e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), fptLayer));
             gen.drawEllipseOutline(e);
             if (e.isFilled()) {
                 gen.drawEllipseArea(e);
@@ -299,7 +304,19 @@ void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint&
         }
     }
 
-    // TODO: draw texts
+    // draw texts
+    for (const Text& text : footprint.getLibFootprint().getTexts()) {
+        if (fptLayer == text.getLayerId()) {
+            Length lineWidth = calcWidthOfLayer(StrokeFont::calcStrokeWidth(text.getHeight()),
+                                                fptLayer);
+            foreach (Path path, footprint.getTextPaths(text)) {
+                if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
+                path.rotate(footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation());
+                path.translate(footprint.getPosition());
+                gen.drawPathOutline(path, lineWidth);
+            }
+        }
+    }
 
     // draw holes
     for (const Hole& hole : footprint.getLibFootprint().getHoles()) {
@@ -307,11 +324,15 @@ void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint&
     }
 }
 
-void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const
+void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const GraphicsLayerId& layer) const
 {
-    bool isOnCopperLayer = pad.isOnLayer(layerName);
-    bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopStopMask);
-    bool isOnSolderMaskBottom = pad.isOnLayer(GraphicsLayer::sBotCopper) && (layerName == GraphicsLayer::sBotStopMask);
+    static const GraphicsLayerId topCopper(GraphicsLayer::sTopCopper);
+    static const GraphicsLayerId botCopper(GraphicsLayer::sBotCopper);
+    static const GraphicsLayerId topStopMask(GraphicsLayer::sTopStopMask);
+    static const GraphicsLayerId botStopMask(GraphicsLayer::sBotStopMask);
+    bool isOnCopperLayer = pad.isOnLayer(layer);
+    bool isOnSolderMaskTop = pad.isOnLayer(topCopper) && (layer == topStopMask);
+    bool isOnSolderMaskBottom = pad.isOnLayer(botCopper) && (layer == botStopMask);
     if (!isOnCopperLayer && !isOnSolderMaskTop && !isOnSolderMaskBottom) {
         return;
     }
@@ -366,9 +387,10 @@ FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const noexc
  *  Static Methods
  ****************************************************************************************/
 
-Length BoardGerberExport::calcWidthOfLayer(const Length& width, const QString& name) noexcept
+Length BoardGerberExport::calcWidthOfLayer(const Length& width, const GraphicsLayerId& layer) noexcept
 {
-    if ((name == GraphicsLayer::sBoardOutlines) && (width < Length(1000))) {
+    static const GraphicsLayerId boardOutlines(GraphicsLayer::sBoardOutlines);
+    if ((layer == boardOutlines) && (width < Length(1000))) {
         return Length(1000); // outlines should have a minimum width of 1um
     } else {
         return width;
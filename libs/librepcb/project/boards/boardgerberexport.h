@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/graphics/graphicslayerid.h>
 #include <librepcb/common/units/all_length_units.h>
 
 /*****************************************************************************************
@@ -86,15 +87,15 @@ class BoardGerberExport final : public QObject
         void exportLayerBottomSolderMask() const;
         void exportLayerBottomSilkscreen() const;
 
-        void drawLayer(GerberGenerator& gen, const QString& layerName) const;
-        void drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const;
-        void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const;
-        void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const;
+        void drawLayer(GerberGenerator& gen, const GraphicsLayerId& layer) const;
+        void drawVia(GerberGenerator& gen, const BI_Via& via, const GraphicsLayerId& layer) const;
+        void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const GraphicsLayerId& layer) const;
+        void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const GraphicsLayerId& layer) const;
 
         FilePath getOutputFilePath(const QString& suffix) const noexcept;
 
         // Static Methods
-        static Length calcWidthOfLayer(const Length& width, const QString& name) noexcept;
+        static Length calcWidthOfLayer(const Length& width, const GraphicsLayerId& layer) noexcept;
 
 
         // Private Member Variables
@@ -139,6 +139,7 @@ void BoardLayerStack::serialize(SExpression& root) const
 void BoardLayerStack::layerAttributesChanged() noexcept
 {
     if (!mLayersChanged) {
+        AttributeProvider::invalidateAttributeValues();
         emit mBoard.attributesChanged();
         mLayersChanged = true;
     }
@@ -223,6 +224,13 @@ void BoardLayerStack::addLayer(GraphicsLayer* layer) noexcept
             this, &BoardLayerStack::layerAttributesChanged,
             Qt::QueuedConnection);
     mLayers.append(layer);
+    int index = layer->getId().toInt();
+    if (index >= 0) {
+        if (index >= mLayersById.count()) {
+            mLayersById.resize(index + 1);
+        }
+        mLayersById[index] = layer;
+    }
 }
 
 /*****************************************************************************************
@@ -68,12 +68,20 @@ class BoardLayerStack final : public QObject, public SerializableObject,
 
         /// @copydoc IF_BoardLayerProvider#getLayer()
         GraphicsLayer* getLayer(const QString& name) const noexcept override {
-            foreach (GraphicsLayer* layer, mLayers) {
-                if (layer->getName() == name) {
-                    return layer;
-                }
-            }
-            return nullptr;
+            return getLayer(GraphicsLayerId::find(name));
+        }
+
+        /**
+         * @brief Get a layer by its ID in O(1) (prefer this in hot code paths)
+         *
+         * @param id    The layer ID
+         *
+         * @return The layer or nullptr if there is no such layer on this board
+         */
+        GraphicsLayer* getLayer(const GraphicsLayerId& id) const noexcept {
+            int index = id.toInt();
+            return ((index >= 0) && (index < mLayersById.count())) ? mLayersById.at(index)
+                                                                   : nullptr;
         }
 
         // Setters
@@ -102,6 +110,7 @@ class BoardLayerStack final : public QObject, public SerializableObject,
         // General
         Board& mBoard; ///< A reference to the Board object (from the ctor)
         QList<GraphicsLayer*> mLayers;
+        QVector<GraphicsLayer*> mLayersById; ///< index: GraphicsLayerId::toInt()
         bool mLayersChanged;
 
         // Settings
@@ -24,6 +24,8 @@
 #include "boardplanefragmentsbuilder.h"
 #include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/utils/clipperhelpers.h>
+#include <librepcb/common/font/strokefont.h>
+#include <librepcb/common/geometry/text.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 #include "items/bi_plane.h"
@@ -93,8 +95,9 @@ void BoardPlaneFragmentsBuilder::clipToBoardOutline()
     // determine board area
     ClipperLib::Paths boardArea;
     ClipperLib::Clipper boardAreaClipper;
+    static const GraphicsLayerId outlinesLayer(GraphicsLayer::sBoardOutlines);
     foreach (const BI_Polygon* polygon, mPlane.getBoard().getPolygons()) {
-        if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
+        if (polygon->getPolygon().getLayerId() == outlinesLayer) {
             ClipperLib::Path path = ClipperHelpers::convert(polygon->getPolygon().getPath(),
                                                             maxArcTolerance());
             boardAreaClipper.AddPath(path, ClipperLib::ptSubject, true);
@@ -126,7 +129,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
     foreach (const BI_Plane* plane, mPlane.getBoard().getPlanes()) {
         if (plane == &mPlane) continue;
         if (*plane < mPlane) continue; // ignore planes with lower priority
-        if (plane->getLayerName() != mPlane.getLayerName()) continue;
+        if (plane->getLayerId() != mPlane.getLayerId()) continue;
         if (&plane->getNetSignal() == &mPlane.getNetSignal()) continue;
         ClipperLib::Paths paths = ClipperHelpers::convert(plane->getFragments(),
                                                           maxArcTolerance());
@@ -134,7 +137,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
         c.AddPaths(paths, ClipperLib::ptClip, true);
     }
 
-    // subtract holes and pads from devices
+    // subtract holes, pads and texts from devices
     foreach (const BI_Device* device, mPlane.getBoard().getDeviceInstances()) {
         for (const Hole& hole : device->getFootprint().getLibFootprint().getHoles()) {
             Point pos = device->getFootprint().mapToScene(hole.getPosition());
@@ -144,7 +147,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
                       ClipperLib::ptClip, true);
         }
         foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
-            if (!pad->isOnLayer(mPlane.getLayerName())) continue;
+            if (!pad->isOnLayer(mPlane.getLayerId())) continue;
             if (pad->getCompSigInstNetSignal() == &mPlane.getNetSignal()) {
                 ClipperLib::Path path = ClipperHelpers::convert(pad->getSceneOutline(),
                                                                 maxArcTolerance());
@@ -152,6 +155,24 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
             }
             c.AddPath(createPadCutOut(*pad), ClipperLib::ptClip, true);
         }
+        const BI_Footprint& footprint = device->getFootprint();
+        GraphicsLayerId fptLayer = footprint.getIsMirrored() ? mPlane.getLayerId().getMirrored()
+                                                             : mPlane.getLayerId();
+        for (const Text& text : footprint.getLibFootprint().getTexts()) {
+            if (text.getLayerId() != fptLayer) continue;
+            Length width = StrokeFont::calcStrokeWidth(text.getHeight())
+                         + mPlane.getMinClearance() * 2;
+            foreach (const Path& path, footprint.getTextPaths(text)) {
+                const QVector<Vertex>& vertices = path.getVertices();
+                for (int i = 1; i < vertices.count(); ++i) {
+                    Path segment = Path::obround(footprint.mapToScene(vertices.at(i-1).getPos()),
+                                                 footprint.mapToScene(vertices.at(i).getPos()),
+                                                 width);
+                    c.AddPath(ClipperHelpers::convert(segment, maxArcTolerance()),
+                              ClipperLib::ptClip, true);
+                }
+            }
+        }
     }
 
     // subtract net segment items
@@ -169,7 +190,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects()
 
         // subtract netlines
         foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-            if (netline->getLayer().getName() != mPlane.getLayerName()) continue;
+            if (netline->getLayer().getId() != mPlane.getLayerId()) continue;
             if (&netsegment->getNetSignal() == &mPlane.getNetSignal()) {
                 ClipperLib::Path path = ClipperHelpers::convert(netline->getSceneOutline(),
                                                                 maxArcTolerance());
@@ -91,6 +91,29 @@ void CmdBoardNetPointEdit::setDeltaToStartPos(const Point& deltaPos, bool immedi
     if (immediate) mNetPoint.setPosition(mNewPos);
 }
 
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+bool CmdBoardNetPointEdit::canMergeWith(const UndoCommand& other) const noexcept
+{
+    const CmdBoardNetPointEdit* cmd = dynamic_cast<const CmdBoardNetPointEdit*>(&other);
+    if ((!cmd) || (&cmd->mNetPoint != &mNetPoint)) return false;
+    // the netpoint must not have been modified in between
+    return (cmd->mOldLayer == mNewLayer) && (cmd->mOldFootprintPad == mNewFootprintPad)
+        && (cmd->mOldVia == mNewVia) && (cmd->mOldPos == mNewPos);
+}
+
+void CmdBoardNetPointEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    Q_ASSERT(canMergeWith(other));
+    const CmdBoardNetPointEdit& cmd = static_cast<const CmdBoardNetPointEdit&>(other);
+    mNewLayer = cmd.mNewLayer;
+    mNewFootprintPad = cmd.mNewFootprintPad;
+    mNewVia = cmd.mNewVia;
+    mNewPos = cmd.mNewPos;
+}
+
 /*****************************************************************************************
  *  Inherited from UndoCommand
  ****************************************************************************************/
@@ -63,6 +63,19 @@ class CmdBoardNetPointEdit final : public UndoCommand
         void setPosition(const Point& pos, bool immediate) noexcept;
         void setDeltaToStartPos(const Point& deltaPos, bool immediate) noexcept;
 
+        // General Methods
+
+        /**
+         * @copydoc UndoCommand::canMergeWith()
+         *
+         * Consecutive edits of the same netpoint (e.g. while dragging it) are merged if
+         * the other command starts at the state where this command ends.
+         */
+        bool canMergeWith(const UndoCommand& other) const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        void mergeWith(const UndoCommand& other) noexcept override;
+
 
     private:
 
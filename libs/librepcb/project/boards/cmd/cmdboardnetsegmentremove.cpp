@@ -51,6 +51,8 @@ CmdBoardNetSegmentRemove::~CmdBoardNetSegmentRemove() noexcept
 
 bool CmdBoardNetSegmentRemove::performExecute()
 {
+    addMemoryUsageOfObject(mNetSegment);
+
     performRedo(); // can throw
 
     return true;
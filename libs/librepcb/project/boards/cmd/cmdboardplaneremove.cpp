@@ -51,6 +51,8 @@ CmdBoardPlaneRemove::~CmdBoardPlaneRemove() noexcept
 
 bool CmdBoardPlaneRemove::performExecute()
 {
+    addMemoryUsageOfObject(mPlane);
+
     performRedo(); // can throw
 
     return true;
@@ -51,6 +51,8 @@ CmdBoardPolygonRemove::~CmdBoardPolygonRemove() noexcept
 
 bool CmdBoardPolygonRemove::performExecute()
 {
+    addMemoryUsageOfObject(mPolygon);
+
     performRedo(); // can throw
 
     return true;
@@ -53,6 +53,8 @@ bool CmdBoardRemove::performExecute()
 {
     mIndex = mProject.getBoardIndex(mBoard);
 
+    addMemoryUsageOfObject(mBoard);
+
     performRedo(); // can throw
 
     return true;
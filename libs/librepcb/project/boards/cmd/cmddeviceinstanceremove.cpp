@@ -51,6 +51,8 @@ CmdDeviceInstanceRemove::~CmdDeviceInstanceRemove() noexcept
 
 bool CmdDeviceInstanceRemove::performExecute()
 {
+    addMemoryUsageOfObject(mDevice);
+
     performRedo(); // can throw
 
     return true;
@@ -32,37 +32,96 @@ namespace librepcb {
 namespace project {
 
 /*****************************************************************************************
- *  Constructors / Destructor
+ *  Class DeferUpdatesGuard
  ****************************************************************************************/
 
-BGI_Base::BGI_Base() noexcept
+BGI_Base::DeferUpdatesGuard::DeferUpdatesGuard(Board& board) noexcept :
+    mBoard(board)
 {
+    ++mBoard.mDeferGraphicsUpdatesCount;
+}
 
+BGI_Base::DeferUpdatesGuard::~DeferUpdatesGuard() noexcept
+{
+    Q_ASSERT(mBoard.mDeferGraphicsUpdatesCount > 0);
+    if (--mBoard.mDeferGraphicsUpdatesCount == 0) {
+        QSet<BGI_Base*> items;
+        items.swap(mBoard.mDirtyGraphicsItems);
+        foreach (BGI_Base* item, items) {
+            item->updateCacheAndRepaint();
+        }
+    }
 }
 
-BGI_Base::~BGI_Base() noexcept
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BGI_Base::BGI_Base(Board& board) noexcept :
+    mBoard(board)
 {
+}
 
+BGI_Base::~BGI_Base() noexcept
+{
+    mBoard.mDirtyGraphicsItems.remove(this);
 }
 
 /*****************************************************************************************
  *  Protected Methods
  ****************************************************************************************/
 
-qreal BGI_Base::getZValueOfCopperLayer(const QString& name) noexcept
+bool BGI_Base::deferUpdateCacheAndRepaint() noexcept
+{
+    // items which are not added to a scene yet (e.g. during construction) are always
+    // updated immediately to get valid cached attributes
+    if ((mBoard.mDeferGraphicsUpdatesCount > 0) && scene()) {
+        mBoard.mDirtyGraphicsItems.insert(this);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+qreal BGI_Base::getZValueOfCopperLayer(const GraphicsLayerId& layer) noexcept
 {
+    // parsing the layer name is slow, so it is done only once per layer (graphics items
+    // are used only in the GUI thread, thus no locking is needed)
+    static QHash<GraphicsLayerId, qreal> zValues;
+    auto it = zValues.constFind(layer);
+    if (it != zValues.constEnd()) {
+        return *it;
+    }
+
+    qreal zValue;
+    const QString& name = layer.getName();
     if (GraphicsLayer::isTopLayer(name)) {
-        return Board::ItemZValue::ZValue_CopperTop;
+        zValue = Board::ItemZValue::ZValue_CopperTop;
     } else if (GraphicsLayer::isBottomLayer(name)) {
-        return Board::ItemZValue::ZValue_CopperBottom;
+        zValue = Board::ItemZValue::ZValue_CopperBottom;
     } else if (GraphicsLayer::isCopperLayer(name)) {
         // 0.0 => TOP
         // 1.0 => BOTTOM
         qreal delta = QString(name).remove("in").remove("_cu").toDouble() / 100.0;
-        return (Board::ItemZValue::ZValue_CopperTop - delta);
+        zValue = Board::ItemZValue::ZValue_CopperTop - delta;
     } else {
-        return Board::ItemZValue::ZValue_Default;
+        zValue = Board::ItemZValue::ZValue_Default;
+    }
+    zValues.insert(layer, zValue);
+    return zValue;
+}
+
+/*****************************************************************************************
+ *  Inherited from QGraphicsItem
+ ****************************************************************************************/
+
+bool BGI_Base::sceneEvent(QEvent* event)
+{
+    if (event->type() == QEvent::GraphicsSceneHelp) {
+        QString text = getToolTipText();
+        if (text != toolTip()) setToolTip(text);
     }
+    return QGraphicsItem::sceneEvent(event);
 }
 
 /*****************************************************************************************
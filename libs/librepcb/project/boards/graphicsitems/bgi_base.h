@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "../board.h"
+#include <librepcb/common/graphics/graphicslayerid.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -44,22 +45,66 @@ class BGI_Base : public QGraphicsItem
 {
     public:
 
+        /**
+         * @brief RAII guard deferring the cache updates of all graphics items of a board
+         *
+         * While a guard exists, updateCacheAndRepaint() of the board's items which are
+         * already added to a scene only marks the item as dirty. When the last guard of
+         * the board is destroyed, all dirty items are updated exactly once.
+         *
+         * This is used to coalesce the many (often redundant) updates which happen while
+         * moving a lot of items at once, e.g. every netline connected to a moved footprint
+         * would otherwise be updated once per moved pad.
+         */
+        class DeferUpdatesGuard final
+        {
+            public:
+                explicit DeferUpdatesGuard(Board& board) noexcept;
+                ~DeferUpdatesGuard() noexcept;
+
+            private:
+                DeferUpdatesGuard() = delete;
+                DeferUpdatesGuard(const DeferUpdatesGuard& other) = delete;
+                DeferUpdatesGuard& operator=(const DeferUpdatesGuard& rhs) = delete;
+
+                Board& mBoard;
+        };
+
         // Constructors / Destructor
-        explicit BGI_Base() noexcept;
+        explicit BGI_Base(Board& board) noexcept;
         virtual ~BGI_Base() noexcept;
 
+        // General Methods
+        virtual void updateCacheAndRepaint() noexcept = 0;
+
 
     protected:
 
-        static qreal getZValueOfCopperLayer(const QString& name) noexcept;
+        bool deferUpdateCacheAndRepaint() noexcept;
+        static qreal getZValueOfCopperLayer(const GraphicsLayerId& layer) noexcept;
+
+        /**
+         * @brief Get the tooltip text of this item
+         *
+         * The text is requested only when the tooltip is about to be shown (see
+         * librepcb::GraphicsScene::helpEvent()), so it is always up to date and does not
+         * need to be updated when the item's state changes.
+         */
+        virtual QString getToolTipText() const noexcept {return QString();}
+
+        // Inherited from QGraphicsItem
+        bool sceneEvent(QEvent* event) override;
 
 
     private:
 
         // make some methods inaccessible...
-        //BGI_Base() = delete;
+        BGI_Base() = delete;
         BGI_Base(const BGI_Base& other) = delete;
         BGI_Base& operator=(const BGI_Base& rhs) = delete;
+
+        // Attributes
+        Board& mBoard;
 };
 
 /*****************************************************************************************
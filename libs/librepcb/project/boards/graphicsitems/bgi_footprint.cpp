@@ -30,7 +30,7 @@
 #include <librepcb/library/pkg/footprint.h>
 #include "../items/bi_device.h"
 #include "../boardlayerstack.h"
-#include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/font/strokefont.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -43,12 +43,10 @@ namespace project {
  ****************************************************************************************/
 
 BGI_Footprint::BGI_Footprint(BI_Footprint& footprint) noexcept :
-    BGI_Base(), mFootprint(footprint), mLibFootprint(footprint.getLibFootprint())
+    BGI_Base(footprint.getBoard()), mFootprint(footprint),
+    mLibFootprint(footprint.getLibFootprint()),
+    mShapeOutdated(true)
 {
-    mFont.setStyleStrategy(QFont::StyleStrategy(QFont::OpenGLCompatible | QFont::PreferQuality));
-    mFont.setStyleHint(QFont::SansSerif);
-    mFont.setFamily("Nimbus Sans L");
-
     updateCacheAndRepaint();
 }
 
@@ -62,7 +60,7 @@ BGI_Footprint::~BGI_Footprint() noexcept
 
 bool BGI_Footprint::isSelectable() const noexcept
 {
-    GraphicsLayer* layer = getLayer(GraphicsLayer::sTopReferences);
+    GraphicsLayer* layer = getLayer(GraphicsLayerId(GraphicsLayer::sTopReferences));
     return layer && layer->isVisible();
 }
 
@@ -72,11 +70,14 @@ bool BGI_Footprint::isSelectable() const noexcept
 
 void BGI_Footprint::updateCacheAndRepaint() noexcept
 {
+    if (deferUpdateCacheAndRepaint()) return;
+
     GraphicsLayer* layer = nullptr;
     prepareGeometryChange();
 
     mBoundingRect = QRectF();
-    mShape = QPainterPath();
+    mGrabAreas.clear();
+    mShapeOutdated = true;
 
     // set Z value
     if (mFootprint.getIsMirrored())
@@ -85,19 +86,21 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
         setZValue(Board::ZValue_FootprintsTop);
 
     // cross rect
-    layer = getLayer(GraphicsLayer::sTopReferences);
+    layer = getLayer(GraphicsLayerId(GraphicsLayer::sTopReferences));
     if (layer) {
         if (layer->isVisible()) {
             qreal width = Length(700000).toPx();
             QRectF crossRect(-width, -width, 2*width, 2*width);
             mBoundingRect = mBoundingRect.united(crossRect);
-            mShape.addRect(crossRect);
+            QPainterPath crossRectPath;
+            crossRectPath.addRect(crossRect);
+            mGrabAreas.append(crossRectPath);
         }
     }
 
     // polygons
     for (const Polygon& polygon : mLibFootprint.getPolygons()) {
-        layer = getLayer(polygon.getLayerName());
+        layer = getLayer(polygon.getLayerId());
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
@@ -105,66 +108,31 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
         qreal w = polygon.getLineWidth().toPx() / 2;
         mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
         if (!polygon.isGrabArea()) continue;
-        layer = getLayer(GraphicsLayer::sTopGrabAreas);
+        layer = getLayer(GraphicsLayerId(GraphicsLayer::sTopGrabAreas));
         if (!layer) continue;
         if (!layer->isVisible()) continue;
-        mShape = mShape.united(polygonPath);
+        mGrabAreas.append(polygonPath);
     }
 
     // texts
     mCachedTextProperties.clear();
     for (const Text& text : mLibFootprint.getTexts()) {
-        layer = getLayer(text.getLayerName());
+        layer = getLayer(text.getLayerId());
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
-        // create static text properties
+        // the stroke paths are cached by the footprint, so this is cheap
         CachedTextProperties_t props;
-
-        // get the text to display
-        props.text = AttributeSubstitutor::substitute(text.getText(), &mFootprint);
-
-        // calculate font metrics
-        props.fontPixelSize = qCeil(text.getHeight().toPx());
-        mFont.setPixelSize(props.fontPixelSize);
-        QFontMetricsF metrics(mFont);
-        props.scaleFactor = text.getHeight().toPx() / metrics.height();
-        props.textRect = metrics.boundingRect(QRectF(), text.getAlign().toQtAlign() |
-                                              Qt::TextDontClip, props.text);
-        QRectF scaledTextRect = QRectF(props.textRect.topLeft() * props.scaleFactor,
-                                       props.textRect.bottomRight() * props.scaleFactor);
-
-        // check rotation
-        Angle absAngle = text.getRotation() + mFootprint.getRotation();
-        absAngle.mapTo180deg();
-        props.rotate180 = (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
-
-        // calculate text position
-        scaledTextRect.translate(text.getPosition().toPxQPointF());
-
-        // text alignment
-        if (props.rotate180)
-            props.flags = text.getAlign().mirrored().toQtAlign();
-        else
-            props.flags = text.getAlign().toQtAlign();
-
-        // calculate text bounding rect
-        mBoundingRect = mBoundingRect.united(scaledTextRect);
-        props.textRect = QRectF(scaledTextRect.topLeft() / props.scaleFactor,
-                                scaledTextRect.bottomRight() / props.scaleFactor);
-        if (props.rotate180)
-        {
-            props.textRect = QRectF(-props.textRect.x(), -props.textRect.y(),
-                                    -props.textRect.width(), -props.textRect.height()).normalized();
-        }
+        props.path = Path::toQPainterPathPx(mFootprint.getTextPaths(text).toList());
+        props.strokeWidth = StrokeFont::calcStrokeWidth(text.getHeight()).toPx();
+        qreal w = props.strokeWidth / 2;
+        props.boundingRect = props.path.boundingRect().adjusted(-w, -w, w, w);
+        mBoundingRect = mBoundingRect.united(props.boundingRect);
 
         // save properties
         mCachedTextProperties.insert(&text, props);
     }
 
-    if (!mShape.isEmpty())
-        mShape.setFillRule(Qt::WindingFill);
-
     setVisible(!mBoundingRect.isEmpty());
 
     update();
@@ -174,6 +142,22 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
 
+QPainterPath BGI_Footprint::shape() const noexcept
+{
+    // uniting the grab areas is expensive and only needed for hit-testing, so the shape
+    // is built on demand
+    if (mShapeOutdated) {
+        mShape = QPainterPath();
+        foreach (const QPainterPath& area, mGrabAreas) {
+            mShape = mShape.united(area);
+        }
+        if (!mShape.isEmpty())
+            mShape.setFillRule(Qt::WindingFill);
+        mShapeOutdated = false;
+    }
+    return mShape;
+}
+
 void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
     Q_UNUSED(widget);
@@ -182,11 +166,12 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     const bool selected = mFootprint.isSelected();
     const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
     const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const GraphicsLayer* grabAreaLayer = getLayer(GraphicsLayerId(GraphicsLayer::sTopGrabAreas));
 
     // draw all polygons
     for (const Polygon& polygon : mLibFootprint.getPolygons()) {
         // get layer
-        layer = getLayer(polygon.getLayerName());
+        layer = getLayer(polygon.getLayerId());
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
@@ -199,7 +184,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         // set brush
         if (!polygon.isFilled()) {
             if (polygon.isGrabArea())
-                layer = getLayer(GraphicsLayer::sTopGrabAreas);
+                layer = grabAreaLayer;
             else
                 layer = nullptr;
         }
@@ -219,7 +204,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     // draw all ellipses
     for (const Ellipse& ellipse : mLibFootprint.getEllipses()) {
         // get layer
-        layer = getLayer(ellipse.getLayerName());
+        layer = getLayer(ellipse.getLayerId());
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
@@ -232,7 +217,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         // set brush
         if (!ellipse.isFilled()) {
             if (ellipse.isGrabArea())
-                layer = getLayer(GraphicsLayer::sTopGrabAreas);
+                layer = grabAreaLayer;
             else
                 layer = nullptr;
         }
@@ -245,7 +230,10 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
             painter->setBrush(Qt::NoBrush);
         }
 
-        // draw ellipse
+        // draw ellipse (skip it if it is smaller than a pixel)
+        qreal ellipseSize = 2 * qMax(ellipse.getRadiusX(), ellipse.getRadiusY()).toPx()
+                          + ellipse.getLineWidth().toPx();
+        if ((!deviceIsPrinter) && (lod * ellipseSize < 1)) continue;
         painter->drawEllipse(ellipse.getCenter().toPxQPointF(), ellipse.getRadiusX().toPx(),
                              ellipse.getRadiusY().toPx());
         // TODO: rotation
@@ -254,65 +242,67 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     // draw all texts
     for (const Text& text : mLibFootprint.getTexts()) {
         // get layer
-        layer = getLayer(text.getLayerName());
+        layer = getLayer(text.getLayerId());
         if (!layer) continue;
         if (!layer->isVisible()) continue;
 
+        // skip texts which are too small to be visible at all
+        if ((!deviceIsPrinter) && (lod * text.getHeight().toPx() < 2)) continue;
+
         // get cached text properties
         const CachedTextProperties_t& props = mCachedTextProperties.value(&text);
-        mFont.setPixelSize(props.fontPixelSize);
 
         // draw text or rect
-        painter->save();
-        painter->translate(text.getPosition().toPxQPointF());
-        painter->rotate(-text.getRotation().toDeg());
-        painter->translate(-text.getPosition().toPxQPointF());
-        painter->scale(props.scaleFactor, props.scaleFactor);
-        if (props.rotate180) painter->rotate(180);
         if ((deviceIsPrinter) || (lod * text.getHeight().toPx() > 8))
         {
             // draw text
-            painter->setPen(QPen(layer->getColor(selected), 0));
-            painter->setFont(mFont);
-            painter->drawText(props.textRect, props.flags, props.text);
+            painter->setPen(QPen(layer->getColor(selected), props.strokeWidth, Qt::SolidLine,
+                                 Qt::RoundCap, Qt::RoundJoin));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawPath(props.path);
         }
         else
         {
             // fill rect
-            painter->fillRect(props.textRect, QBrush(layer->getColor(selected), Qt::Dense5Pattern));
+            painter->fillRect(props.boundingRect, QBrush(layer->getColor(selected), Qt::Dense5Pattern));
         }
 #ifdef QT_DEBUG
-        layer = getLayer(GraphicsLayer::sDebugGraphicsItemsTextsBoundingRects);
+        layer = getLayer(GraphicsLayerId(GraphicsLayer::sDebugGraphicsItemsTextsBoundingRects));
         if (layer) {
             if (layer->isVisible()) {
                 // draw text bounding rect
                 painter->setPen(QPen(layer->getColor(selected), 0));
                 painter->setBrush(Qt::NoBrush);
-                painter->drawRect(props.textRect);
+                painter->drawRect(props.boundingRect);
             }
         }
 #endif
-        painter->restore();
     }
 
     // draw all holes
+    layer = getLayer(GraphicsLayerId(GraphicsLayer::sBoardDrillsNpth));
     for (const Hole& hole : mLibFootprint.getHoles()) {
-        // get layer
-        layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
-        if (!layer) continue;
-        if (!layer->isVisible()) continue;
+        // check layer
+        if (!layer) break;
+        if (!layer->isVisible()) break;
 
         // set pen/brush
         painter->setPen(Qt::NoPen);
         painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
 
-        // draw hole
+        // draw hole (tiny holes are drawn as rects, which is much cheaper)
         qreal radius = (hole.getDiameter() / 2).toPx();
-        painter->drawEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+        if ((deviceIsPrinter) || (lod * radius > 2)) {
+            painter->drawEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+        } else {
+            QPointF center = hole.getPosition().toPxQPointF();
+            painter->drawRect(QRectF(center.x() - radius, center.y() - radius,
+                                     2 * radius, 2 * radius));
+        }
     }
 
     // draw origin cross
-    layer = getLayer(GraphicsLayer::sTopReferences);
+    layer = getLayer(GraphicsLayerId(GraphicsLayer::sTopReferences));
     if (layer) {
         if ((!deviceIsPrinter) && layer->isVisible()) {
             qreal width = Length(700000).toPx();
@@ -324,7 +314,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
 
 #ifdef QT_DEBUG
     // draw bounding rect
-    layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+    layer = getLayer(GraphicsLayerId(GraphicsLayer::sDebugGraphicsItemsBoundingRects));
     if (layer) {
         if (layer->isVisible()) {
             painter->setPen(QPen(layer->getColor(selected), 0));
@@ -339,10 +329,10 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_Footprint::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_Footprint::getLayer(const GraphicsLayerId& layer) const noexcept
 {
-    if (mFootprint.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mFootprint.getDeviceInstance().getBoard().getLayerStack().getLayer(name);
+    GraphicsLayerId id = mFootprint.getIsMirrored() ? layer.getMirrored() : layer;
+    return mFootprint.getDeviceInstance().getBoard().getLayerStack().getLayer(id);
 }
 
 /*****************************************************************************************
@@ -69,7 +69,7 @@ class BGI_Footprint final : public BGI_Base
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept {return mBoundingRect;}
-        QPainterPath shape() const noexcept {return mShape;}
+        QPainterPath shape() const noexcept;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0);
 
 
@@ -81,29 +81,27 @@ class BGI_Footprint final : public BGI_Base
         BGI_Footprint& operator=(const BGI_Footprint& rhs) = delete;
 
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const GraphicsLayerId& layer) const noexcept;
 
 
         // Types
 
         struct CachedTextProperties_t {
-            QString text;
-            int fontPixelSize;
-            qreal scaleFactor;
-            bool rotate180;
-            int flags;
-            QRectF textRect;    // not scaled
+            QPainterPath path;      // stroke font paths
+            qreal strokeWidth;
+            QRectF boundingRect;    // including the stroke width
         };
 
 
         // General Attributes
         BI_Footprint& mFootprint;
         const library::Footprint& mLibFootprint;
-        QFont mFont;
 
         // Cached Attributes
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        QVector<QPainterPath> mGrabAreas; ///< united to the shape on demand
+        mutable QPainterPath mShape;
+        mutable bool mShapeOutdated;
         QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
 };
 
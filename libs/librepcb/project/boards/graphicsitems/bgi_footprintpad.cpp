@@ -47,12 +47,10 @@ namespace project {
  ****************************************************************************************/
 
 BGI_FootprintPad::BGI_FootprintPad(BI_FootprintPad& pad) noexcept :
-    BGI_Base(), mPad(pad), mLibPad(pad.getLibPad()), mPadLayer(nullptr),
+    BGI_Base(pad.getBoard()), mPad(pad), mLibPad(pad.getLibPad()), mPadLayer(nullptr),
     mTopStopMaskLayer(nullptr), mBottomStopMaskLayer(nullptr),
     mTopCreamMaskLayer(nullptr), mBottomCreamMaskLayer(nullptr)
 {
-    setToolTip(mPad.getDisplayText());
-
     mFont.setStyleStrategy(QFont::StyleStrategy(QFont::OpenGLCompatible | QFont::PreferQuality));
     mFont.setStyleHint(QFont::SansSerif);
     mFont.setFamily("Helvetica");
@@ -80,6 +78,8 @@ bool BGI_FootprintPad::isSelectable() const noexcept
 
 void BGI_FootprintPad::updateCacheAndRepaint() noexcept
 {
+    if (deferUpdateCacheAndRepaint()) return;
+
     prepareGeometryChange();
 
     // set Z value
@@ -90,21 +90,21 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
     }
 
     // set layers
-    mPadLayer = getLayer(mLibPad.getLayerName());
+    mPadLayer = getLayer(mLibPad.getLayerId());
     if (mLibPad.getBoardSide() == library::FootprintPad::BoardSide::THT) {
-        mTopStopMaskLayer = getLayer(GraphicsLayer::sTopStopMask);
-        mBottomStopMaskLayer = getLayer(GraphicsLayer::sBotStopMask);
+        mTopStopMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sTopStopMask));
+        mBottomStopMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sBotStopMask));
         mTopCreamMaskLayer = nullptr;
         mBottomCreamMaskLayer = nullptr;
     } else if (mLibPad.getBoardSide() == library::FootprintPad::BoardSide::BOTTOM) {
         mTopStopMaskLayer = nullptr;
-        mBottomStopMaskLayer = getLayer(GraphicsLayer::sBotStopMask);
+        mBottomStopMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sBotStopMask));
         mTopCreamMaskLayer = nullptr;
-        mBottomCreamMaskLayer = getLayer(GraphicsLayer::sBotSolderPaste);
+        mBottomCreamMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sBotSolderPaste));
     } else {
-        mTopStopMaskLayer = getLayer(GraphicsLayer::sTopStopMask);
+        mTopStopMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sTopStopMask));
         mBottomStopMaskLayer = nullptr;
-        mTopCreamMaskLayer = getLayer(GraphicsLayer::sTopSolderPaste);
+        mTopCreamMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sTopSolderPaste));
         mBottomCreamMaskLayer = nullptr;
     }
 
@@ -129,14 +129,22 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
 
 void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
-    //const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
-    //const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
 
     const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
     bool highlight = mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+    // level of detail: if the whole pad is only a few pixels large, its exact shape and
+    // text are not recognizable anyway, so just fill the pad's bounding rect
+    if ((!deviceIsPrinter) && (lod * qMax(mBoundingRect.width(), mBoundingRect.height()) < 3)) {
+        if (mPadLayer && mPadLayer->isVisible()) {
+            painter->fillRect(mCopper.boundingRect(), mPadLayer->getColor(highlight));
+        }
+        return;
+    }
+
     if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
         // draw bottom cream mask
         painter->setPen(Qt::NoPen);
@@ -156,10 +164,12 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
         painter->setPen(Qt::NoPen);
         painter->setBrush(mPadLayer->getColor(highlight));
         painter->drawPath(mCopper);
-        // draw pad text
-        painter->setFont(mFont);
-        painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-        painter->drawText(mShape.boundingRect(), Qt::AlignCenter, mPad.getDisplayText());
+        // draw pad text (only if it is large enough to be readable)
+        if ((deviceIsPrinter) || (lod * mFont.pixelSize() > 4)) {
+            painter->setFont(mFont);
+            painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+            painter->drawText(mShape.boundingRect(), Qt::AlignCenter, mPad.getDisplayText());
+        }
     }
 
     if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
@@ -177,7 +187,7 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
     }
 
 #ifdef QT_DEBUG
-    GraphicsLayer* layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+    GraphicsLayer* layer = getLayer(GraphicsLayerId(GraphicsLayer::sDebugGraphicsItemsBoundingRects));
     if (layer) {
         if (layer->isVisible()) {
             // draw bounding rect
@@ -189,14 +199,23 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
 #endif
 }
 
+/*****************************************************************************************
+ *  Inherited from BGI_Base
+ ****************************************************************************************/
+
+QString BGI_FootprintPad::getToolTipText() const noexcept
+{
+    return mPad.getDisplayText();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_FootprintPad::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_FootprintPad::getLayer(const GraphicsLayerId& layer) const noexcept
 {
-    if (mPad.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mPad.getFootprint().getDeviceInstance().getBoard().getLayerStack().getLayer(name);
+    GraphicsLayerId id = mPad.getIsMirrored() ? layer.getMirrored() : layer;
+    return mPad.getFootprint().getDeviceInstance().getBoard().getLayerStack().getLayer(id);
 }
 
 /*****************************************************************************************
@@ -80,8 +80,11 @@ class BGI_FootprintPad final : public BGI_Base
         BGI_FootprintPad(const BGI_FootprintPad& other) = delete;
         BGI_FootprintPad& operator=(const BGI_FootprintPad& rhs) = delete;
 
+        // Inherited from BGI_Base
+        QString getToolTipText() const noexcept override;
+
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const GraphicsLayerId& layer) const noexcept;
 
 
         // General Attributes
@@ -42,7 +42,7 @@ namespace project {
  ****************************************************************************************/
 
 BGI_NetLine::BGI_NetLine(BI_NetLine& netline) noexcept :
-    BGI_Base(), mNetLine(netline), mLayer(nullptr)
+    BGI_Base(netline.getBoard()), mNetLine(netline), mLayer(nullptr), mShapeOutdated(true)
 {
     updateCacheAndRepaint();
 }
@@ -66,12 +66,12 @@ bool BGI_NetLine::isSelectable() const noexcept
 
 void BGI_NetLine::updateCacheAndRepaint() noexcept
 {
-    setToolTip(mNetLine.getNetSignalOfNetSegment().getName());
+    if (deferUpdateCacheAndRepaint()) return;
 
     prepareGeometryChange();
 
     // set Z value
-    setZValue(getZValueOfCopperLayer(mNetLine.getLayer().getName()));
+    setZValue(getZValueOfCopperLayer(mNetLine.getLayer().getId()));
 
     mLayer = &mNetLine.getLayer();
     Q_ASSERT(mLayer);
@@ -81,14 +81,7 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
     mBoundingRect = QRectF(mLineF.p1(), mLineF.p2()).normalized();
     mBoundingRect.adjust(-mNetLine.getWidth().toPx()/2, -mNetLine.getWidth().toPx()/2,
                          mNetLine.getWidth().toPx()/2, mNetLine.getWidth().toPx()/2);
-    mShape = QPainterPath();
-    mShape.moveTo(mNetLine.getStartPoint().getPosition().toPxQPointF());
-    mShape.lineTo(mNetLine.getEndPoint().getPosition().toPxQPointF());
-    QPainterPathStroker ps;
-    ps.setCapStyle(Qt::RoundCap);
-    Length width = (mNetLine.getWidth() > Length(100000) ? mNetLine.getWidth() : Length(100000));
-    ps.setWidth(width.toPx());
-    mShape = ps.createStroke(mShape);
+    mShapeOutdated = true;
     update();
 }
 
@@ -96,6 +89,23 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
 
+QPainterPath BGI_NetLine::shape() const
+{
+    // the shape is only needed for hit-testing, so it is built on demand
+    if (mShapeOutdated) {
+        QPainterPath path;
+        path.moveTo(mLineF.p1());
+        path.lineTo(mLineF.p2());
+        QPainterPathStroker ps;
+        ps.setCapStyle(Qt::RoundCap);
+        Length width = (mNetLine.getWidth() > Length(100000) ? mNetLine.getWidth() : Length(100000));
+        ps.setWidth(width.toPx());
+        mShape = ps.createStroke(path);
+        mShapeOutdated = false;
+    }
+    return mShape;
+}
+
 void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
     Q_UNUSED(option);
@@ -112,7 +122,7 @@ void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
     }
 
 #ifdef QT_DEBUG
-    GraphicsLayer* layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects); Q_ASSERT(layer);
+    GraphicsLayer* layer = getLayer(GraphicsLayerId(GraphicsLayer::sDebugGraphicsItemsBoundingRects)); Q_ASSERT(layer);
     if (layer->isVisible())
     {
         // draw bounding rect
@@ -123,13 +133,22 @@ void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
 #endif
 }
 
+/*****************************************************************************************
+ *  Inherited from BGI_Base
+ ****************************************************************************************/
+
+QString BGI_NetLine::getToolTipText() const noexcept
+{
+    return mNetLine.getNetSignalOfNetSegment().getName();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_NetLine::getLayer(const QString& name) const noexcept
+GraphicsLayer* BGI_NetLine::getLayer(const GraphicsLayerId& layer) const noexcept
 {
-    return mNetLine.getBoard().getLayerStack().getLayer(name);
+    return mNetLine.getBoard().getLayerStack().getLayer(layer);
 }
 
 /*****************************************************************************************
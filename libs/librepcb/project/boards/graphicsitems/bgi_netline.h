@@ -61,7 +61,7 @@ class BGI_NetLine final : public BGI_Base
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const {return mBoundingRect;}
-        QPainterPath shape() const {return mShape;}
+        QPainterPath shape() const;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
 
 
@@ -72,8 +72,11 @@ class BGI_NetLine final : public BGI_Base
         BGI_NetLine(const BGI_NetLine& other) = delete;
         BGI_NetLine& operator=(const BGI_NetLine& rhs) = delete;
 
+        // Inherited from BGI_Base
+        QString getToolTipText() const noexcept override;
+
         // Private Methods
-        GraphicsLayer* getLayer(const QString& name) const noexcept;
+        GraphicsLayer* getLayer(const GraphicsLayerId& layer) const noexcept;
 
         // Attributes
         BI_NetLine& mNetLine;
@@ -82,7 +85,8 @@ class BGI_NetLine final : public BGI_Base
         // Cached Attributes
         QLineF mLineF;
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        mutable QPainterPath mShape; ///< built on demand, see shape()
+        mutable bool mShapeOutdated;
 };
 
 /*****************************************************************************************
@@ -41,7 +41,7 @@ namespace project {
  ****************************************************************************************/
 
 BGI_NetPoint::BGI_NetPoint(BI_NetPoint& netpoint) noexcept :
-    BGI_Base(), mNetPoint(netpoint)
+    BGI_Base(netpoint.getBoard()), mNetPoint(netpoint)
 {
     updateCacheAndRepaint();
 }
@@ -65,12 +65,12 @@ bool BGI_NetPoint::isSelectable() const noexcept
 
 void BGI_NetPoint::updateCacheAndRepaint() noexcept
 {
-    setToolTip(mNetPoint.getNetSignalOfNetSegment().getName());
+    if (deferUpdateCacheAndRepaint()) return;
 
     prepareGeometryChange();
 
     // set Z value
-    setZValue(getZValueOfCopperLayer(mNetPoint.getLayer().getName()));
+    setZValue(getZValueOfCopperLayer(mNetPoint.getLayer().getId()));
 
     qreal radius = mNetPoint.getMaxLineWidth().toPx() / 2;
     mBoundingRect = QRectF(-radius, -radius, 2*radius, 2*radius);
@@ -90,7 +90,7 @@ void BGI_NetPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     bool highlight = mNetPoint.isSelected() || mNetPoint.getNetSignalOfNetSegment().isHighlighted();
 
 #ifdef QT_DEBUG
-    GraphicsLayer* layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects); Q_ASSERT(layer);
+    GraphicsLayer* layer = getLayer(GraphicsLayerId(GraphicsLayer::sDebugGraphicsItemsBoundingRects)); Q_ASSERT(layer);
     if (layer->isVisible())
     {
         // draw bounding rect
@@ -104,13 +104,22 @@ void BGI_NetPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
 #endif
 }
 
+/*****************************************************************************************
+ *  Inherited from BGI_Base
+ ****************************************************************************************/
+
+QString BGI_NetPoint::getToolTipText() const noexcept
+{
+    return mNetPoint.getNetSignalOfNetSegment().getName();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_NetPoint::getLayer(const QString& name) const noexcept
+GraphicsLayer* BGI_NetPoint::getLayer(const GraphicsLayerId& layer) const noexcept
 {
-    return mNetPoint.getBoard().getLayerStack().getLayer(name);
+    return mNetPoint.getBoard().getLayerStack().getLayer(layer);
 }
 
 /*****************************************************************************************
@@ -71,8 +71,11 @@ class BGI_NetPoint final : public BGI_Base
         BGI_NetPoint(const BGI_NetPoint& other) = delete;
         BGI_NetPoint& operator=(const BGI_NetPoint& rhs) = delete;
 
+        // Inherited from BGI_Base
+        QString getToolTipText() const noexcept override;
+
         // Private Methods
-        GraphicsLayer* getLayer(const QString& name) const noexcept;
+        GraphicsLayer* getLayer(const GraphicsLayerId& layer) const noexcept;
 
 
         // General Attributes
@@ -42,13 +42,17 @@ namespace project {
  ****************************************************************************************/
 
 BGI_Plane::BGI_Plane(BI_Plane& plane) noexcept :
-    BGI_Base(), mPlane(plane), mLayer(nullptr)
+    BGI_Base(plane.getBoard()), mPlane(plane), mLayer(nullptr), mShapeOutdated(true)
 {
+    // needed to get the exposed rect in paint(), only visible tiles are rendered
+    setFlag(QGraphicsItem::ItemUsesExtendedStyleOption, true);
+
     updateCacheAndRepaint();
 }
 
 BGI_Plane::~BGI_Plane() noexcept
 {
+    invalidateTiles(QRectF()); // remove all tiles of this plane from the shared cache
 }
 
 /*****************************************************************************************
@@ -60,30 +64,56 @@ bool BGI_Plane::isSelectable() const noexcept
     return mLayer && mLayer->isVisible();
 }
 
+int BGI_Plane::getCachedTilesCount(const QRectF& rect) const noexcept
+{
+    int count = 0;
+    foreach (const TileKey& key, getTileCache().keys()) {
+        if (key.plane != this) continue;
+        qreal tileSize = getTileSceneSize(key.bucket);
+        QRectF tileRect(key.x * tileSize, key.y * tileSize, tileSize, tileSize);
+        if (tileRect.intersects(rect)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
 void BGI_Plane::updateCacheAndRepaint() noexcept
 {
+    if (deferUpdateCacheAndRepaint()) return;
+
     prepareGeometryChange();
 
-    setZValue(getZValueOfCopperLayer(mPlane.getLayerName()));
+    setZValue(getZValueOfCopperLayer(mPlane.getLayerId()));
 
-    mLayer = getLayer(mPlane.getLayerName());
+    mLayer = getLayer(mPlane.getLayerId()); // tiles of other colors are not reused
 
     // set shape and bounding rect
     mOutline = mPlane.getOutline().toQPainterPathPx(true); // always return a closed path
-    mShape = mShape = Toolbox::shapeFromPath(mOutline, QPen(Length::fromMm(0.3).toPx()), QBrush());
-    mBoundingRect = mShape.boundingRect();
+    qreal w = Length::fromMm(0.3).toPx(); // full shape stroke width to include miter joins
+    mBoundingRect = mOutline.boundingRect().adjusted(-w, -w, w, w);
+    mShapeOutdated = true;
 
     // get areas
+    QVector<QPainterPath> oldAreas = mAreas;
     mAreas.clear();
+    mSimplifiedAreas.clear();
     for (const Path& r : mPlane.getFragments()) {
         mAreas.append(r.toQPainterPathPx());
         mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
     }
 
+    // invalidate only the tiles covered by added or removed areas
+    QRectF changedRect = getChangedAreasRect(oldAreas, mAreas)
+        .united(getChangedAreasRect(mAreas, oldAreas));
+    if (!changedRect.isEmpty()) {
+        invalidateTiles(changedRect);
+    }
+
     update();
 }
 
@@ -91,14 +121,23 @@ void BGI_Plane::updateCacheAndRepaint() noexcept
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
 
+QPainterPath BGI_Plane::shape() const noexcept
+{
+    // the shape is only needed for hit-testing, so it is built on demand
+    if (mShapeOutdated) {
+        mShape = Toolbox::shapeFromPath(mOutline, QPen(Length::fromMm(0.3).toPx()), QBrush());
+        mShapeOutdated = false;
+    }
+    return mShape;
+}
+
 void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
     Q_UNUSED(widget);
 
     const bool selected = mPlane.isSelected();
-    //const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
     const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
-    Q_UNUSED(option);
 
     if (mLayer && mLayer->isVisible()) {
         // draw outline
@@ -107,17 +146,21 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
         painter->drawPath(mOutline);
 
         // draw plane
-        painter->setPen(Qt::NoPen);
-        painter->setBrush(mLayer->getColor(selected));
-        foreach (const QPainterPath& area, mAreas) {
-            painter->drawPath(area);
+        if (deviceIsPrinter) {
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(mLayer->getColor(selected));
+            foreach (const QPainterPath& area, mAreas) {
+                painter->drawPath(area);
+            }
+        } else {
+            paintTiles(*painter, option->exposedRect, lod, mLayer->getColor(selected));
         }
     }
 
 #ifdef QT_DEBUG
     // draw bounding rect
-    const GraphicsLayer* layer = mPlane.getBoard().getLayerStack().getLayer(
-        GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+    const GraphicsLayer* layer = getLayer(
+        GraphicsLayerId(GraphicsLayer::sDebugGraphicsItemsBoundingRects));
     if (layer) {
         if (layer->isVisible()) {
             painter->setPen(QPen(layer->getColor(selected), 0));
@@ -132,10 +175,208 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_Plane::getLayer(QString name) const noexcept
+GraphicsLayer* BGI_Plane::getLayer(const GraphicsLayerId& layer) const noexcept
+{
+    GraphicsLayerId id = mPlane.getIsMirrored() ? layer.getMirrored() : layer;
+    return mPlane.getBoard().getLayerStack().getLayer(id);
+}
+
+const QVector<QPainterPath>& BGI_Plane::getAreasForLod(qreal lod) const noexcept
+{
+    // When zoomed in, the full resolution areas are needed. When zoomed out, planes with
+    // thousands of vertices (e.g. around many pads or arcs) are drawn from a simplified
+    // copy which is cached per power-of-two LOD bucket. The tolerance is chosen so that
+    // the deviation is at most half a device pixel for every LOD within the bucket.
+    if ((lod <= 0) || (lod >= 1)) {
+        return mAreas;
+    }
+    int bucket = qFloor(std::log2(lod));
+    auto it = mSimplifiedAreas.constFind(bucket);
+    if (it == mSimplifiedAreas.constEnd()) {
+        qreal tolerance = 0.5 / std::pow(2.0, bucket + 1);
+        QVector<QPainterPath> areas;
+        areas.reserve(mAreas.count());
+        foreach (const QPainterPath& area, mAreas) {
+            QPainterPath simplified = simplifyPath(area, tolerance);
+            if (!simplified.isEmpty()) {
+                areas.append(simplified);
+            }
+        }
+        it = mSimplifiedAreas.insert(bucket, areas);
+    }
+    return *it;
+}
+
+void BGI_Plane::paintTiles(QPainter& painter, const QRectF& exposedRect, qreal lod,
+                           const QColor& color) noexcept
+{
+    // The areas are rasterized into tiles of a fixed device pixel size, once per zoom
+    // bucket and color. Tiles are rendered with a scale factor of at least the current
+    // LOD, so they are only ever scaled down (by less than factor two) when compositing
+    // them.
+    if (lod <= 0) return;
+    QRectF rect = exposedRect.intersected(mBoundingRect);
+    if (rect.isEmpty()) return;
+    int bucket = qCeil(std::log2(lod));
+    qreal tileSize = getTileSceneSize(bucket);
+    int firstColumn = qFloor(rect.left() / tileSize);
+    int lastColumn = qFloor(rect.right() / tileSize);
+    int firstRow = qFloor(rect.top() / tileSize);
+    int lastRow = qFloor(rect.bottom() / tileSize);
+
+    // Without rotation, the tiles are drawn in device coordinates with their edges
+    // rounded to whole pixels. Adjacent tiles then share exactly the same edge, so there
+    // are no antialiasing seams between them.
+    QTransform transform = painter.worldTransform();
+    bool alignToPixels = (transform.type() <= QTransform::TxScale);
+
+    QCache<TileKey, QImage>& cache = getTileCache();
+    painter.save();
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    if (alignToPixels) {
+        painter.resetTransform();
+    }
+    for (int y = firstRow; y <= lastRow; ++y) {
+        for (int x = firstColumn; x <= lastColumn; ++x) {
+            TileKey key{this, color.rgba(), bucket, x, y};
+            QImage* tile = cache.object(key);
+            if (!tile) {
+                tile = new QImage(renderTile(key));
+                cache.insert(key, tile, qMax(1, tile->byteCount() / 1024));
+            }
+            if (tile->isNull()) {
+                continue;
+            }
+            QRectF tileRect(x * tileSize, y * tileSize, tileSize, tileSize);
+            if (alignToPixels) {
+                QRectF deviceRect = transform.mapRect(tileRect);
+                QRect target(QPoint(qRound(deviceRect.left()), qRound(deviceRect.top())),
+                             QPoint(qRound(deviceRect.right()) - 1,
+                                    qRound(deviceRect.bottom()) - 1));
+                painter.drawImage(target, *tile);
+            } else {
+                painter.drawImage(tileRect, *tile);
+            }
+        }
+    }
+    painter.restore();
+}
+
+QImage BGI_Plane::renderTile(const TileKey& key) const noexcept
+{
+    qreal tileSize = getTileSceneSize(key.bucket);
+    QRectF tileRect(key.x * tileSize, key.y * tileSize, tileSize, tileSize);
+    qreal scale = sTileSizePx / tileSize;
+
+    // empty tiles are represented by a null image to save memory
+    const QVector<QPainterPath>& areas = getAreasForLod(scale);
+    QVector<const QPainterPath*> visibleAreas;
+    foreach (const QPainterPath& area, areas) {
+        if (area.boundingRect().intersects(tileRect)) {
+            visibleAreas.append(&area);
+        }
+    }
+    if (visibleAreas.isEmpty()) return QImage();
+
+    QImage image(sTileSizePx, sTileSizePx, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor::fromRgba(key.color));
+    painter.scale(scale, scale);
+    painter.translate(-tileRect.topLeft());
+    foreach (const QPainterPath* area, visibleAreas) {
+        painter.drawPath(*area);
+    }
+    return image;
+}
+
+void BGI_Plane::invalidateTiles(const QRectF& rect) const noexcept
+{
+    // a null rect invalidates all tiles of this plane
+    QCache<TileKey, QImage>& cache = getTileCache();
+    foreach (const TileKey& key, cache.keys()) {
+        if (key.plane != this) continue;
+        qreal tileSize = getTileSceneSize(key.bucket);
+        qreal margin = tileSize / sTileSizePx; // one pixel, because of antialiasing
+        QRectF tileRect(key.x * tileSize, key.y * tileSize, tileSize, tileSize);
+        if (rect.isNull() ||
+            tileRect.adjusted(-margin, -margin, margin, margin).intersects(rect)) {
+            cache.remove(key);
+        }
+    }
+}
+
+QRectF BGI_Plane::getChangedAreasRect(const QVector<QPainterPath>& areas,
+                                      const QVector<QPainterPath>& otherAreas) noexcept
+{
+    // returns the bounding rect of all areas which are not contained in otherAreas,
+    // the areas are looked up by a hash of their vertices to avoid O(n^2) comparisons
+    auto hashArea = [](const QPainterPath& area) {
+        uint hash = ::qHash(area.elementCount());
+        for (int i = 0; i < area.elementCount(); ++i) {
+            const QPainterPath::Element& e = area.elementAt(i);
+            hash = (hash * 31) ^ ::qHash(qRound64(e.x * 1000))
+                ^ (::qHash(qRound64(e.y * 1000)) << 1);
+        }
+        return hash;
+    };
+    QMultiHash<uint, const QPainterPath*> index;
+    index.reserve(otherAreas.count());
+    for (int i = 0; i < otherAreas.count(); ++i) {
+        index.insert(hashArea(otherAreas.at(i)), &otherAreas.at(i));
+    }
+    QRectF rect;
+    foreach (const QPainterPath& area, areas) {
+        bool found = false;
+        foreach (const QPainterPath* other, index.values(hashArea(area))) {
+            if (*other == area) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            rect = rect.united(area.boundingRect());
+        }
+    }
+    return rect;
+}
+
+QPainterPath BGI_Plane::simplifyPath(const QPainterPath& path, qreal tolerance) noexcept
+{
+    // radial distance decimation: drop all vertices which are closer than the tolerance to
+    // the previously kept vertex (arcs are flattened by toSubpathPolygons() before)
+    QPainterPath simplified;
+    simplified.setFillRule(path.fillRule());
+    foreach (const QPolygonF& polygon, path.toSubpathPolygons()) {
+        QPolygonF decimated;
+        decimated.reserve(polygon.count());
+        foreach (const QPointF& point, polygon) {
+            if (decimated.isEmpty() ||
+                (QLineF(decimated.last(), point).length() >= tolerance)) {
+                decimated.append(point);
+            }
+        }
+        if (decimated.count() >= 3) {
+            simplified.addPolygon(decimated);
+            simplified.closeSubpath();
+        }
+    }
+    return simplified;
+}
+
+qreal BGI_Plane::getTileSceneSize(int bucket) noexcept
+{
+    return sTileSizePx / std::pow(2.0, bucket);
+}
+
+QCache<BGI_Plane::TileKey, QImage>& BGI_Plane::getTileCache() noexcept
 {
-    if (mPlane.getIsMirrored()) name = GraphicsLayer::getMirroredLayerName(name);
-    return mPlane.getBoard().getLayerStack().getLayer(name);
+    // One cache for all planes, so the memory usage is bounded no matter how many planes
+    // exist. Graphics items are used only in the GUI thread, thus no locking is needed.
+    static QCache<TileKey, QImage> cache(sTileCacheSizeKb); // cost in kilobytes
+    return cache;
 }
 
 /*****************************************************************************************
@@ -61,12 +61,21 @@ class BGI_Plane final : public BGI_Base
         // Getters
         bool isSelectable() const noexcept;
 
+        /**
+         * @brief Get the number of cached fill tiles of this plane (used by unit tests)
+         *
+         * @param rect  Only tiles intersecting this rect (scene coordinates) are counted
+         *
+         * @return The number of tiles of all zoom levels and colors
+         */
+        int getCachedTilesCount(const QRectF& rect) const noexcept;
+
         // General Methods
         void updateCacheAndRepaint() noexcept;
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept {return mBoundingRect;}
-        QPainterPath shape() const noexcept {return mShape;}
+        QPainterPath shape() const noexcept;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0);
 
 
@@ -77,8 +86,41 @@ class BGI_Plane final : public BGI_Base
         BGI_Plane(const BGI_Plane& other) = delete;
         BGI_Plane& operator=(const BGI_Plane& rhs) = delete;
 
+        // Types
+        struct TileKey {
+            const BGI_Plane* plane; ///< the plane which the tile belongs to
+            QRgb color; ///< the color the tile is rendered with (depends on selection)
+            int bucket; ///< zoom bucket, the tile scale factor is 2^bucket
+            int x;      ///< tile column
+            int y;      ///< tile row
+            bool operator==(const TileKey& rhs) const noexcept {
+                return (plane == rhs.plane) && (color == rhs.color)
+                    && (bucket == rhs.bucket) && (x == rhs.x) && (y == rhs.y);
+            }
+            friend uint qHash(const TileKey& key, uint seed = 0) noexcept {
+                return ::qHash(key.plane, seed) ^ ::qHash(key.color, seed)
+                    ^ ::qHash(key.bucket, seed)
+                    ^ ::qHash((key.x * 73856093) ^ (key.y * 19349663), seed);
+            }
+        };
+
         // Private Methods
-        GraphicsLayer* getLayer(QString name) const noexcept;
+        GraphicsLayer* getLayer(const GraphicsLayerId& layer) const noexcept;
+        const QVector<QPainterPath>& getAreasForLod(qreal lod) const noexcept;
+        void paintTiles(QPainter& painter, const QRectF& exposedRect, qreal lod,
+                        const QColor& color) noexcept;
+        QImage renderTile(const TileKey& key) const noexcept;
+        void invalidateTiles(const QRectF& rect) const noexcept;
+        static QRectF getChangedAreasRect(
+            const QVector<QPainterPath>& areas,
+            const QVector<QPainterPath>& otherAreas) noexcept;
+        static QPainterPath simplifyPath(const QPainterPath& path, qreal tolerance) noexcept;
+        static qreal getTileSceneSize(int bucket) noexcept;
+        static QCache<TileKey, QImage>& getTileCache() noexcept;
+
+        // Static Attributes
+        static const int sTileSizePx = 256; ///< width and height of tiles in device pixels
+        static const int sTileCacheSizeKb = 64 * 1024; ///< shared by all planes
 
         // General Attributes
         BI_Plane& mPlane;
@@ -86,9 +128,11 @@ class BGI_Plane final : public BGI_Base
         // Cached Attributes
         GraphicsLayer* mLayer;
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        mutable QPainterPath mShape; ///< built on demand, see shape()
+        mutable bool mShapeOutdated;
         QPainterPath mOutline;
         QVector<QPainterPath> mAreas;
+        mutable QHash<int, QVector<QPainterPath>> mSimplifiedAreas; ///< key: LOD bucket
 };
 
 /*****************************************************************************************
@@ -42,7 +42,7 @@ namespace project {
  ****************************************************************************************/
 
 BGI_Via::BGI_Via(BI_Via& via) noexcept :
-    BGI_Base(), mVia(via), mViaLayer(nullptr), mTopStopMaskLayer(nullptr),
+    BGI_Base(via.getBoard()), mVia(via), mViaLayer(nullptr), mTopStopMaskLayer(nullptr),
     mBottomStopMaskLayer(nullptr)
 {
     setZValue(Board::ZValue_Vias);
@@ -74,13 +74,13 @@ bool BGI_Via::isSelectable() const noexcept
 
 void BGI_Via::updateCacheAndRepaint() noexcept
 {
-    prepareGeometryChange();
+    if (deferUpdateCacheAndRepaint()) return;
 
-    setToolTip(mVia.getNetSignalOfNetSegment().getName());
+    prepareGeometryChange();
 
-    mViaLayer = getLayer(GraphicsLayer::sBoardViasTht);
-    mTopStopMaskLayer = getLayer(GraphicsLayer::sTopStopMask);
-    mBottomStopMaskLayer = getLayer(GraphicsLayer::sBotStopMask);
+    mViaLayer = getLayer(GraphicsLayerId(GraphicsLayer::sBoardViasTht));
+    mTopStopMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sTopStopMask));
+    mBottomStopMaskLayer = getLayer(GraphicsLayerId(GraphicsLayer::sBotStopMask));
 
     // determine stop mask clearance
     mDrawStopMask = mVia.getBoard().getDesignRules().doesViaRequireStopMask(mVia.getDrillDiameter());
@@ -134,7 +134,7 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, Q
     }
 
 #ifdef QT_DEBUG
-    GraphicsLayer* layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects); Q_ASSERT(layer);
+    GraphicsLayer* layer = getLayer(GraphicsLayerId(GraphicsLayer::sDebugGraphicsItemsBoundingRects)); Q_ASSERT(layer);
     if (layer->isVisible()) {
         // draw bounding rect
         painter->setPen(QPen(layer->getColor(highlight), 0));
@@ -144,13 +144,22 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, Q
 #endif
 }
 
+/*****************************************************************************************
+ *  Inherited from BGI_Base
+ ****************************************************************************************/
+
+QString BGI_Via::getToolTipText() const noexcept
+{
+    return mVia.getNetSignalOfNetSegment().getName();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-GraphicsLayer* BGI_Via::getLayer(const QString& name) const noexcept
+GraphicsLayer* BGI_Via::getLayer(const GraphicsLayerId& layer) const noexcept
 {
-    return mVia.getBoard().getLayerStack().getLayer(name);
+    return mVia.getBoard().getLayerStack().getLayer(layer);
 }
 
 /*****************************************************************************************
@@ -72,8 +72,11 @@ class BGI_Via final : public BGI_Base
         BGI_Via(const BGI_Via& other) = delete;
         BGI_Via& operator=(const BGI_Via& rhs) = delete;
 
+        // Inherited from BGI_Base
+        QString getToolTipText() const noexcept override;
+
         // Private Methods
-        GraphicsLayer* getLayer(const QString& name) const noexcept;
+        GraphicsLayer* getLayer(const GraphicsLayerId& layer) const noexcept;
 
 
         // General Attributes
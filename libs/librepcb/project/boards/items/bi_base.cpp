@@ -74,24 +74,31 @@ void BI_Base::setSelected(bool selected) noexcept
  *  General Methods
  ****************************************************************************************/
 
-void BI_Base::addToBoard(QGraphicsItem* item) noexcept
+void BI_Base::addToBoard(bool hasGraphicsItem) noexcept
 {
     Q_ASSERT(!mIsAddedToBoard);
-    if (item) {
-        mBoard.getGraphicsScene().addItem(*item);
+    if (hasGraphicsItem) {
+        mBoard.addGraphicsItem(*this); // creates the item if the scene is built
     }
     mIsAddedToBoard = true;
 }
 
-void BI_Base::removeFromBoard(QGraphicsItem* item) noexcept
+void BI_Base::removeFromBoard(bool hasGraphicsItem) noexcept
 {
     Q_ASSERT(mIsAddedToBoard);
-    if (item) {
-        mBoard.getGraphicsScene().removeItem(*item);
+    if (hasGraphicsItem) {
+        mBoard.removeGraphicsItem(*this); // destroys the item
     }
     mIsAddedToBoard = false;
 }
 
+void BI_Base::buildGraphicsItemForHitTesting() const noexcept
+{
+    if (mIsAddedToBoard) {
+        mBoard.getGraphicsScene(); // creates the graphics items of all added items
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -92,6 +92,22 @@ class BI_Base : public QObject
         virtual void addToBoard() = 0;
         virtual void removeFromBoard() = 0;
 
+        /**
+         * @brief Create the graphics item of this board item
+         *
+         * This is called by the board when its graphics scene is built (or when this
+         * item is added to an already built scene). The graphics item is owned by this
+         * object until #destroyGraphicsItem() is called.
+         *
+         * @return The new graphics item (nullptr if this item has none)
+         */
+        virtual QGraphicsItem* createGraphicsItem() noexcept {return nullptr;}
+
+        /**
+         * @brief Destroy the graphics item created by #createGraphicsItem()
+         */
+        virtual void destroyGraphicsItem() noexcept {}
+
         // Operator Overloadings
         BI_Base& operator=(const BI_Base& rhs) = delete;
 
@@ -99,8 +115,17 @@ class BI_Base : public QObject
     protected:
 
         // General Methods
-        void addToBoard(QGraphicsItem* item) noexcept;
-        void removeFromBoard(QGraphicsItem* item) noexcept;
+        void addToBoard(bool hasGraphicsItem) noexcept;
+        void removeFromBoard(bool hasGraphicsItem) noexcept;
+
+        /**
+         * @brief Make sure the graphics item exists if this item is added to a board
+         *
+         * The grab area is determined by the graphics item, which is only created
+         * together with the graphics scene. So hit testing on a board which is not
+         * shown builds its scene.
+         */
+        void buildGraphicsItemForHitTesting() const noexcept;
 
 
     protected:
@@ -28,6 +28,7 @@
 #include "../../settings/projectsettings.h"
 #include <librepcb/library/elements.h>
 #include "../../erc/ercmsg.h"
+#include "../../erc/ercmsglist.h"
 #include "../../circuit/circuit.h"
 #include "../../circuit/componentinstance.h"
 #include "bi_footprint.h"
@@ -153,6 +154,7 @@ void BI_Device::init()
 
 BI_Device::~BI_Device() noexcept
 {
+    getProject().getErcMsgList().unscheduleUpdate(*this);
     mFootprint.reset();
 }
 
@@ -210,8 +212,8 @@ void BI_Device::addToBoard()
     auto sg = scopeGuard([&](){mCompInstance->unregisterDevice(*this);});
     mFootprint->addToBoard(); // can throw
     sg.dismiss();
-    BI_Base::addToBoard(nullptr);
-    updateErcMessages();
+    BI_Base::addToBoard(false);
+    scheduleErcMessagesUpdate();
 }
 
 void BI_Device::removeFromBoard()
@@ -223,8 +225,8 @@ void BI_Device::removeFromBoard()
     auto sg = scopeGuard([&](){mFootprint->addToBoard();});
     mCompInstance->unregisterDevice(*this); // can throw
     sg.dismiss();
-    BI_Base::removeFromBoard(nullptr);
-    updateErcMessages();
+    BI_Base::removeFromBoard(false);
+    scheduleErcMessagesUpdate();
 }
 
 void BI_Device::serialize(SExpression& root) const
@@ -303,6 +305,11 @@ bool BI_Device::checkAttributesValidity() const noexcept
     return true;
 }
 
+void BI_Device::scheduleErcMessagesUpdate() noexcept
+{
+    getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 void BI_Device::updateErcMessages() noexcept
 {
 }
@@ -133,7 +133,8 @@ class BI_Device final : public BI_Base, public AttributeProvider,
                                               const Uuid& footprintUuid);
         void init();
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
         const QStringList& getLocaleOrder() const noexcept;
 
 
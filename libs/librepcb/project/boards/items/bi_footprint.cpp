@@ -32,6 +32,9 @@
 #include <librepcb/library/dev/device.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/font/strokefont.h>
+#include <librepcb/common/geometry/text.h>
 #include "bi_device.h"
 
 /*****************************************************************************************
@@ -66,10 +69,6 @@ BI_Footprint::BI_Footprint(BI_Device& device) :
 
 void BI_Footprint::init()
 {
-    mGraphicsItem.reset(new BGI_Footprint(*this));
-    mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
-    updateGraphicsItemTransform();
-
     const library::Device& libDev = mDevice.getLibDevice();
     for (const library::FootprintPad& libPad : getLibFootprint().getPads()) {
         BI_FootprintPad* pad = new BI_FootprintPad(*this, libPad.getPackagePadUuid());
@@ -146,7 +145,7 @@ void BI_Footprint::addToBoard()
         pad->addToBoard(); // can throw
         sgl.add([pad](){pad->removeFromBoard();});
     }
-    BI_Base::addToBoard(mGraphicsItem.data());
+    BI_Base::addToBoard(true);
     sgl.dismiss();
 }
 
@@ -160,7 +159,7 @@ void BI_Footprint::removeFromBoard()
         pad->removeFromBoard(); // can throw
         sgl.add([pad](){pad->addToBoard();});
     }
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    BI_Base::removeFromBoard(true);
     sgl.dismiss();
 }
 
@@ -174,6 +173,35 @@ void BI_Footprint::serialize(SExpression& root) const
     //root.appendStringChild("symbol_item", mSymbVarItem->getUuid());
 }
 
+QVector<Path> BI_Footprint::getTextPaths(const Text& text) const noexcept
+{
+    auto it = mCachedTexts.find(&text);
+    if (it == mCachedTexts.end()) {
+        CachedText_t cache;
+        cache.tmpl = AttributeSubstitutionTemplate(text.getText());
+        cache.keys = cache.tmpl.getKeys();
+        cache.values = getAttributeValues(cache.keys);
+        cache.content = AttributeSubstitutor::substitute(cache.tmpl, this);
+        cache.layoutDirty = true;
+        cache.rotated180 = false;
+        it = mCachedTexts.insert(&text, cache);
+    }
+    bool rotate180 = isTextRotated180(text);
+    if (it->layoutDirty || (it->rotated180 != rotate180)) {
+        // texts must never be upside down, so rotate them by 180° if needed
+        Alignment align = rotate180 ? text.getAlign().mirrored() : text.getAlign();
+        it->paths = StrokeFont::instance().stroke(it->content, text.getHeight(), align);
+        for (Path& path : it->paths) {
+            if (rotate180) path.rotate(Angle::deg180());
+            path.rotate(text.getRotation());
+            path.translate(text.getPosition());
+        }
+        it->layoutDirty = false;
+        it->rotated180 = rotate180;
+    }
+    return it->paths;
+}
+
 /*****************************************************************************************
  *  Helper Methods
  ****************************************************************************************/
@@ -215,36 +243,78 @@ bool BI_Footprint::getIsMirrored() const noexcept
 
 QPainterPath BI_Footprint::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Footprint::isSelectable() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return false;
     return mGraphicsItem->isSelectable();
 }
 
 void BI_Footprint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
     foreach (BI_FootprintPad* pad, mPads)
         pad->setSelected(selected);
 }
 
+QGraphicsItem* BI_Footprint::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new BGI_Footprint(*this));
+    mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
+    updateGraphicsItemTransform();
+    return mGraphicsItem.data();
+}
+
+void BI_Footprint::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
+}
+
 /*****************************************************************************************
  *  Private Slots
  ****************************************************************************************/
 
 void BI_Footprint::deviceInstanceAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    // only texts whose referenced attributes have changed need to be substituted again,
+    // and only texts whose substituted content has changed need to be laid out again
+    bool textsChanged = false;
+    for (auto it = mCachedTexts.begin(); it != mCachedTexts.end(); ++it) {
+        QStringList values = getAttributeValues(it->keys);
+        if ((values == it->values) && (values.filter("#").isEmpty())) {
+            continue; // values containing variables may be substituted differently though
+        }
+        it->values = values;
+        QString content = AttributeSubstitutor::substitute(it->tmpl, this);
+        if (content != it->content) {
+            it->content = content;
+            it->layoutDirty = true;
+            textsChanged = true;
+        }
+    }
+    if (textsChanged) {
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
+    }
     emit attributesChanged();
 }
 
 void BI_Footprint::deviceInstanceMoved(const Point& pos)
 {
-    mGraphicsItem->setPos(pos.toPxQPointF());
-    mGraphicsItem->updateCacheAndRepaint();
+    // the graphics item content is in footprint coordinates, so just move it
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(pos.toPxQPointF());
+    }
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -254,7 +324,19 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot)
 {
     Q_UNUSED(rot);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    // the content only needs to be updated if some texts have to be flipped around
+    bool textsFlipped = false;
+    for (auto it = mCachedTexts.constBegin(); it != mCachedTexts.constEnd(); ++it) {
+        if (it->rotated180 != isTextRotated180(*it.key())) {
+            textsFlipped = true;
+            break;
+        }
+    }
+    if (textsFlipped) {
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
+    }
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -264,7 +346,9 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored)
 {
     Q_UNUSED(mirrored);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -279,7 +363,25 @@ void BI_Footprint::updateGraphicsItemTransform() noexcept
     QTransform t;
     if (mDevice.getIsMirrored()) t.scale(qreal(-1), qreal(1));
     t.rotate(-mDevice.getRotation().toDeg());
-    mGraphicsItem->setTransform(t);
+    if (mGraphicsItem) {
+        mGraphicsItem->setTransform(t);
+    }
+}
+
+bool BI_Footprint::isTextRotated180(const Text& text) const noexcept
+{
+    Angle absAngle = text.getRotation() + getRotation();
+    absAngle.mapTo180deg();
+    return (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
+}
+
+QStringList BI_Footprint::getAttributeValues(const QStringList& keys) const noexcept
+{
+    QStringList values;
+    foreach (const QString& key, keys) {
+        values.append(getAttributeValue(key));
+    }
+    return values;
 }
 
 bool BI_Footprint::checkAttributesValidity() const noexcept
@@ -27,6 +27,8 @@
 #include "bi_base.h"
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/attributes/attributeprovider.h>
+#include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/geometry/path.h>
 #include "../graphicsitems/bgi_footprint.h"
 
 /*****************************************************************************************
@@ -34,6 +36,8 @@
  ****************************************************************************************/
 namespace librepcb {
 
+class Text;
+
 namespace library {
 class Footprint;
 }
@@ -86,6 +90,21 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
 
+        /**
+         * @brief Get the stroke paths of a text of the library footprint
+         *
+         * The text is laid out with the librepcb::StrokeFont only if its substituted
+         * content or its orientation (see #isTextRotated180()) has changed, so the same
+         * geometry is reused for painting, the Gerber export and the clearance of planes.
+         * Moving the footprint does not affect the paths at all.
+         *
+         * @param text      A text of #getLibFootprint()
+         *
+         * @return The paths in footprint coordinates, with attributes substituted and
+         *         rotated by 180 degrees if needed to keep the text readable
+         */
+        QVector<Path> getTextPaths(const Text& text) const noexcept;
+
         // Helper Methods
         Point mapToScene(const Point& relativePos) const noexcept;
 
@@ -99,6 +118,8 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
         bool getIsMirrored() const noexcept override;
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        QGraphicsItem* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         BI_Footprint& operator=(const BI_Footprint& rhs) = delete;
@@ -122,13 +143,27 @@ class BI_Footprint final : public BI_Base, public SerializableObject,
 
         void init();
         void updateGraphicsItemTransform() noexcept;
+        bool isTextRotated180(const Text& text) const noexcept;
+        QStringList getAttributeValues(const QStringList& keys) const noexcept;
         bool checkAttributesValidity() const noexcept;
 
+        // Types
+        struct CachedText_t {
+            AttributeSubstitutionTemplate tmpl; ///< the parsed text of the library footprint
+            QStringList keys;       ///< the attribute keys referenced by the text
+            QStringList values;     ///< the values of #keys used to substitute #content
+            QString content;        ///< the text with attributes substituted
+            bool layoutDirty;       ///< whether #content changed since the last layout
+            bool rotated180;        ///< whether the paths are rotated to keep them readable
+            QVector<Path> paths;    ///< the laid out text in footprint coordinates
+        };
+
 
         // General
         BI_Device& mDevice;
-        QScopedPointer<BGI_Footprint> mGraphicsItem;
+        QScopedPointer<BGI_Footprint> mGraphicsItem; ///< only exists while the scene is built
         QHash<Uuid, BI_FootprintPad*> mPads; ///< key: footprint pad UUID
+        mutable QHash<const Text*, CachedText_t> mCachedTexts; ///< cache for #getTextPaths()
 };
 
 /*****************************************************************************************
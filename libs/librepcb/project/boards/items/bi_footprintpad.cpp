@@ -62,7 +62,6 @@ BI_FootprintPad::BI_FootprintPad(BI_Footprint& footprint, const Uuid& padUuid) :
     connect(mComponentSignalInstance, &ComponentSignalInstance::netSignalChanged,
             this, &BI_FootprintPad::componentSignalInstanceNetSignalChanged);
 
-    mGraphicsItem.reset(new BGI_FootprintPad(*this));
     updatePosition();
 
     // connect to the "attributes changed" signal of the footprint
@@ -95,20 +94,20 @@ QString BI_FootprintPad::getDisplayText() const noexcept
     }
 }
 
-QString BI_FootprintPad::getLayerName() const noexcept
+GraphicsLayerId BI_FootprintPad::getLayerId() const noexcept
 {
     if (getIsMirrored())
-        return GraphicsLayer::getMirroredLayerName(mFootprintPad->getLayerName());
+        return mFootprintPad->getLayerId().getMirrored();
     else
-        return mFootprintPad->getLayerName();
+        return mFootprintPad->getLayerId();
 }
 
-bool BI_FootprintPad::isOnLayer(const QString& layerName) const noexcept
+bool BI_FootprintPad::isOnLayer(const GraphicsLayerId& layer) const noexcept
 {
     if (getIsMirrored()) {
-        return mFootprintPad->isOnLayer(GraphicsLayer::getMirroredLayerName(layerName));
+        return mFootprintPad->isOnLayer(layer.getMirrored());
     } else {
-        return mFootprintPad->isOnLayer(layerName);
+        return mFootprintPad->isOnLayer(layer);
     }
 }
 
@@ -134,7 +133,7 @@ void BI_FootprintPad::addToBoard()
         mComponentSignalInstance->registerFootprintPad(*this); // can throw
     }
     componentSignalInstanceNetSignalChanged(getCompSigInstNetSignal());
-    BI_Base::addToBoard(mGraphicsItem.data());
+    BI_Base::addToBoard(true);
 }
 
 void BI_FootprintPad::removeFromBoard()
@@ -146,33 +145,33 @@ void BI_FootprintPad::removeFromBoard()
         mComponentSignalInstance->unregisterFootprintPad(*this); // can throw
     }
     componentSignalInstanceNetSignalChanged(nullptr);
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    BI_Base::removeFromBoard(true);
 }
 
 void BI_FootprintPad::registerNetPoint(BI_NetPoint& netpoint)
 {
     if ((!isAddedToBoard()) || (!mComponentSignalInstance)
         || (netpoint.getBoard() != mBoard)
-        || (mRegisteredNetPoints.contains(netpoint.getLayer().getName()))
+        || (mRegisteredNetPoints.contains(netpoint.getLayer().getId()))
         || (&netpoint.getNetSignalOfNetSegment() != mComponentSignalInstance->getNetSignal())
         || (!netpoint.getLayer().isCopperLayer())
-        || (!isOnLayer(netpoint.getLayer().getName())))
+        || (!isOnLayer(netpoint.getLayer().getId())))
     {
         throw LogicError(__FILE__, __LINE__);
     }
-    mRegisteredNetPoints.insert(netpoint.getLayer().getName(), &netpoint);
+    mRegisteredNetPoints.insert(netpoint.getLayer().getId(), &netpoint);
     netpoint.updateLines();
 }
 
 void BI_FootprintPad::unregisterNetPoint(BI_NetPoint& netpoint)
 {
     if ((!isAddedToBoard()) || (!mComponentSignalInstance)
-        || (getNetPointOfLayer(netpoint.getLayer().getName()) != &netpoint)
+        || (getNetPointOfLayer(netpoint.getLayer().getId()) != &netpoint)
         || (&netpoint.getNetSignalOfNetSegment() != mComponentSignalInstance->getNetSignal()))
     {
         throw LogicError(__FILE__, __LINE__);
     }
-    mRegisteredNetPoints.remove(netpoint.getLayer().getName());
+    mRegisteredNetPoints.remove(netpoint.getLayer().getId());
     netpoint.updateLines();
 }
 
@@ -180,9 +179,13 @@ void BI_FootprintPad::updatePosition() noexcept
 {
     mPosition = mFootprint.mapToScene(mFootprintPad->getPosition());
     mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+    }
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     foreach (BI_NetPoint* netpoint, mRegisteredNetPoints) {
         netpoint->setPosition(mPosition);
     }
@@ -199,18 +202,38 @@ bool BI_FootprintPad::getIsMirrored() const noexcept
 
 QPainterPath BI_FootprintPad::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_FootprintPad::isSelectable() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return false;
     return mFootprint.isSelectable() && mGraphicsItem->isSelectable();
 }
 
 void BI_FootprintPad::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+QGraphicsItem* BI_FootprintPad::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new BGI_FootprintPad(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    updateGraphicsItemTransform();
+    return mGraphicsItem.data();
+}
+
+void BI_FootprintPad::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 Path BI_FootprintPad::getOutline(const Length& expansion) const noexcept
@@ -229,7 +252,9 @@ Path BI_FootprintPad::getSceneOutline(const Length& expansion) const noexcept
 
 void BI_FootprintPad::footprintAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* netsignal)
@@ -239,7 +264,7 @@ void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* netsign
     }
     if (netsignal) {
         mHighlightChangedConnection = connect(netsignal, &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     }
 }
 
@@ -252,7 +277,9 @@ void BI_FootprintPad::updateGraphicsItemTransform() noexcept
     QTransform t;
     if (mFootprint.getIsMirrored()) t.scale(qreal(-1), qreal(1));
     t.rotate(-mRotation.toDeg());
-    mGraphicsItem->setTransform(t);
+    if (mGraphicsItem) {
+        mGraphicsItem->setTransform(t);
+    }
 }
 
 /*****************************************************************************************
@@ -27,6 +27,7 @@
 #include "bi_base.h"
 #include "../graphicsitems/bgi_footprintpad.h"
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayerid.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -69,10 +70,10 @@ class BI_FootprintPad final : public BI_Base
         QString getDisplayText() const noexcept;
         const Angle& getRotation() const noexcept {return mRotation;}
         BI_Footprint& getFootprint() const noexcept {return mFootprint;}
-        const QMap<QString, BI_NetPoint*>& getNetPoints() const noexcept {return mRegisteredNetPoints;}
-        BI_NetPoint* getNetPointOfLayer(const QString& layerName) const noexcept {return mRegisteredNetPoints.value(layerName, nullptr);}
-        QString getLayerName() const noexcept;
-        bool isOnLayer(const QString& layerName) const noexcept;
+        const QMap<GraphicsLayerId, BI_NetPoint*>& getNetPoints() const noexcept {return mRegisteredNetPoints;}
+        BI_NetPoint* getNetPointOfLayer(const GraphicsLayerId& layer) const noexcept {return mRegisteredNetPoints.value(layer, nullptr);}
+        GraphicsLayerId getLayerId() const noexcept;
+        bool isOnLayer(const GraphicsLayerId& layer) const noexcept;
         const library::FootprintPad& getLibPad() const noexcept {return *mFootprintPad;}
         ComponentSignalInstance* getComponentSignalInstance() const noexcept {return mComponentSignalInstance;}
         NetSignal* getCompSigInstNetSignal() const noexcept;
@@ -95,6 +96,8 @@ class BI_FootprintPad final : public BI_Base
         bool getIsMirrored() const noexcept override;
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        QGraphicsItem* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         BI_FootprintPad& operator=(const BI_FootprintPad& rhs) = delete;
@@ -121,8 +124,8 @@ class BI_FootprintPad final : public BI_Base
         // Misc
         Point mPosition;
         Angle mRotation;
-        QMap<QString, BI_NetPoint*> mRegisteredNetPoints; ///< key: layer name
-        QScopedPointer<BGI_FootprintPad> mGraphicsItem;
+        QMap<GraphicsLayerId, BI_NetPoint*> mRegisteredNetPoints; ///< key: layer
+        QScopedPointer<BGI_FootprintPad> mGraphicsItem; ///< only exists while the scene is built
 };
 
 /*****************************************************************************************
@@ -107,7 +107,6 @@ void BI_NetLine::init()
             tr("BI_NetLine: both endpoints are the same."));
     }
 
-    mGraphicsItem.reset(new BGI_NetLine(*this));
     updateLine();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -185,7 +184,9 @@ void BI_NetLine::setWidth(const Length& width) noexcept
     Q_ASSERT(width >= 0);
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
     }
 }
 
@@ -208,8 +209,8 @@ void BI_NetLine::addToBoard()
 
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                               &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
-    BI_Base::addToBoard(mGraphicsItem.data());
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
+    BI_Base::addToBoard(true);
     sg.dismiss();
 }
 
@@ -227,14 +228,16 @@ void BI_NetLine::removeFromBoard()
     mEndPoint->unregisterNetLine(*this); // can throw
 
     disconnect(mHighlightChangedConnection);
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    BI_Base::removeFromBoard(true);
     sg.dismiss();
 }
 
 void BI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_NetLine::serialize(SExpression& root) const
@@ -253,18 +256,36 @@ void BI_NetLine::serialize(SExpression& root) const
 
 QPainterPath BI_NetLine::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape();
 }
 
 bool BI_NetLine::isSelectable() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return false;
     return mGraphicsItem->isSelectable();
 }
 
 void BI_NetLine::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+QGraphicsItem* BI_NetLine::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new BGI_NetLine(*this));
+    return mGraphicsItem.data();
+}
+
+void BI_NetLine::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -97,6 +97,8 @@ class BI_NetLine final : public BI_Base, public SerializableObject
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        QGraphicsItem* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         BI_NetLine& operator=(const BI_NetLine& rhs) = delete;
@@ -109,7 +111,7 @@ class BI_NetLine final : public BI_Base, public SerializableObject
 
 
         // General
-        QScopedPointer<BGI_NetLine> mGraphicsItem;
+        QScopedPointer<BGI_NetLine> mGraphicsItem; ///< only exists while the scene is built
         Point mPosition; ///< the center of startpoint and endpoint
         QMetaObject::Connection mHighlightChangedConnection;
 
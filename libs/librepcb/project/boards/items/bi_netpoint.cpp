@@ -35,6 +35,7 @@
 #include "../../circuit/netsignal.h"
 #include "../../circuit/componentsignalinstance.h"
 #include "../../erc/ercmsg.h"
+#include "../../erc/ercmsglist.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/common/scopeguardlist.h>
@@ -146,17 +147,13 @@ void BI_NetPoint::init()
             .arg(mUuid.toStr()).arg(mLayer->getName()));
     }
     if (mFootprintPad) {
-        if (!mFootprintPad->isOnLayer(mLayer->getName())) {
+        if (!mFootprintPad->isOnLayer(mLayer->getId())) {
             throw RuntimeError(__FILE__, __LINE__,
                 QString(tr("The layer of netpoint \"%1\" is invalid (%2)."))
                 .arg(mUuid.toStr()).arg(mLayer->getName()));
         }
     }
 
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_NetPoint(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-
     // create ERC messages
     mErcMsgDeadNetPoint.reset(new ErcMsg(mBoard.getProject(), *this,
         mUuid.toStr(), "Dead", ErcMsg::ErcMsgType_t::BoardError,
@@ -168,6 +165,7 @@ void BI_NetPoint::init()
 
 BI_NetPoint::~BI_NetPoint() noexcept
 {
+    getProject().getErcMsgList().unscheduleUpdate(*this);
     mGraphicsItem.reset();
 }
 
@@ -232,7 +230,9 @@ void BI_NetPoint::setPadToAttach(BI_FootprintPad* pad)
         sgl.dismiss();
     }
     mFootprintPad = pad;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_NetPoint::setViaToAttach(BI_Via* via)
@@ -262,14 +262,18 @@ void BI_NetPoint::setViaToAttach(BI_Via* via)
         sgl.dismiss();
     }
     mVia = via;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_NetPoint::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) {
+            mGraphicsItem->setPos(mPosition.toPxQPointF());
+        }
         updateLines();
     }
 }
@@ -298,9 +302,9 @@ void BI_NetPoint::addToBoard()
     }
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    mErcMsgDeadNetPoint->setVisible(true);
-    BI_Base::addToBoard(mGraphicsItem.data());
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
+    scheduleErcMessagesUpdate();
+    BI_Base::addToBoard(true);
 }
 
 void BI_NetPoint::removeFromBoard()
@@ -322,8 +326,8 @@ void BI_NetPoint::removeFromBoard()
         mVia->unregisterNetPoint(*this); // can throw
     }
     disconnect(mHighlightChangedConnection);
-    mErcMsgDeadNetPoint->setVisible(false);
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    scheduleErcMessagesUpdate();
+    BI_Base::removeFromBoard(true);
 }
 
 void BI_NetPoint::registerNetLine(BI_NetLine& netline)
@@ -335,8 +339,10 @@ void BI_NetPoint::registerNetLine(BI_NetLine& netline)
     }
     mRegisteredLines.append(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
+    scheduleErcMessagesUpdate();
 }
 
 void BI_NetPoint::unregisterNetLine(BI_NetLine& netline)
@@ -346,8 +352,10 @@ void BI_NetPoint::unregisterNetLine(BI_NetLine& netline)
     }
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
+    scheduleErcMessagesUpdate();
 }
 
 void BI_NetPoint::updateLines() const noexcept
@@ -379,18 +387,37 @@ void BI_NetPoint::serialize(SExpression& root) const
 
 QPainterPath BI_NetPoint::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 bool BI_NetPoint::isSelectable() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return false;
     return mGraphicsItem->isSelectable();
 }
 
 void BI_NetPoint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+QGraphicsItem* BI_NetPoint::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new BGI_NetPoint(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    return mGraphicsItem.data();
+}
+
+void BI_NetPoint::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -405,6 +432,16 @@ bool BI_NetPoint::checkAttributesValidity() const noexcept
     return true;
 }
 
+void BI_NetPoint::updateErcMessages() noexcept
+{
+    mErcMsgDeadNetPoint->setVisible(isAddedToBoard() && mRegisteredLines.isEmpty());
+}
+
+void BI_NetPoint::scheduleErcMessagesUpdate() noexcept
+{
+    getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
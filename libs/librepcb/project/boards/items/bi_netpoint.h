@@ -114,6 +114,8 @@ class BI_NetPoint final : public BI_Base, public SerializableObject,
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        QGraphicsItem* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         BI_NetPoint& operator=(const BI_NetPoint& rhs) = delete;
@@ -125,10 +127,12 @@ class BI_NetPoint final : public BI_Base, public SerializableObject,
 
         void init();
         bool checkAttributesValidity() const noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
 
 
         // General
-        QScopedPointer<BGI_NetPoint> mGraphicsItem;
+        QScopedPointer<BGI_NetPoint> mGraphicsItem; ///< only exists while the scene is built
         QMetaObject::Connection mHighlightChangedConnection;
 
         // Attributes
@@ -419,7 +419,7 @@ void BI_NetSegment::addToBoard()
         sgl.add([netline](){netline->removeFromBoard();});
     }
 
-    BI_Base::addToBoard(nullptr);
+    BI_Base::addToBoard(false);
     sgl.dismiss();
 }
 
@@ -445,20 +445,10 @@ void BI_NetSegment::removeFromBoard()
     mNetSignal->unregisterBoardNetSegment(*this); // can throw
     sgl.add([&](){mNetSignal->registerBoardNetSegment(*this);});
 
-    BI_Base::removeFromBoard(nullptr);
+    BI_Base::removeFromBoard(false);
     sgl.dismiss();
 }
 
-void BI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept
-{
-    foreach (BI_Via* via, mVias)
-        via->setSelected(via->isSelectable() && via->getGrabAreaScenePx().intersects(rectPx));
-    foreach (BI_NetPoint* netpoint, mNetPoints)
-        netpoint->setSelected(netpoint->isSelectable() && netpoint->getGrabAreaScenePx().intersects(rectPx));
-    foreach (BI_NetLine* netline, mNetLines)
-        netline->setSelected(netline->isSelectable() && netline->getGrabAreaScenePx().intersects(rectPx));
-}
-
 void BI_NetSegment::clearSelection() const noexcept
 {
     foreach (BI_Via* via, mVias)
@@ -101,7 +101,6 @@ class BI_NetSegment final : public BI_Base, public SerializableObject
         // General Methods
         void addToBoard() override;
         void removeFromBoard() override;
-        void setSelectionRect(const QRectF rectPx) noexcept;
         void clearSelection() const noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
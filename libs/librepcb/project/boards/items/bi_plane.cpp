@@ -41,7 +41,8 @@ namespace project {
 
 BI_Plane::BI_Plane(Board& board, const BI_Plane& other) :
     BI_Base(board), mUuid(Uuid::createRandom()),
-    mLayerName(other.mLayerName), mNetSignal(other.mNetSignal), mOutline(other.mOutline),
+    mLayerName(other.mLayerName), mLayerId(other.mLayerId), mNetSignal(other.mNetSignal),
+    mOutline(other.mOutline),
     mMinWidth(other.mMinWidth), mMinClearance(other.mMinClearance),
     mKeepOrphans(other.mKeepOrphans), mPriority(other.mPriority),
     mConnectStyle(other.mConnectStyle),
@@ -56,6 +57,7 @@ BI_Plane::BI_Plane(Board& board, const SExpression& node) :
 {
     mUuid = node.getChildByIndex(0).getValue<Uuid>(true);
     mLayerName = node.getValueByPath<QString>("layer", true);
+    mLayerId = GraphicsLayerId(mLayerName);
     Uuid netSignalUuid = node.getValueByPath<Uuid>("net", true);
     mNetSignal = mBoard.getProject().getCircuit().getNetSignalByUuid(netSignalUuid);
     if(!mNetSignal) {
@@ -83,7 +85,8 @@ BI_Plane::BI_Plane(Board& board, const SExpression& node) :
 
 BI_Plane::BI_Plane(Board& board, const Uuid& uuid, const QString& layerName,
                    NetSignal& netsignal, const Path& outline) :
-    BI_Base(board), mUuid(uuid), mLayerName(layerName), mNetSignal(&netsignal),
+    BI_Base(board), mUuid(uuid), mLayerName(layerName), mLayerId(layerName),
+    mNetSignal(&netsignal),
     mOutline(outline), mMinWidth(200000), mMinClearance(300000), mKeepOrphans(false),
     mPriority(0), mConnectStyle(ConnectStyle::Solid),
     //mThermalGapWidth(100000), mThermalSpokeWidth(100000),
@@ -94,10 +97,6 @@ BI_Plane::BI_Plane(Board& board, const Uuid& uuid, const QString& layerName,
 
 void BI_Plane::init()
 {
-    mGraphicsItem.reset(new BGI_Plane(*this));
-    mGraphicsItem->setPos(getPosition().toPxQPointF());
-    mGraphicsItem->setRotation(Angle::deg0().toDeg());
-
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_Plane::boardAttributesChanged);
 }
@@ -115,7 +114,9 @@ void BI_Plane::setOutline(const Path& outline) noexcept
 {
     if (outline != mOutline) {
         mOutline = outline;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
     }
 }
 
@@ -123,7 +124,10 @@ void BI_Plane::setLayerName(const QString& layerName) noexcept
 {
     if (layerName != mLayerName) {
         mLayerName = layerName;
-        mGraphicsItem->updateCacheAndRepaint();
+        mLayerId = GraphicsLayerId(layerName);
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
     }
 }
 
@@ -188,8 +192,10 @@ void BI_Plane::addToBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     mNetSignal->registerBoardPlane(*this); // can throw
-    BI_Base::addToBoard(mGraphicsItem.data());
-    mGraphicsItem->updateCacheAndRepaint(); // TODO: remove this
+    BI_Base::addToBoard(true);
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint(); // TODO: remove this
+    }
 }
 
 void BI_Plane::removeFromBoard()
@@ -198,20 +204,24 @@ void BI_Plane::removeFromBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     mNetSignal->unregisterBoardPlane(*this); // can throw
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    BI_Base::removeFromBoard(true);
 }
 
 void BI_Plane::clear() noexcept
 {
     mFragments.clear();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_Plane::rebuild() noexcept
 {
     BoardPlaneFragmentsBuilder builder(*this);
     mFragments = builder.buildFragments();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_Plane::serialize(SExpression& root) const
@@ -242,18 +252,38 @@ void BI_Plane::serialize(SExpression& root) const
 
 QPainterPath BI_Plane::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Plane::isSelectable() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return false;
     return mGraphicsItem->isSelectable();
 }
 
 void BI_Plane::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+QGraphicsItem* BI_Plane::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new BGI_Plane(*this));
+    mGraphicsItem->setPos(getPosition().toPxQPointF());
+    mGraphicsItem->setRotation(Angle::deg0().toDeg());
+    return mGraphicsItem.data();
+}
+
+void BI_Plane::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -278,7 +308,9 @@ bool BI_Plane::operator<(const BI_Plane& rhs) const noexcept
 
 void BI_Plane::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 /*****************************************************************************************
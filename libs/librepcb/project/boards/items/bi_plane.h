@@ -27,6 +27,7 @@
 #include "bi_base.h"
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayerid.h>
 #include <librepcb/common/uuid.h>
 
 /*****************************************************************************************
@@ -75,6 +76,7 @@ class BI_Plane final : public BI_Base, public SerializableObject
         // Getters
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getLayerName() const noexcept {return mLayerName;}
+        const GraphicsLayerId& getLayerId() const noexcept {return mLayerId;}
         NetSignal& getNetSignal() const noexcept {return *mNetSignal;}
         const Length& getMinWidth() const noexcept {return mMinWidth;}
         const Length& getMinClearance() const noexcept {return mMinClearance;}
@@ -112,6 +114,8 @@ class BI_Plane final : public BI_Base, public SerializableObject
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        QGraphicsItem* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         BI_Plane& operator=(const BI_Plane& rhs) = delete;
@@ -129,7 +133,8 @@ class BI_Plane final : public BI_Base, public SerializableObject
 
     private: // Data
         Uuid mUuid;
-        QString mLayerName;
+        QString mLayerName; ///< kept for serialization, even if it could not be interned
+        GraphicsLayerId mLayerId; ///< #mLayerName interned for fast comparisons
         NetSignal* mNetSignal;
         Path mOutline;
         Length mMinWidth;
@@ -140,7 +145,7 @@ class BI_Plane final : public BI_Base, public SerializableObject
         //Length mThermalGapWidth;
         //Length mThermalSpokeWidth;
         // style [round square miter] ?
-        QScopedPointer<BGI_Plane> mGraphicsItem;
+        QScopedPointer<BGI_Plane> mGraphicsItem; ///< only exists while the scene is built
 
         QVector<Path> mFragments;
 };
@@ -70,9 +70,6 @@ BI_Polygon::BI_Polygon(Board& board, const Uuid& uuid, const QString& layerName,
 
 void BI_Polygon::init()
 {
-    mGraphicsItem.reset(new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
-    mGraphicsItem->setZValue(Board::ZValue_Default);
-
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_Polygon::boardAttributesChanged);
 }
@@ -92,7 +89,7 @@ void BI_Polygon::addToBoard()
     if (isAddedToBoard()) {
         throw LogicError(__FILE__, __LINE__);
     }
-    BI_Base::addToBoard(mGraphicsItem.data());
+    BI_Base::addToBoard(true);
 }
 
 void BI_Polygon::removeFromBoard()
@@ -100,7 +97,7 @@ void BI_Polygon::removeFromBoard()
     if (!isAddedToBoard()) {
         throw LogicError(__FILE__, __LINE__);
     }
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    BI_Base::removeFromBoard(true);
 }
 
 void BI_Polygon::serialize(SExpression& root) const
@@ -114,6 +111,8 @@ void BI_Polygon::serialize(SExpression& root) const
 
 QPainterPath BI_Polygon::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
@@ -126,7 +125,23 @@ bool BI_Polygon::isSelectable() const noexcept
 void BI_Polygon::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->setSelected(selected);
+    if (mGraphicsItem) {
+        mGraphicsItem->setSelected(selected);
+    }
+}
+
+QGraphicsItem* BI_Polygon::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new PolygonGraphicsItem(*mPolygon, mBoard.getLayerStack()));
+    mGraphicsItem->setZValue(Board::ZValue_Default);
+    mGraphicsItem->setSelected(isSelected());
+    return mGraphicsItem.data();
+}
+
+void BI_Polygon::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -135,7 +150,9 @@ void BI_Polygon::setSelected(bool selected) noexcept
 
 void BI_Polygon::boardAttributesChanged()
 {
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
 }
 
 /*****************************************************************************************
@@ -87,6 +87,8 @@ class BI_Polygon final : public BI_Base, public SerializableObject
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        QGraphicsItem* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         BI_Polygon& operator=(const BI_Polygon& rhs) = delete;
@@ -103,7 +105,7 @@ class BI_Polygon final : public BI_Base, public SerializableObject
 
         // General
         QScopedPointer<Polygon> mPolygon;
-        QScopedPointer<PolygonGraphicsItem> mGraphicsItem;
+        QScopedPointer<PolygonGraphicsItem> mGraphicsItem; ///< only exists while the scene is built
 };
 
 /*****************************************************************************************
@@ -83,10 +83,6 @@ BI_Via::BI_Via(BI_NetSegment& netsegment, const Point& position, Shape shape, co
 
 void BI_Via::init()
 {
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_Via(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged,
             this, &BI_Via::boardAttributesChanged);
@@ -108,11 +104,6 @@ NetSignal& BI_Via::getNetSignalOfNetSegment() const noexcept
     return mNetSegment.getNetSignal();
 }
 
-bool BI_Via::isOnLayer(const QString& layerName) const noexcept
-{
-    return GraphicsLayer::isCopperLayer(layerName);
-}
-
 Path BI_Via::getOutline(const Length& expansion) const noexcept
 {
     Length size = mSize + (expansion * 2);
@@ -148,7 +139,9 @@ void BI_Via::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) {
+            mGraphicsItem->setPos(mPosition.toPxQPointF());
+        }
         updateNetPoints();
     }
 }
@@ -157,7 +150,9 @@ void BI_Via::setShape(Shape shape) noexcept
 {
     if (shape != mShape) {
         mShape = shape;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
     }
 }
 
@@ -165,7 +160,9 @@ void BI_Via::setSize(const Length& size) noexcept
 {
     if (size != mSize) {
         mSize = size;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
     }
 }
 
@@ -173,7 +170,9 @@ void BI_Via::setDrillDiameter(const Length& diameter) noexcept
 {
     if (diameter != mDrillDiameter) {
         mDrillDiameter = diameter;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
     }
 }
 
@@ -188,8 +187,8 @@ void BI_Via::addToBoard()
     }
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    BI_Base::addToBoard(mGraphicsItem.data());
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
+    BI_Base::addToBoard(true);
 }
 
 void BI_Via::removeFromBoard()
@@ -198,29 +197,33 @@ void BI_Via::removeFromBoard()
         throw LogicError(__FILE__, __LINE__);
     }
     disconnect(mHighlightChangedConnection);
-    BI_Base::removeFromBoard(mGraphicsItem.data());
+    BI_Base::removeFromBoard(true);
 }
 
 void BI_Via::registerNetPoint(BI_NetPoint& netpoint)
 {
-    if ((!isAddedToBoard()) || (mRegisteredNetPoints.contains(netpoint.getLayer().getName()))
+    if ((!isAddedToBoard()) || (mRegisteredNetPoints.contains(netpoint.getLayer().getId()))
         || (netpoint.getBoard() != mBoard) || (&netpoint.getNetSegment() != &mNetSegment))
     {
         throw LogicError(__FILE__, __LINE__);
     }
-    mRegisteredNetPoints.insert(netpoint.getLayer().getName(), &netpoint);
+    mRegisteredNetPoints.insert(netpoint.getLayer().getId(), &netpoint);
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_Via::unregisterNetPoint(BI_NetPoint& netpoint)
 {
-    if ((!isAddedToBoard()) || (getNetPointOfLayer(netpoint.getLayer().getName()) != &netpoint)) {
+    if ((!isAddedToBoard()) || (getNetPointOfLayer(netpoint.getLayer().getId()) != &netpoint)) {
         throw LogicError(__FILE__, __LINE__);
     }
-    mRegisteredNetPoints.remove(netpoint.getLayer().getName());
+    mRegisteredNetPoints.remove(netpoint.getLayer().getId());
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void BI_Via::updateNetPoints() const noexcept
@@ -252,18 +255,37 @@ void BI_Via::serialize(SExpression& root) const
 
 QPainterPath BI_Via::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 bool BI_Via::isSelectable() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return false;
     return mGraphicsItem->isSelectable();
 }
 
 void BI_Via::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+QGraphicsItem* BI_Via::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new BGI_Via(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    return mGraphicsItem.data();
+}
+
+void BI_Via::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -272,7 +294,9 @@ void BI_Via::setSelected(bool selected) noexcept
 
 void BI_Via::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 bool BI_Via::checkAttributesValidity() const noexcept
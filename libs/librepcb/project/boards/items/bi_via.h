@@ -27,6 +27,7 @@
 #include "bi_base.h"
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/geometry/path.h>
+#include <librepcb/common/graphics/graphicslayerid.h>
 #include <librepcb/common/uuid.h>
 #include "../graphicsitems/bgi_via.h"
 
@@ -77,10 +78,10 @@ class BI_Via final : public BI_Base, public SerializableObject
         Shape getShape() const noexcept {return mShape;}
         const Length& getDrillDiameter() const noexcept {return mDrillDiameter;}
         const Length& getSize() const noexcept {return mSize;}
-        const QMap<QString, BI_NetPoint*>& getNetPoints() const noexcept {return mRegisteredNetPoints;}
-        BI_NetPoint* getNetPointOfLayer(const QString& layerName) const noexcept {return mRegisteredNetPoints.value(layerName, nullptr);}
+        const QMap<GraphicsLayerId, BI_NetPoint*>& getNetPoints() const noexcept {return mRegisteredNetPoints;}
+        BI_NetPoint* getNetPointOfLayer(const GraphicsLayerId& layer) const noexcept {return mRegisteredNetPoints.value(layer, nullptr);}
         bool isUsed() const noexcept {return (mRegisteredNetPoints.count() > 0);}
-        bool isOnLayer(const QString& layerName) const noexcept;
+        bool isOnLayer(const GraphicsLayerId& layer) const noexcept {return layer.isCopperLayer();}
         bool isSelectable() const noexcept override;
         Path getOutline(const Length& expansion = Length(0)) const noexcept;
         Path getSceneOutline(const Length& expansion = Length(0)) const noexcept;
@@ -109,6 +110,8 @@ class BI_Via final : public BI_Base, public SerializableObject
         bool getIsMirrored() const noexcept override {return false;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        QGraphicsItem* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         BI_Via& operator=(const BI_Via& rhs) = delete;
@@ -125,7 +128,7 @@ class BI_Via final : public BI_Base, public SerializableObject
 
         // General
         BI_NetSegment& mNetSegment;
-        QScopedPointer<BGI_Via> mGraphicsItem;
+        QScopedPointer<BGI_Via> mGraphicsItem; ///< only exists while the scene is built
         QMetaObject::Connection mHighlightChangedConnection;
 
         // Attributes
@@ -136,7 +139,7 @@ class BI_Via final : public BI_Base, public SerializableObject
         Length mDrillDiameter;
 
         // Registered Elements
-        QMap<QString, BI_NetPoint*> mRegisteredNetPoints;   ///< key: layer name
+        QMap<GraphicsLayerId, BI_NetPoint*> mRegisteredNetPoints;   ///< key: layer
 };
 
 /*****************************************************************************************
@@ -192,11 +192,13 @@ void Circuit::setNetClassName(NetClass& netclass, const QString& newName)
 
 QString Circuit::generateAutoNetSignalName() const noexcept
 {
-    QString name;
-    int i = 1;
-    do {
-        name = QString("N%1").arg(i++);
-    } while (getNetSignalByName(name));
+    QString prefix("N");
+    int& number = mNextAutoNetSignalNumbers[prefix];
+    number = qMax(number, 1);
+    QString name = prefix % QString::number(number);
+    while (getNetSignalByName(name)) {
+        name = prefix % QString::number(++number);
+    }
     return name;
 }
 
@@ -207,12 +209,7 @@ NetSignal* Circuit::getNetSignalByUuid(const Uuid& uuid) const noexcept
 
 NetSignal* Circuit::getNetSignalByName(const QString& name) const noexcept
 {
-    foreach (NetSignal* netsignal, mNetSignals) {
-        if (netsignal->getName() == name) {
-            return netsignal;
-        }
-    }
-    return nullptr;
+    return mNetSignalsByName.value(name, nullptr);
 }
 
 NetSignal* Circuit:: getNetSignalWithMostElements() const noexcept
@@ -246,6 +243,7 @@ void Circuit::addNetSignal(NetSignal& netsignal)
     // add netsignal to circuit
     netsignal.addToCircuit(); // can throw
     mNetSignals.insert(netsignal.getUuid(), &netsignal);
+    mNetSignalsByName.insert(netsignal.getName(), &netsignal);
     emit netSignalAdded(netsignal);
 }
 
@@ -258,6 +256,8 @@ void Circuit::removeNetSignal(NetSignal& netsignal)
     // remove netsignal from circuit
     netsignal.removeFromCircuit(); // can throw
     mNetSignals.remove(netsignal.getUuid());
+    mNetSignalsByName.remove(netsignal.getName());
+    releaseAutoNameNumber(mNextAutoNetSignalNumbers, netsignal.getName());
     emit netSignalRemoved(netsignal);
 }
 
@@ -274,7 +274,13 @@ void Circuit::setNetSignalName(NetSignal& netsignal, const QString& newName,
             QString(tr("There is already a net signal with the name \"%1\"!")).arg(newName));
     }
     // apply the new name
+    QString oldName = netsignal.getName();
     netsignal.setName(newName, isAutoName); // can throw
+    mNetSignalsByName.remove(oldName);
+    mNetSignalsByName.insert(newName, &netsignal);
+    if (newName != oldName) {
+        releaseAutoNameNumber(mNextAutoNetSignalNumbers, oldName);
+    }
 }
 
 void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept
@@ -290,11 +296,13 @@ void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept
 
 QString Circuit::generateAutoComponentInstanceName(const QString& cmpPrefix) const noexcept
 {
-    QString name;
-    int i = 1;
-    do {
-        name = QString("%1%2").arg(cmpPrefix.isEmpty() ? "?" : cmpPrefix).arg(i++);
-    } while (getComponentInstanceByName(name));
+    QString prefix = cmpPrefix.isEmpty() ? QString("?") : cmpPrefix;
+    int& number = mNextAutoComponentInstanceNumbers[prefix];
+    number = qMax(number, 1);
+    QString name = prefix % QString::number(number);
+    while (getComponentInstanceByName(name)) {
+        name = prefix % QString::number(++number);
+    }
     return name;
 }
 
@@ -305,12 +313,7 @@ ComponentInstance* Circuit::getComponentInstanceByUuid(const Uuid& uuid) const n
 
 ComponentInstance* Circuit::getComponentInstanceByName(const QString& name) const noexcept
 {
-    foreach (ComponentInstance* compInstance, mComponentInstances)
-    {
-        if (compInstance->getName() == name)
-            return compInstance;
-    }
-    return nullptr;
+    return mComponentInstancesByName.value(name, nullptr);
 }
 
 void Circuit::addComponentInstance(ComponentInstance& cmp)
@@ -333,6 +336,7 @@ void Circuit::addComponentInstance(ComponentInstance& cmp)
     // add to circuit
     cmp.addToCircuit(); // can throw
     mComponentInstances.insert(cmp.getUuid(), &cmp);
+    mComponentInstancesByName.insert(cmp.getName(), &cmp);
     emit componentAdded(cmp);
 }
 
@@ -345,6 +349,8 @@ void Circuit::removeComponentInstance(ComponentInstance& cmp)
     // remove from circuit
     cmp.removeFromCircuit(); // can throw
     mComponentInstances.remove(cmp.getUuid());
+    mComponentInstancesByName.remove(cmp.getName());
+    releaseAutoNameNumber(mNextAutoComponentInstanceNumbers, cmp.getName());
     emit componentRemoved(cmp);
 }
 
@@ -360,7 +366,13 @@ void Circuit::setComponentInstanceName(ComponentInstance& cmp, const QString& ne
             QString(tr("There is already a component with the name \"%1\"!")).arg(newName));
     }
     // apply the new name
+    QString oldName = cmp.getName();
     cmp.setName(newName); // can throw
+    mComponentInstancesByName.remove(oldName);
+    mComponentInstancesByName.insert(newName, &cmp);
+    if (newName != oldName) {
+        releaseAutoNameNumber(mNextAutoComponentInstanceNumbers, oldName);
+    }
 }
 
 /*****************************************************************************************
@@ -401,6 +413,21 @@ void Circuit::serialize(SExpression& root) const
     root.appendLineBreak();
 }
 
+void Circuit::releaseAutoNameNumber(QHash<QString, int>& nextNumbers,
+                                    const QString& name) noexcept
+{
+    // if the released name looks like an auto name, make its number available again
+    for (auto it = nextNumbers.begin(); it != nextNumbers.end(); ++it) {
+        if (name.startsWith(it.key())) {
+            bool ok = false;
+            int number = name.mid(it.key().length()).toInt(&ok);
+            if (ok && (number > 0) && (number < it.value())) {
+                it.value() = number;
+            }
+        }
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -133,6 +133,8 @@ class Circuit final : public QObject, public SerializableObject
     private:
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(SExpression& root) const override;
+        static void releaseAutoNameNumber(QHash<QString, int>& nextNumbers,
+                                          const QString& name) noexcept;
 
 
         // General
@@ -145,6 +147,13 @@ class Circuit final : public QObject, public SerializableObject
         QMap<Uuid, NetClass*> mNetClasses;
         QMap<Uuid, NetSignal*> mNetSignals;
         QMap<Uuid, ComponentInstance*> mComponentInstances;
+
+        // Indexes to avoid linear searches (and quadratic runtime of auto names)
+        QHash<QString, NetSignal*> mNetSignalsByName;
+        QHash<QString, ComponentInstance*> mComponentInstancesByName;
+        /// Lowest possibly free number of auto names, per prefix (e.g. "N", "R", "C")
+        mutable QHash<QString, int> mNextAutoNetSignalNumbers;
+        mutable QHash<QString, int> mNextAutoComponentInstanceNumbers;
 };
 
 /*****************************************************************************************
@@ -52,6 +52,8 @@ CmdComponentInstanceRemove::~CmdComponentInstanceRemove() noexcept
 
 bool CmdComponentInstanceRemove::performExecute()
 {
+    addMemoryUsageOfObject(mComponentInstance);
+
     performRedo(); // can throw
 
     return true;
@@ -51,6 +51,8 @@ CmdNetClassRemove::~CmdNetClassRemove() noexcept
 
 bool CmdNetClassRemove::performExecute()
 {
+    addMemoryUsageOfObject(mNetClass);
+
     performRedo(); // can throw
 
     return true;
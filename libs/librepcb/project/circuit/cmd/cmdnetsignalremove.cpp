@@ -51,6 +51,8 @@ CmdNetSignalRemove::~CmdNetSignalRemove() noexcept
 
 bool CmdNetSignalRemove::performExecute()
 {
+    addMemoryUsageOfObject(mNetSignal);
+
     performRedo(); // can throw
 
     return true;
@@ -31,6 +31,7 @@
 #include "componentsignalinstance.h"
 #include <librepcb/library/cmp/component.h>
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../schematics/items/si_symbol.h"
 #include "../boards/items/bi_device.h"
 
@@ -130,6 +131,7 @@ void ComponentInstance::init()
 
 ComponentInstance::~ComponentInstance() noexcept
 {
+    mCircuit.getProject().getErcMsgList().unscheduleUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
 
@@ -209,7 +211,8 @@ void ComponentInstance::setName(const QString& name)
                 tr("The new component name must not be empty!"));
         }
         mName = name;
-        updateErcMessages();
+        scheduleErcMessagesUpdate();
+        invalidateAttributeValues();
         emit attributesChanged();
     }
 }
@@ -218,6 +221,7 @@ void ComponentInstance::setValue(const QString& value) noexcept
 {
     if (value != mValue) {
         mValue = value;
+        invalidateAttributeValues();
         emit attributesChanged();
     }
 }
@@ -226,6 +230,7 @@ void ComponentInstance::setAttributes(const AttributeList& attributes) noexcept
 {
     if (attributes != *mAttributes) {
         *mAttributes = attributes;
+        invalidateAttributeValues();
         emit attributesChanged();
     }
 }
@@ -245,7 +250,7 @@ void ComponentInstance::addToCircuit()
         sgl.add([signal](){signal->removeFromCircuit();});
     }
     mIsAddedToCircuit = true;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     sgl.dismiss();
 }
 
@@ -265,7 +270,7 @@ void ComponentInstance::removeFromCircuit()
         sgl.add([signal](){signal->addToCircuit();});
     }
     mIsAddedToCircuit = false;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     sgl.dismiss();
 }
 
@@ -295,7 +300,7 @@ void ComponentInstance::registerSymbol(SI_Symbol& symbol)
         }
     }
     mRegisteredSymbols.insert(itemUuid, &symbol);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void ComponentInstance::unregisterSymbol(SI_Symbol& symbol)
@@ -307,7 +312,7 @@ void ComponentInstance::unregisterSymbol(SI_Symbol& symbol)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSymbols.remove(itemUuid);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void ComponentInstance::registerDevice(BI_Device& device)
@@ -318,7 +323,8 @@ void ComponentInstance::registerDevice(BI_Device& device)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredDevices.append(&device);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
+    invalidateAttributeValues();
     emit attributesChanged(); // parent attribute provider may have changed!
 }
 
@@ -328,7 +334,8 @@ void ComponentInstance::unregisterDevice(BI_Device& device)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredDevices.removeOne(&device);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
+    invalidateAttributeValues();
     emit attributesChanged(); // parent attribute provider may have changed!
 }
 
@@ -393,6 +400,11 @@ bool ComponentInstance::checkAttributesValidity() const noexcept
     return true;
 }
 
+void ComponentInstance::scheduleErcMessagesUpdate() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 void ComponentInstance::updateErcMessages() noexcept
 {
     int required = getUnplacedRequiredSymbolsCount();
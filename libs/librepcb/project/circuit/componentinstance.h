@@ -158,7 +158,8 @@ class ComponentInstance : public QObject, public AttributeProvider,
 
         void init();
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
         const QStringList& getLocaleOrder() const noexcept;
 
 
@@ -29,6 +29,7 @@
 #include "netsignal.h"
 #include <librepcb/library/cmp/component.h>
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
 #include "../settings/projectsettings.h"
 #include "../schematics/items/si_symbolpin.h"
@@ -86,7 +87,7 @@ void ComponentSignalInstance::init()
 
     // register to component attributes changed
     connect(&mComponentInstance, &ComponentInstance::attributesChanged,
-            this, &ComponentSignalInstance::updateErcMessages);
+            this, &ComponentSignalInstance::scheduleErcMessagesUpdate);
 
     // register to net signal name changed
     if (mNetSignal) {
@@ -99,6 +100,7 @@ void ComponentSignalInstance::init()
 
 ComponentSignalInstance::~ComponentSignalInstance() noexcept
 {
+    mCircuit.getProject().getErcMsgList().unscheduleUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
     Q_ASSERT(!arePinsOrPadsUsed());
@@ -177,7 +179,7 @@ void ComponentSignalInstance::setNetSignal(NetSignal* netsignal)
                       this, &ComponentSignalInstance::netSignalNameChanged);});
     }
     mNetSignal = netsignal;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     sgl.dismiss();
     emit netSignalChanged(mNetSignal);
 }
@@ -195,7 +197,7 @@ void ComponentSignalInstance::addToCircuit()
         mNetSignal->registerComponentSignal(*this); // can throw
     }
     mIsAddedToCircuit = true;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void ComponentSignalInstance::removeFromCircuit()
@@ -212,7 +214,7 @@ void ComponentSignalInstance::removeFromCircuit()
         mNetSignal->unregisterComponentSignal(*this); // can throw
     }
     mIsAddedToCircuit = false;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void ComponentSignalInstance::registerSymbolPin(SI_SymbolPin& pin)
@@ -276,7 +278,12 @@ bool ComponentSignalInstance::checkAttributesValidity() const noexcept
 void ComponentSignalInstance::netSignalNameChanged(const QString& newName) noexcept
 {
     Q_UNUSED(newName);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
+}
+
+void ComponentSignalInstance::scheduleErcMessagesUpdate() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void ComponentSignalInstance::updateErcMessages() noexcept
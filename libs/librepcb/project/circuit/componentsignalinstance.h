@@ -123,7 +123,8 @@ class ComponentSignalInstance final : public QObject, public IF_ErcMsgProvider,
     private slots:
 
         void netSignalNameChanged(const QString& newName) noexcept;
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
 
 
     private:
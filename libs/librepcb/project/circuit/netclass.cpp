@@ -26,6 +26,7 @@
 #include "netsignal.h"
 #include "circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -60,6 +61,7 @@ NetClass::NetClass(Circuit& circuit, const QString& name) :
 
 NetClass::~NetClass() noexcept
 {
+    mCircuit.getProject().getErcMsgList().unscheduleUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
 }
@@ -78,7 +80,7 @@ void NetClass::setName(const QString& name)
             tr("The new netclass name must not be empty!"));
     }
     mName = name;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 /*****************************************************************************************
@@ -91,7 +93,7 @@ void NetClass::addToCircuit()
         throw LogicError(__FILE__, __LINE__);
     }
     mIsAddedToCircuit = true;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetClass::removeFromCircuit()
@@ -105,7 +107,7 @@ void NetClass::removeFromCircuit()
             .arg(mName));
     }
     mIsAddedToCircuit = false;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetClass::registerNetSignal(NetSignal& signal)
@@ -116,7 +118,7 @@ void NetClass::registerNetSignal(NetSignal& signal)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredNetSignals.insert(signal.getUuid(), &signal);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetClass::unregisterNetSignal(NetSignal& signal)
@@ -125,7 +127,7 @@ void NetClass::unregisterNetSignal(NetSignal& signal)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredNetSignals.remove(signal.getUuid());
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetClass::serialize(SExpression& root) const
@@ -147,6 +149,11 @@ bool NetClass::checkAttributesValidity() const noexcept
     return true;
 }
 
+void NetClass::scheduleErcMessagesUpdate() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 void NetClass::updateErcMessages() noexcept
 {
     if (mIsAddedToCircuit && (!isUsed())) {
@@ -86,7 +86,8 @@ class NetClass final : public QObject, public IF_ErcMsgProvider,
 
     private:
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
 
 
         // General
@@ -26,6 +26,7 @@
 #include <librepcb/common/exceptions.h>
 #include "circuit.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "componentsignalinstance.h"
 #include "../schematics/items/si_netsegment.h"
 #include "../boards/items/bi_netsegment.h"
@@ -68,6 +69,7 @@ NetSignal::NetSignal(Circuit& circuit, NetClass& netclass, const QString& name,
 
 NetSignal::~NetSignal() noexcept
 {
+    mCircuit.getProject().getErcMsgList().unscheduleUpdate(*this);
     Q_ASSERT(!mIsAddedToCircuit);
     Q_ASSERT(!isUsed());
 }
@@ -116,7 +118,7 @@ void NetSignal::setName(const QString& name, bool isAutoName)
     }
     mName = name;
     mHasAutoName = isAutoName;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
     emit nameChanged(mName);
 }
 
@@ -139,7 +141,7 @@ void NetSignal::addToCircuit()
     }
     mNetClass->registerNetSignal(*this); // can throw
     mIsAddedToCircuit = true;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::removeFromCircuit()
@@ -154,7 +156,7 @@ void NetSignal::removeFromCircuit()
     }
     mNetClass->unregisterNetSignal(*this); // can throw
     mIsAddedToCircuit = false;
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerComponentSignal(ComponentSignalInstance& signal)
@@ -165,7 +167,7 @@ void NetSignal::registerComponentSignal(ComponentSignalInstance& signal)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredComponentSignals.append(&signal);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal)
@@ -174,7 +176,7 @@ void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredComponentSignals.removeOne(&signal);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment)
@@ -185,7 +187,7 @@ void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSchematicNetSegments.append(&netsegment);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment)
@@ -194,7 +196,7 @@ void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSchematicNetSegments.removeOne(&netsegment);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment)
@@ -205,7 +207,7 @@ void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardNetSegments.append(&netsegment);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment)
@@ -214,7 +216,7 @@ void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardNetSegments.removeOne(&netsegment);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerBoardPlane(BI_Plane& plane)
@@ -225,7 +227,7 @@ void NetSignal::registerBoardPlane(BI_Plane& plane)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardPlanes.append(&plane);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardPlane(BI_Plane& plane)
@@ -234,7 +236,7 @@ void NetSignal::unregisterBoardPlane(BI_Plane& plane)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardPlanes.removeOne(&plane);
-    updateErcMessages();
+    scheduleErcMessagesUpdate();
 }
 
 void NetSignal::serialize(SExpression& root) const
@@ -259,6 +261,11 @@ bool NetSignal::checkAttributesValidity() const noexcept
     return true;
 }
 
+void NetSignal::scheduleErcMessagesUpdate() noexcept
+{
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 void NetSignal::updateErcMessages() noexcept
 {
     if (mIsAddedToCircuit && (!isUsed())) {
@@ -40,8 +40,14 @@ namespace project {
 
 ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool create) :
     QObject(&project), mProject(project),
-    mFilepath(project.getPath().getPathTo("core/erc.lp")), mFile(nullptr)
+    mFilepath(project.getPath().getPathTo("core/erc.lp")), mFile(nullptr),
+    mEvaluationCount(0)
 {
+    mScheduledUpdateTimer.setSingleShot(true);
+    mScheduledUpdateTimer.setInterval(0);
+    connect(&mScheduledUpdateTimer, &QTimer::timeout,
+            this, &ErcMsgList::updateScheduledProviders);
+
     // try to create/open the file "erc.lp"
     if (create) {
         mFile.reset(SmartSExprFile::create(mFilepath));
@@ -53,6 +59,7 @@ ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool creat
 ErcMsgList::~ErcMsgList() noexcept
 {
     Q_ASSERT(mItems.isEmpty());
+    Q_ASSERT(mScheduledProviders.isEmpty());
 }
 
 /*****************************************************************************************
@@ -62,8 +69,9 @@ ErcMsgList::~ErcMsgList() noexcept
 void ErcMsgList::add(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(!mItems.contains(ercMsg));
+    Q_ASSERT(!mItemIndices.contains(ercMsg));
     Q_ASSERT(!ercMsg->isIgnored());
+    mItemIndices.insert(ercMsg, mItems.count());
     mItems.append(ercMsg);
     emit ercMsgAdded(ercMsg);
 }
@@ -71,36 +79,82 @@ void ErcMsgList::add(ErcMsg* ercMsg) noexcept
 void ErcMsgList::remove(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(mItems.contains(ercMsg));
+    Q_ASSERT(mItemIndices.contains(ercMsg));
     Q_ASSERT(!ercMsg->isIgnored());
-    mItems.removeOne(ercMsg);
+    // move the last item into the gap to avoid shifting the whole list
+    int index = mItemIndices.take(ercMsg);
+    ErcMsg* last = mItems.takeLast();
+    if (last != ercMsg) {
+        mItems[index] = last;
+        mItemIndices[last] = index;
+    }
     emit ercMsgRemoved(ercMsg);
 }
 
 void ErcMsgList::update(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
-    Q_ASSERT(mItems.contains(ercMsg));
+    Q_ASSERT(mItemIndices.contains(ercMsg));
     Q_ASSERT(ercMsg->isVisible());
     emit ercMsgChanged(ercMsg);
 }
 
+void ErcMsgList::scheduleUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    mScheduledProviders.insert(&provider);
+    if (!mScheduledUpdateTimer.isActive()) {
+        mScheduledUpdateTimer.start();
+    }
+}
+
+void ErcMsgList::unscheduleUpdate(IF_ErcMsgProvider& provider) noexcept
+{
+    mScheduledProviders.remove(&provider);
+}
+
+void ErcMsgList::updateScheduledProviders() noexcept
+{
+    mScheduledUpdateTimer.stop();
+    // updating an object may schedule other objects, so repeat until nothing is left
+    while (!mScheduledProviders.isEmpty()) {
+        QSet<IF_ErcMsgProvider*> providers;
+        providers.swap(mScheduledProviders);
+        foreach (IF_ErcMsgProvider* provider, providers) {
+            provider->updateErcMessages();
+            ++mEvaluationCount;
+        }
+    }
+}
+
 void ErcMsgList::restoreIgnoreState()
 {
     if (mFile->isCreated()) return; // the file does not yet exist
 
     SExpression root = mFile->parseFileAndBuildDomTree();
 
+    // all messages need to exist before their ignore state can be restored
+    updateScheduledProviders();
+
     // reset all ignore attributes
     foreach (ErcMsg* ercMsg, mItems)
         ercMsg->setIgnored(false);
 
+    // index the messages by their owner key since each owner has only a few messages
+    QMultiHash<QString, ErcMsg*> ercMsgsByOwnerKey;
+    ercMsgsByOwnerKey.reserve(mItems.count());
+    foreach (ErcMsg* ercMsg, mItems)
+        ercMsgsByOwnerKey.insert(ercMsg->getOwnerKey(), ercMsg);
+
     // scan approved items and set ignore attributes
     foreach (const SExpression& node, root.getChildren("approved")) {
-        foreach (ErcMsg* ercMsg, mItems) {
-            if ((ercMsg->getOwner().getErcMsgOwnerClassName() == node.getValueByPath<QString>("class", false))
-             && (ercMsg->getOwnerKey() == node.getValueByPath<QString>("instance", false))
-             && (ercMsg->getMsgKey() == node.getValueByPath<QString>("message", false)))
+        QString className = node.getValueByPath<QString>("class", false);
+        QString ownerKey = node.getValueByPath<QString>("instance", false);
+        QString msgKey = node.getValueByPath<QString>("message", false);
+        auto it = ercMsgsByOwnerKey.constFind(ownerKey);
+        for (; (it != ercMsgsByOwnerKey.constEnd()) && (it.key() == ownerKey); ++it) {
+            ErcMsg* ercMsg = it.value();
+            if ((ercMsg->getMsgKey() == msgKey)
+             && (className == ercMsg->getOwner().getErcMsgOwnerClassName()))
             {
                 ercMsg->setIgnored(true);
             }
@@ -112,6 +166,9 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
+    // serialize the messages of the current state, not of the last evaluation
+    updateScheduledProviders();
+
     // Save "core/erc.lp"
     try
     {
@@ -133,13 +190,24 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
 
 void ErcMsgList::serialize(SExpression& root) const
 {
+    // sort the messages since the order of #mItems is not stable
+    QList<ErcMsg*> ignoredMsgs;
     foreach (ErcMsg* ercMsg, mItems) {
-        if (ercMsg->isIgnored()) {
-            SExpression& itemNode = root.appendList("approved", true);
-            itemNode.appendStringChild("class", ercMsg->getOwner().getErcMsgOwnerClassName(), true);
-            itemNode.appendStringChild("instance", ercMsg->getOwnerKey(), true);
-            itemNode.appendStringChild("message", ercMsg->getMsgKey(), true);
-        }
+        if (ercMsg->isIgnored()) ignoredMsgs.append(ercMsg);
+    }
+    std::sort(ignoredMsgs.begin(), ignoredMsgs.end(), [](const ErcMsg* a, const ErcMsg* b) {
+        int cmp = qstrcmp(a->getOwner().getErcMsgOwnerClassName(),
+                          b->getOwner().getErcMsgOwnerClassName());
+        if (cmp != 0) return cmp < 0;
+        if (a->getOwnerKey() != b->getOwnerKey()) return a->getOwnerKey() < b->getOwnerKey();
+        return a->getMsgKey() < b->getMsgKey();
+    });
+
+    foreach (ErcMsg* ercMsg, ignoredMsgs) {
+        SExpression& itemNode = root.appendList("approved", true);
+        itemNode.appendStringChild("class", ercMsg->getOwner().getErcMsgOwnerClassName(), true);
+        itemNode.appendStringChild("instance", ercMsg->getOwnerKey(), true);
+        itemNode.appendStringChild("message", ercMsg->getMsgKey(), true);
     }
 }
 
@@ -39,6 +39,7 @@ namespace project {
 
 class Project;
 class ErcMsg;
+class IF_ErcMsgProvider;
 
 /*****************************************************************************************
  *  Class ErcMsgList
@@ -46,6 +47,13 @@ class ErcMsg;
 
 /**
  * @brief The ErcMsgList class contains a list of ERC messages which are visible for the user
+ *
+ * It also schedules the evaluation of the ERC messages: Objects which implement
+ * librepcb::project::IF_ErcMsgProvider don't update their messages immediately on every
+ * modification, but call #scheduleUpdate() instead. All scheduled objects are then
+ * evaluated only once when the event loop is entered again (or explicitly with
+ * #updateScheduledProviders()), so loading or bulk-editing a project doesn't lead to
+ * thousands of redundant evaluations.
  */
 class ErcMsgList final : public QObject, public SerializableObject
 {
@@ -62,10 +70,21 @@ class ErcMsgList final : public QObject, public SerializableObject
         // Getters
         const QList<ErcMsg*>& getItems() const noexcept {return mItems;}
 
+        /**
+         * @brief Get the total number of ERC evaluations (for profiling)
+         *
+         * The difference of this counter before and after an operation is the number of
+         * librepcb::project::IF_ErcMsgProvider::updateErcMessages() calls it caused.
+         */
+        quint64 getEvaluationCount() const noexcept {return mEvaluationCount;}
+
         // General Methods
         void add(ErcMsg* ercMsg) noexcept;
         void remove(ErcMsg* ercMsg) noexcept;
         void update(ErcMsg* ercMsg) noexcept;
+        void scheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+        void unscheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+        void updateScheduledProviders() noexcept;
         void restoreIgnoreState();
         bool save(bool toOriginal, QStringList& errors) noexcept;
         
@@ -95,6 +114,12 @@ class ErcMsgList final : public QObject, public SerializableObject
 
         // Misc
         QList<ErcMsg*> mItems; ///< contains all visible ERC messages
+        QHash<ErcMsg*, int> mItemIndices; ///< index in #mItems of each message
+
+        // Scheduler
+        QSet<IF_ErcMsgProvider*> mScheduledProviders; ///< objects to evaluate
+        QTimer mScheduledUpdateTimer; ///< to evaluate objects in the next event loop
+        quint64 mEvaluationCount; ///< see #getEvaluationCount()
 };
 
 /*****************************************************************************************
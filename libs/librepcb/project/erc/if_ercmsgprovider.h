@@ -63,6 +63,18 @@ class IF_ErcMsgProvider
 
         // Getters
         virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+        // General Methods
+
+        /**
+         * @brief Create, update or remove all ERC messages of this object
+         *
+         * Don't call this directly after every modification, but schedule it with
+         * librepcb::project::ErcMsgList::scheduleUpdate() to evaluate each object only
+         * once per operation. Scheduled objects must be unscheduled with
+         * librepcb::project::ErcMsgList::unscheduleUpdate() when they are destroyed.
+         */
+        virtual void updateErcMessages() noexcept = 0;
 };
 
 /*****************************************************************************************
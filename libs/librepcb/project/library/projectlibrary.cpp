@@ -197,6 +197,20 @@ bool ProjectLibrary::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QList<FilePath> ProjectLibrary::getElementMainFiles(const FilePath& libraryDir) noexcept
+{
+    QList<FilePath> files;
+    appendElementMainFiles<Symbol>    (libraryDir.getPathTo("sym"), files);
+    appendElementMainFiles<Package>   (libraryDir.getPathTo("pkg"), files);
+    appendElementMainFiles<Component> (libraryDir.getPathTo("cmp"), files);
+    appendElementMainFiles<Device>    (libraryDir.getPathTo("dev"), files);
+    return files;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -240,6 +254,20 @@ void ProjectLibrary::loadElements(const FilePath& directory, const QString& type
     qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
 }
 
+template <typename ElementType>
+void ProjectLibrary::appendElementMainFiles(const FilePath& directory,
+                                            QList<FilePath>& files) noexcept
+{
+    // same directory filter as in loadElements()
+    QDir dir(directory.toStr());
+    dir.setFilter(QDir::AllDirs | QDir::NoDotAndDotDot | QDir::Readable);
+    dir.setNameFilters(QStringList() << QString("*.%1").arg(directory.getBasename()));
+    foreach (const QString& dirname, dir.entryList()) {
+        files.append(directory.getPathTo(dirname).getPathTo(
+                         ElementType::getLongElementName() % ".lp"));
+    }
+}
+
 template <typename ElementType>
 void ProjectLibrary::addElement(ElementType& element,
                                 QHash<Uuid, ElementType*>& elementList,
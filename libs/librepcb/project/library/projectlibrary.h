@@ -92,6 +92,20 @@ class ProjectLibrary final : public QObject
         // General Methods
         bool save(bool toOriginal, QStringList& errors) noexcept;
 
+        // Static Methods
+
+        /**
+         * @brief Get the main files of all library elements in a project library
+         *
+         * This is used to read and parse these files in advance (in parallel), see
+         * librepcb::SExprFilePreloader.
+         *
+         * @param libraryDir    The "library" directory of the project
+         *
+         * @return All main files (e.g. "sym/<uuid>/symbol.lp") which would be loaded
+         */
+        static QList<FilePath> getElementMainFiles(const FilePath& libraryDir) noexcept;
+
 
     private:
 
@@ -105,6 +119,9 @@ class ProjectLibrary final : public QObject
         void loadElements(const FilePath& directory, const QString& type,
                           QHash<Uuid, ElementType*>& elementList);
         template <typename ElementType>
+        static void appendElementMainFiles(const FilePath& directory,
+                                           QList<FilePath>& files) noexcept;
+        template <typename ElementType>
         void addElement(ElementType& element,
                         QHash<Uuid, ElementType*>& elementList,
                         QList<ElementType*>& addedElementsList,
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "projectmetadata.h"
 #include <librepcb/common/systeminfo.h>
+#include <librepcb/common/attributes/attributeprovider.h>
 #include <librepcb/common/fileio/smartsexprfile.h>
 #include <librepcb/common/fileio/sexpression.h>
 #include "../project.h"
@@ -88,6 +89,7 @@ void ProjectMetadata::setName(const QString& newName) noexcept
 {
     if (newName != mName) {
         mName = newName;
+        AttributeProvider::invalidateAttributeValues();
         emit attributesChanged();
     }
 }
@@ -96,6 +98,7 @@ void ProjectMetadata::setAuthor(const QString& newAuthor) noexcept
 {
     if (newAuthor != mAuthor) {
         mAuthor = newAuthor;
+        AttributeProvider::invalidateAttributeValues();
         emit attributesChanged();
     }
 }
@@ -104,6 +107,7 @@ void ProjectMetadata::setVersion(const QString& newVersion) noexcept
 {
     if (newVersion != mVersion) {
         mVersion = newVersion;
+        AttributeProvider::invalidateAttributeValues();
         emit attributesChanged();
     }
 }
@@ -112,6 +116,7 @@ void ProjectMetadata::setAttributes(const AttributeList& newAttributes) noexcept
 {
     if (newAttributes != mAttributes) {
         mAttributes = newAttributes;
+        AttributeProvider::invalidateAttributeValues();
         emit attributesChanged();
     }
 }
@@ -119,6 +124,7 @@ void ProjectMetadata::setAttributes(const AttributeList& newAttributes) noexcept
 void ProjectMetadata::updateLastModified() noexcept
 {
     mLastModified = QDateTime::currentDateTime();
+    AttributeProvider::invalidateAttributeValues();
     emit attributesChanged();
 }
 
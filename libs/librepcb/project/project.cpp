@@ -28,6 +28,8 @@
 #include <librepcb/common/fileio/smartsexprfile.h>
 #include <librepcb/common/fileio/smartversionfile.h>
 #include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/common/fileio/sexprfilecache.h>
+#include <librepcb/common/fileio/sexprfilepreloader.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include "project.h"
 #include "library/projectlibrary.h"
@@ -50,7 +52,8 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-Project::Project(const FilePath& filepath, bool create, bool readOnly) :
+Project::Project(const FilePath& filepath, bool create, bool readOnly,
+                 const FilePath& cacheFile) :
     QObject(nullptr), AttributeProvider(), mPath(filepath.getParentDir()),
     mFilepath(filepath), mLock(filepath.getParentDir()), mIsRestored(false),
     mIsReadOnly(readOnly)
@@ -176,52 +179,107 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
             mProjectFile.reset(new SmartTextFile(mFilepath, mIsRestored, mIsReadOnly));
         }
 
+        // open the schematics and boards list files
+        FilePath schematicsFilepath = mPath.getPathTo("core/schematics.lp");
+        FilePath boardsFilepath = mPath.getPathTo("core/boards.lp");
+        QList<FilePath> schematicFilepaths;
+        QList<FilePath> boardFilepaths;
+        if (create) {
+            mSchematicsFile.reset(SmartSExprFile::create(schematicsFilepath));
+            mBoardsFile.reset(SmartSExprFile::create(boardsFilepath));
+        } else {
+            mSchematicsFile.reset(new SmartSExprFile(schematicsFilepath, mIsRestored, mIsReadOnly));
+            SExpression schRoot = mSchematicsFile->parseFileAndBuildDomTree();
+            foreach (const SExpression& node, schRoot.getChildren("schematic")) {
+                schematicFilepaths.append(FilePath::fromRelative(mPath,
+                    node.getValueOfFirstChild<QString>(true)));
+            }
+            mBoardsFile.reset(new SmartSExprFile(boardsFilepath, mIsRestored, mIsReadOnly));
+            SExpression brdRoot = mBoardsFile->parseFileAndBuildDomTree();
+            foreach (const SExpression& node, brdRoot.getChildren("board")) {
+                boardFilepaths.append(FilePath::fromRelative(mPath,
+                    node.getValueOfFirstChild<QString>(true)));
+            }
+        }
+
+        // Read and parse all files in parallel worker threads. The objects are still
+        // created sequentially below, but they get the preloaded DOM trees instead of
+        // reading and parsing the files on their own (see SExprFilePreloader).
+        QElapsedTimer timer;
+        timer.start();
+        QStringList timings;
+        QScopedPointer<SExprFileCache> cache;
+        if (cacheFile.isValid() && (!create)) {
+            cache.reset(new SExprFileCache(cacheFile));
+        }
+        SExprFilePreloader preloader(cache.data());
+        if (!create) {
+            QList<FilePath> files;
+            files << mPath.getPathTo("core/metadata.lp")
+                  << mPath.getPathTo("core/settings.lp")
+                  << mPath.getPathTo("core/circuit.lp")
+                  << mPath.getPathTo("core/erc.lp");
+            files << schematicFilepaths << boardFilepaths;
+            foreach (const FilePath& fp, boardFilepaths) {
+                files << mPath.getPathTo("user/boards/" % fp.getFilename());
+            }
+            preloader.preload(files, mIsRestored);
+            // library elements are never restored from backup files
+            preloader.preload(ProjectLibrary::getElementMainFiles(
+                                  mPath.getPathTo("library")), false);
+        }
+
         // Create all needed objects
         mProjectMetadata.reset(new ProjectMetadata(*this, mIsRestored, mIsReadOnly, create));
         connect(mProjectMetadata.data(), &ProjectMetadata::attributesChanged,
                 this, &Project::attributesChanged);
         mProjectSettings.reset(new ProjectSettings(*this, mIsRestored, mIsReadOnly, create));
+        timings << QString("metadata+settings: %1").arg(timer.restart());
         mProjectLibrary.reset(new ProjectLibrary(*this, mIsRestored, mIsReadOnly));
+        timings << QString("library: %1").arg(timer.restart());
         mErcMsgList.reset(new ErcMsgList(*this, mIsRestored, mIsReadOnly, create));
         mCircuit.reset(new Circuit(*this, mIsRestored, mIsReadOnly, create));
+        timings << QString("circuit: %1").arg(timer.restart());
 
         // Load all schematic layers
         mSchematicLayerProvider.reset(new SchematicLayerProvider(*this));
 
         // Load all schematics
-        FilePath schematicsFilepath = mPath.getPathTo("core/schematics.lp");
-        if (create) {
-            mSchematicsFile.reset(SmartSExprFile::create(schematicsFilepath));
-        } else {
-            mSchematicsFile.reset(new SmartSExprFile(schematicsFilepath, mIsRestored, mIsReadOnly));
-            SExpression schRoot = mSchematicsFile->parseFileAndBuildDomTree();
-            foreach (const SExpression& node, schRoot.getChildren("schematic")) {
-                FilePath fp = FilePath::fromRelative(mPath, node.getValueOfFirstChild<QString>(true));
-                Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly);
-                addSchematic(*schematic);
-            }
+        foreach (const FilePath& fp, schematicFilepaths) {
+            Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly);
+            addSchematic(*schematic);
+        }
+        if (!create) {
             qDebug() << mSchematics.count() << "schematics successfully loaded!";
         }
+        timings << QString("schematics: %1").arg(timer.restart());
 
         // Load all boards
-        FilePath boardsFilepath = mPath.getPathTo("core/boards.lp");
-        if (create) {
-            mBoardsFile.reset(SmartSExprFile::create(boardsFilepath));
-        } else {
-            mBoardsFile.reset(new SmartSExprFile(boardsFilepath, mIsRestored, mIsReadOnly));
-            SExpression brdRoot = mBoardsFile->parseFileAndBuildDomTree();
-            foreach (const SExpression& node, brdRoot.getChildren("board")) {
-                FilePath fp = FilePath::fromRelative(mPath, node.getValueOfFirstChild<QString>(true));
-                Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly);
-                addBoard(*board);
-            }
+        foreach (const FilePath& fp, boardFilepaths) {
+            Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly);
+            addBoard(*board);
+        }
+        if (!create) {
             qDebug() << mBoards.count() << "boards successfully loaded!";
         }
+        timings << QString("boards: %1").arg(timer.restart());
 
         // at this point, the whole circuit with all schematics and boards is successfully
         // loaded, so the ERC list now contains all the correct ERC messages.
         // So we can now restore the ignore state of each ERC message from the file.
         mErcMsgList->restoreIgnoreState(); // can throw
+        timings << QString("erc: %1").arg(timer.restart());
+        timings << QString("parsing in worker threads: %1").arg(preloader.getWorkerTimeMs());
+        if (!create) {
+            qDebug() << "project loading times [ms]:" << qPrintable(timings.join(", "));
+        }
+        if (cache) {
+            try {
+                cache->save(); // can throw
+            } catch (const Exception& e) {
+                qWarning() << "Could not save the project file cache:" << e.getMsg();
+            }
+        }
 
         if (create) save(true); // write all files to harddisc
     }
@@ -327,6 +385,7 @@ void Project::addSchematic(Schematic& schematic, int newIndex)
         mRemovedSchematics.removeOne(&schematic);
     }
 
+    invalidateAttributeValues();
     emit schematicAdded(newIndex);
     emit attributesChanged();
 }
@@ -348,6 +407,7 @@ void Project::removeSchematic(Schematic& schematic, bool deleteSchematic)
     schematic.removeFromProject(); // can throw
     mSchematics.removeAt(index);
 
+    invalidateAttributeValues();
     emit schematicRemoved(index);
     emit attributesChanged();
 
@@ -460,6 +520,7 @@ void Project::addBoard(Board& board, int newIndex)
         mRemovedBoards.removeOne(&board);
     }
 
+    invalidateAttributeValues();
     emit boardAdded(newIndex);
     emit attributesChanged();
 }
@@ -476,6 +537,7 @@ void Project::removeBoard(Board& board, bool deleteBoard)
     board.removeFromProject(); // can throw
     mBoards.removeAt(index);
 
+    invalidateAttributeValues();
     emit boardRemoved(index);
     emit attributesChanged();
 
@@ -95,7 +95,24 @@ class Project final : public QObject, public AttributeProvider
          * @throw Exception     If the project could not be opened successfully
          */
         Project(const FilePath& filepath, bool readOnly) :
-            Project(filepath, false, readOnly) {}
+            Project(filepath, false, readOnly, FilePath()) {}
+
+        /**
+         * @brief The constructor to open an existing project using a file cache
+         *
+         * Same as #Project(const FilePath&, bool), but the parsed DOM trees of all project
+         * files are cached in a binary cache file to speed up opening the project the
+         * next time (see librepcb::SExprFileCache).
+         *
+         * @param filepath      The filepath to the an existing *.lpp project file
+         * @param readOnly      It true, the project will be opened in read-only mode
+         * @param cacheFile     The filepath to the cache file (will be created if it
+         *                      does not exist yet)
+         *
+         * @throw Exception     If the project could not be opened successfully
+         */
+        Project(const FilePath& filepath, bool readOnly, const FilePath& cacheFile) :
+            Project(filepath, false, readOnly, cacheFile) {}
 
         /**
          * @brief The destructor will close the whole project (without saving!)
@@ -386,7 +403,7 @@ class Project final : public QObject, public AttributeProvider
         // Static Methods
 
         static Project* create(const FilePath& filepath)
-        {return new Project(filepath, true, false);}
+        {return new Project(filepath, true, false, FilePath());}
 
         static bool isFilePathInsideProjectDirectory(const FilePath& fp) noexcept;
         static bool isProjectFile(const FilePath& file) noexcept;
@@ -439,10 +456,12 @@ class Project final : public QObject, public AttributeProvider
          * @param create        True if the specified project does not exist already and
          *                      must be created.
          * @param readOnly      If true, the project will be opened in read-only mode
+         * @param cacheFile     The filepath to the file cache (invalid path = no cache)
          *
          * @throw Exception     If the project could not be created/opened successfully
          */
-        explicit Project(const FilePath& filepath, bool create, bool readOnly);
+        explicit Project(const FilePath& filepath, bool create, bool readOnly,
+                         const FilePath& cacheFile);
 
         /**
          * @brief Save the project to the harddisc (to temporary or original files)
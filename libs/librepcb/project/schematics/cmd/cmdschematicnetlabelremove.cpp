@@ -52,6 +52,8 @@ CmdSchematicNetLabelRemove::~CmdSchematicNetLabelRemove() noexcept
 
 bool CmdSchematicNetLabelRemove::performExecute()
 {
+    addMemoryUsageOfObject(mNetLabel);
+
     performRedo(); // can throw
 
     return true;
@@ -51,6 +51,8 @@ CmdSchematicNetSegmentRemove::~CmdSchematicNetSegmentRemove() noexcept
 
 bool CmdSchematicNetSegmentRemove::performExecute()
 {
+    addMemoryUsageOfObject(mNetSegment);
+
     performRedo(); // can throw
 
     return true;
@@ -53,6 +53,8 @@ bool CmdSchematicRemove::performExecute()
 {
     mPageIndex = mProject.getSchematicIndex(mSchematic);
 
+    addMemoryUsageOfObject(mSchematic);
+
     performRedo(); // can throw
 
     return true;
@@ -51,6 +51,8 @@ CmdSymbolInstanceRemove::~CmdSymbolInstanceRemove() noexcept
 
 bool CmdSymbolInstanceRemove::performExecute()
 {
+    addMemoryUsageOfObject(mSymbol);
+
     performRedo(); // can throw
 
     return true;
@@ -43,6 +43,19 @@ SGI_Base::~SGI_Base() noexcept
 
 }
 
+/*****************************************************************************************
+ *  Inherited from QGraphicsItem
+ ****************************************************************************************/
+
+bool SGI_Base::sceneEvent(QEvent* event)
+{
+    if (event->type() == QEvent::GraphicsSceneHelp) {
+        QString text = getToolTipText();
+        if (text != toolTip()) setToolTip(text);
+    }
+    return QGraphicsItem::sceneEvent(event);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -49,6 +49,21 @@ class SGI_Base : public QGraphicsItem
         virtual ~SGI_Base() noexcept;
 
 
+    protected:
+
+        /**
+         * @brief Get the tooltip text of this item
+         *
+         * The text is requested only when the tooltip is about to be shown (see
+         * librepcb::GraphicsScene::helpEvent()), so it is always up to date and does not
+         * need to be updated when the item's state changes.
+         */
+        virtual QString getToolTipText() const noexcept {return QString();}
+
+        // Inherited from QGraphicsItem
+        bool sceneEvent(QEvent* event) override;
+
+
     private:
 
         // make some methods inaccessible...
@@ -42,7 +42,7 @@ namespace project {
  ****************************************************************************************/
 
 SGI_NetLine::SGI_NetLine(SI_NetLine& netline) noexcept :
-    SGI_Base(), mNetLine(netline), mLayer(nullptr)
+    SGI_Base(), mNetLine(netline), mLayer(nullptr), mShapeOutdated(true)
 {
     setZValue(Schematic::ZValue_NetLines);
 
@@ -62,22 +62,13 @@ SGI_NetLine::~SGI_NetLine() noexcept
 
 void SGI_NetLine::updateCacheAndRepaint() noexcept
 {
-    setToolTip(mNetLine.getNetSignalOfNetSegment().getName());
-
     prepareGeometryChange();
     mLineF.setP1(mNetLine.getStartPoint().getPosition().toPxQPointF());
     mLineF.setP2(mNetLine.getEndPoint().getPosition().toPxQPointF());
     mBoundingRect = QRectF(mLineF.p1(), mLineF.p2()).normalized();
     mBoundingRect.adjust(-mNetLine.getWidth().toPx()/2, -mNetLine.getWidth().toPx()/2,
                          mNetLine.getWidth().toPx()/2, mNetLine.getWidth().toPx()/2);
-    mShape = QPainterPath();
-    mShape.moveTo(mNetLine.getStartPoint().getPosition().toPxQPointF());
-    mShape.lineTo(mNetLine.getEndPoint().getPosition().toPxQPointF());
-    QPainterPathStroker ps;
-    ps.setCapStyle(Qt::RoundCap);
-    Length width = (mNetLine.getWidth() > Length(1270000) ? mNetLine.getWidth() : Length(1270000));
-    ps.setWidth(width.toPx());
-    mShape = ps.createStroke(mShape);
+    mShapeOutdated = true;
     update();
 }
 
@@ -85,6 +76,23 @@ void SGI_NetLine::updateCacheAndRepaint() noexcept
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
 
+QPainterPath SGI_NetLine::shape() const
+{
+    // the shape is only needed for hit-testing, so it is built on demand
+    if (mShapeOutdated) {
+        QPainterPath path;
+        path.moveTo(mLineF.p1());
+        path.lineTo(mLineF.p2());
+        QPainterPathStroker ps;
+        ps.setCapStyle(Qt::RoundCap);
+        Length width = (mNetLine.getWidth() > Length(1270000) ? mNetLine.getWidth() : Length(1270000));
+        ps.setWidth(width.toPx());
+        mShape = ps.createStroke(path);
+        mShapeOutdated = false;
+    }
+    return mShape;
+}
+
 void SGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
     Q_UNUSED(option);
@@ -125,6 +133,15 @@ void SGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
 #endif
 }
 
+/*****************************************************************************************
+ *  Inherited from SGI_Base
+ ****************************************************************************************/
+
+QString SGI_NetLine::getToolTipText() const noexcept
+{
+    return mNetLine.getNetSignalOfNetSegment().getName();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
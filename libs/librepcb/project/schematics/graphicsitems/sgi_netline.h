@@ -58,7 +58,7 @@ class SGI_NetLine final : public SGI_Base
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const {return mBoundingRect;}
-        QPainterPath shape() const {return mShape;}
+        QPainterPath shape() const;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
 
 
@@ -69,6 +69,9 @@ class SGI_NetLine final : public SGI_Base
         SGI_NetLine(const SGI_NetLine& other) = delete;
         SGI_NetLine& operator=(const SGI_NetLine& rhs) = delete;
 
+        // Inherited from SGI_Base
+        QString getToolTipText() const noexcept override;
+
         // Private Methods
         GraphicsLayer* getLayer(const QString& name) const noexcept;
 
@@ -79,7 +82,8 @@ class SGI_NetLine final : public SGI_Base
         // Cached Attributes
         QLineF mLineF;
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        mutable QPainterPath mShape; ///< built on demand, see shape()
+        mutable bool mShapeOutdated;
 };
 
 /*****************************************************************************************
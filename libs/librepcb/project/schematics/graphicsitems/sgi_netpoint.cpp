@@ -69,8 +69,6 @@ SGI_NetPoint::~SGI_NetPoint() noexcept
 
 void SGI_NetPoint::updateCacheAndRepaint() noexcept
 {
-    setToolTip(mNetPoint.getNetSignalOfNetSegment().getName());
-
     prepareGeometryChange();
     mIsVisibleJunction = mNetPoint.isVisibleJunction();
     mIsOpenLineEnd = mNetPoint.isOpenLineEnd();
@@ -121,6 +119,15 @@ void SGI_NetPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
 #endif
 }
 
+/*****************************************************************************************
+ *  Inherited from SGI_Base
+ ****************************************************************************************/
+
+QString SGI_NetPoint::getToolTipText() const noexcept
+{
+    return mNetPoint.getNetSignalOfNetSegment().getName();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -68,6 +68,9 @@ class SGI_NetPoint final : public SGI_Base
         SGI_NetPoint(const SGI_NetPoint& other) = delete;
         SGI_NetPoint& operator=(const SGI_NetPoint& rhs) = delete;
 
+        // Inherited from SGI_Base
+        QString getToolTipText() const noexcept override;
+
         // Private Methods
         GraphicsLayer* getLayer(const QString& name) const noexcept;
 
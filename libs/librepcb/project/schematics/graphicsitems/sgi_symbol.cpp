@@ -30,6 +30,7 @@
 #include "../../project.h"
 #include "../../circuit/componentinstance.h"
 #include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/font/strokefont.h>
 #include <librepcb/library/sym/symbol.h>
 #include <librepcb/library/cmp/component.h>
 
@@ -44,7 +45,7 @@ namespace project {
  ****************************************************************************************/
 
 SGI_Symbol::SGI_Symbol(SI_Symbol& symbol) noexcept :
-    SGI_Base(), mSymbol(symbol), mLibSymbol(symbol.getLibSymbol())
+    SGI_Base(), mSymbol(symbol), mLibSymbol(symbol.getLibSymbol()), mShapeOutdated(true)
 {
     setZValue(Schematic::ZValue_Symbols);
 
@@ -68,65 +69,55 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
     prepareGeometryChange();
 
     mBoundingRect = QRectF();
-    mShape = QPainterPath();
-    mShape.setFillRule(Qt::WindingFill);
+    mGrabAreas.clear();
+    mShapeOutdated = true;
 
     // cross rect
     QRectF crossRect(-4, -4, 8, 8);
     mBoundingRect = mBoundingRect.united(crossRect);
-    mShape.addRect(crossRect);
+    QPainterPath crossRectPath;
+    crossRectPath.addRect(crossRect);
+    mGrabAreas.append(crossRectPath);
 
     // polygons
     for (const Polygon& polygon : mLibSymbol.getPolygons()) {
         QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
         qreal w = polygon.getLineWidth().toPx() / 2;
         mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
-        if (polygon.isGrabArea()) mShape = mShape.united(polygonPath);
+        if (polygon.isGrabArea()) mGrabAreas.append(polygonPath);
     }
 
     // texts
     mCachedTextProperties.clear();
     for (const Text& text : mLibSymbol.getTexts()) {
-        // create static text properties
-        CachedTextProperties_t props;
-
-        // get the text to display
-        props.text = AttributeSubstitutor::substitute(text.getText(), &mSymbol);
-
-        // calculate font metrics
-        props.fontPixelSize = qCeil(text.getHeight().toPx());
-        mFont.setPixelSize(props.fontPixelSize);
-        QFontMetricsF metrics(mFont);
-        props.scaleFactor = text.getHeight().toPx() / metrics.height();
-        props.textRect = metrics.boundingRect(QRectF(), text.getAlign().toQtAlign() |
-                                              Qt::TextDontClip, props.text);
-        QRectF scaledTextRect = QRectF(props.textRect.topLeft() * props.scaleFactor,
-                                       props.textRect.bottomRight() * props.scaleFactor);
-
-        // check rotation
+        // texts must never be upside down, so rotate them by 180° if needed
         Angle absAngle = text.getRotation() + mSymbol.getRotation();
         absAngle.mapTo180deg();
-        props.rotate180 = (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
+        bool rotate180 = (absAngle <= -Angle::deg90() || absAngle > Angle::deg90());
+        Alignment align = rotate180 ? text.getAlign().mirrored() : text.getAlign();
 
-        // calculate text position
-        scaledTextRect.translate(text.getPosition().toPxQPointF());
-
-        // text alignment
-        if (props.rotate180)
-            props.flags = text.getAlign().mirrored().toQtAlign();
-        else
-            props.flags = text.getAlign().toQtAlign();
-
-        // calculate text bounding rect
-        mBoundingRect = mBoundingRect.united(scaledTextRect);
-        props.textRect = QRectF(scaledTextRect.topLeft() / props.scaleFactor,
-                                scaledTextRect.bottomRight() / props.scaleFactor);
-        if (props.rotate180)
-        {
-            props.textRect = QRectF(-props.textRect.x(), -props.textRect.y(),
-                                    -props.textRect.width(), -props.textRect.height()).normalized();
+        // lay out the text with the stroke font
+        auto tmpl = mTextTemplates.find(&text);
+        if (tmpl == mTextTemplates.end()) {
+            tmpl = mTextTemplates.insert(&text, AttributeSubstitutionTemplate(text.getText()));
+        }
+        QString str = AttributeSubstitutor::substitute(*tmpl, &mSymbol);
+        QList<Path> paths;
+        foreach (Path path, StrokeFont::instance().stroke(str, text.getHeight(), align)) {
+            if (rotate180) path.rotate(Angle::deg180());
+            path.rotate(text.getRotation());
+            path.translate(text.getPosition());
+            paths.append(path);
         }
 
+        // create static text properties
+        CachedTextProperties_t props;
+        props.path = Path::toQPainterPathPx(paths);
+        props.strokeWidth = StrokeFont::calcStrokeWidth(text.getHeight()).toPx();
+        qreal w = props.strokeWidth / 2;
+        props.boundingRect = props.path.boundingRect().adjusted(-w, -w, w, w);
+        mBoundingRect = mBoundingRect.united(props.boundingRect);
+
         // save properties
         mCachedTextProperties.insert(&text, props);
     }
@@ -138,6 +129,21 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
 
+QPainterPath SGI_Symbol::shape() const noexcept
+{
+    // uniting the grab areas is expensive and only needed for hit-testing, so the shape
+    // is built on demand
+    if (mShapeOutdated) {
+        mShape = QPainterPath();
+        foreach (const QPainterPath& area, mGrabAreas) {
+            mShape = mShape.united(area);
+        }
+        mShape.setFillRule(Qt::WindingFill);
+        mShapeOutdated = false;
+    }
+    return mShape;
+}
+
 void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
     Q_UNUSED(widget);
@@ -202,26 +208,20 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
 
         // get cached text properties
         const CachedTextProperties_t& props = mCachedTextProperties.value(&text);
-        mFont.setPixelSize(props.fontPixelSize);
 
         // draw text or rect
-        painter->save();
-        painter->translate(text.getPosition().toPxQPointF());
-        painter->rotate(-text.getRotation().toDeg());
-        painter->translate(-text.getPosition().toPxQPointF());
-        painter->scale(props.scaleFactor, props.scaleFactor);
-        if (props.rotate180) painter->rotate(180);
         if ((deviceIsPrinter) || (lod * text.getHeight().toPx() > 8))
         {
             // draw text
-            painter->setPen(QPen(layer->getColor(selected), 0));
-            painter->setFont(mFont);
-            painter->drawText(props.textRect, props.flags, props.text);
+            painter->setPen(QPen(layer->getColor(selected), props.strokeWidth, Qt::SolidLine,
+                                 Qt::RoundCap, Qt::RoundJoin));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawPath(props.path);
         }
         else
         {
             // fill rect
-            painter->fillRect(props.textRect, QBrush(layer->getColor(selected), Qt::Dense5Pattern));
+            painter->fillRect(props.boundingRect, QBrush(layer->getColor(selected), Qt::Dense5Pattern));
         }
 #ifdef QT_DEBUG
         layer = getLayer(GraphicsLayer::sDebugGraphicsItemsTextsBoundingRects); Q_ASSERT(layer);
@@ -230,10 +230,9 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
             // draw text bounding rect
             painter->setPen(QPen(layer->getColor(selected), 0));
             painter->setBrush(Qt::NoBrush);
-            painter->drawRect(props.textRect);
+            painter->drawRect(props.boundingRect);
         }
 #endif
-        painter->restore();
     }
 
     // draw origin cross
@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "sgi_base.h"
+#include <librepcb/common/attributes/attributesubstitutor.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -67,7 +68,7 @@ class SGI_Symbol final : public SGI_Base
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept {return mBoundingRect;}
-        QPainterPath shape() const noexcept {return mShape;}
+        QPainterPath shape() const noexcept;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0);
 
 
@@ -85,12 +86,9 @@ class SGI_Symbol final : public SGI_Base
         // Types
 
         struct CachedTextProperties_t {
-            QString text;
-            int fontPixelSize;
-            qreal scaleFactor;
-            bool rotate180;
-            int flags;
-            QRectF textRect;    // not scaled
+            QPainterPath path;      // stroke font paths
+            qreal strokeWidth;
+            QRectF boundingRect;    // including the stroke width
         };
 
 
@@ -101,8 +99,11 @@ class SGI_Symbol final : public SGI_Base
 
         // Cached Attributes
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        QVector<QPainterPath> mGrabAreas; ///< united to the shape on demand
+        mutable QPainterPath mShape;
+        mutable bool mShapeOutdated;
         QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
+        QHash<const Text*, AttributeSubstitutionTemplate> mTextTemplates; ///< parsed once
 };
 
 /*****************************************************************************************
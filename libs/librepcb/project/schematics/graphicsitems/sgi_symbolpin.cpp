@@ -50,7 +50,6 @@ SGI_SymbolPin::SGI_SymbolPin(SI_SymbolPin& pin) noexcept :
     SGI_Base(), mPin(pin), mLibPin(pin.getLibPin())
 {
     setZValue(Schematic::ZValue_Symbols);
-    setToolTip(mLibPin.getName());
 
     mStaticText.setTextFormat(Qt::PlainText);
     mStaticText.setPerformanceHint(QStaticText::AggressiveCaching);
@@ -203,6 +202,15 @@ void SGI_SymbolPin::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
 #endif
 }
 
+/*****************************************************************************************
+ *  Inherited from SGI_Base
+ ****************************************************************************************/
+
+QString SGI_SymbolPin::getToolTipText() const noexcept
+{
+    return mLibPin.getName();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
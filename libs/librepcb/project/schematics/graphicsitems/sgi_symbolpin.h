@@ -76,6 +76,9 @@ class SGI_SymbolPin final : public SGI_Base
         SGI_SymbolPin(const SGI_SymbolPin& other) = delete;
         SGI_SymbolPin& operator=(const SGI_SymbolPin& rhs) = delete;
 
+        // Inherited from SGI_Base
+        QString getToolTipText() const noexcept override;
+
         // Private Methods
         GraphicsLayer* getLayer(const QString& name) const noexcept;
 
@@ -75,24 +75,31 @@ void SI_Base::setSelected(bool selected) noexcept
  *  General Methods
  ****************************************************************************************/
 
-void SI_Base::addToSchematic(SGI_Base* item) noexcept
+void SI_Base::addToSchematic(bool hasGraphicsItem) noexcept
 {
     Q_ASSERT(!mIsAddedToSchematic);
-    if (item) {
-        mSchematic.getGraphicsScene().addItem(*item);
+    if (hasGraphicsItem) {
+        mSchematic.addGraphicsItem(*this); // creates the item if the scene is built
     }
     mIsAddedToSchematic = true;
 }
 
-void SI_Base::removeFromSchematic(SGI_Base* item) noexcept
+void SI_Base::removeFromSchematic(bool hasGraphicsItem) noexcept
 {
     Q_ASSERT(mIsAddedToSchematic);
-    if (item) {
-        mSchematic.getGraphicsScene().removeItem(*item);
+    if (hasGraphicsItem) {
+        mSchematic.removeGraphicsItem(*this); // destroys the item
     }
     mIsAddedToSchematic = false;
 }
 
+void SI_Base::buildGraphicsItemForHitTesting() const noexcept
+{
+    if (mIsAddedToSchematic) {
+        mSchematic.getGraphicsScene(); // creates the graphics items of all added items
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -87,6 +87,22 @@ class SI_Base : public QObject
         virtual void addToSchematic() = 0;
         virtual void removeFromSchematic() = 0;
 
+        /**
+         * @brief Create the graphics item of this schematic item
+         *
+         * This is called by the schematic when its graphics scene is built (or when this
+         * item is added to an already built scene). The graphics item is owned by this
+         * object until #destroyGraphicsItem() is called.
+         *
+         * @return The new graphics item (nullptr if this item has none)
+         */
+        virtual SGI_Base* createGraphicsItem() noexcept {return nullptr;}
+
+        /**
+         * @brief Destroy the graphics item created by #createGraphicsItem()
+         */
+        virtual void destroyGraphicsItem() noexcept {}
+
         // Operator Overloadings
         SI_Base& operator=(const SI_Base& rhs) = delete;
 
@@ -94,8 +110,17 @@ class SI_Base : public QObject
     protected:
 
         // General Methods
-        void addToSchematic(SGI_Base* item) noexcept;
-        void removeFromSchematic(SGI_Base* item) noexcept;
+        void addToSchematic(bool hasGraphicsItem) noexcept;
+        void removeFromSchematic(bool hasGraphicsItem) noexcept;
+
+        /**
+         * @brief Make sure the graphics item exists if this item is added to a schematic
+         *
+         * The grab area is determined by the graphics item, which is only created
+         * together with the graphics scene. So hit testing on a schematic which is not
+         * shown builds its scene.
+         */
+        void buildGraphicsItemForHitTesting() const noexcept;
 
 
     protected:
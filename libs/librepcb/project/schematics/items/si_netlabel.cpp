@@ -61,11 +61,6 @@ SI_NetLabel::SI_NetLabel(SI_NetSegment& segment, const Point& position) :
 
 void SI_NetLabel::init()
 {
-    // create the graphics item
-    mGraphicsItem.reset(new SGI_NetLabel(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
 }
 
@@ -91,7 +86,9 @@ void SI_NetLabel::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) {
+            mGraphicsItem->setPos(mPosition.toPxQPointF());
+        }
         updateAnchor();
     }
 }
@@ -100,8 +97,10 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
 {
     if (rotation != mRotation) {
         mRotation = rotation;
-        mGraphicsItem->setRotation(-mRotation.toDeg());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setRotation(-mRotation.toDeg());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
         updateAnchor();
     }
 }
@@ -112,7 +111,9 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
 
 void SI_NetLabel::updateAnchor() noexcept
 {
-    mGraphicsItem->setAnchor(mNetSegment.calcNearestPoint(mPosition));
+    if (mGraphicsItem) {
+        mGraphicsItem->setAnchor(mNetSegment.calcNearestPoint(mPosition));
+    }
 }
 
 void SI_NetLabel::addToSchematic()
@@ -122,10 +123,10 @@ void SI_NetLabel::addToSchematic()
     }
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    SI_Base::addToSchematic(mGraphicsItem.data());
-    mGraphicsItem->updateCacheAndRepaint();
-    updateAnchor();
+                                          [this](){
+                                              if (mGraphicsItem) mGraphicsItem->update();
+                                          });
+    SI_Base::addToSchematic(true);
 }
 
 void SI_NetLabel::removeFromSchematic()
@@ -134,7 +135,7 @@ void SI_NetLabel::removeFromSchematic()
         throw LogicError(__FILE__, __LINE__);
     }
     disconnect(mHighlightChangedConnection);
-    SI_Base::removeFromSchematic(mGraphicsItem.data());
+    SI_Base::removeFromSchematic(true);
 }
 
 void SI_NetLabel::serialize(SExpression& root) const
@@ -152,13 +153,32 @@ void SI_NetLabel::serialize(SExpression& root) const
 
 QPainterPath SI_NetLabel::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_NetLabel::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+SGI_Base* SI_NetLabel::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new SGI_NetLabel(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    mGraphicsItem->setRotation(-mRotation.toDeg());
+    updateAnchor();
+    return mGraphicsItem.data();
+}
+
+void SI_NetLabel::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -82,6 +82,8 @@ class SI_NetLabel final : public SI_Base, public SerializableObject
         const Point& getPosition() const noexcept override {return mPosition;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        SGI_Base* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         SI_NetLabel& operator=(const SI_NetLabel& rhs) = delete;
@@ -94,7 +96,7 @@ class SI_NetLabel final : public SI_Base, public SerializableObject
 
 
         // General
-        QScopedPointer<SGI_NetLabel> mGraphicsItem;
+        QScopedPointer<SGI_NetLabel> mGraphicsItem; ///< only exists while the scene is built
         QMetaObject::Connection mHighlightChangedConnection;
 
         // Attributes
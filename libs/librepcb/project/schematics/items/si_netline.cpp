@@ -95,7 +95,6 @@ void SI_NetLine::init()
             tr("SI_NetLine: both endpoints are the same."));
     }
 
-    mGraphicsItem.reset(new SGI_NetLine(*this));
     updateLine();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -147,7 +146,9 @@ void SI_NetLine::setWidth(const Length& width) noexcept
     Q_ASSERT(width >= 0);
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->updateCacheAndRepaint();
+        }
     }
 }
 
@@ -167,8 +168,10 @@ void SI_NetLine::addToSchematic()
 
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    SI_Base::addToSchematic(mGraphicsItem.data());
+                                          [this](){
+                                              if (mGraphicsItem) mGraphicsItem->update();
+                                          });
+    SI_Base::addToSchematic(true);
     sg.dismiss();
 }
 
@@ -183,14 +186,16 @@ void SI_NetLine::removeFromSchematic()
     mStartPoint->unregisterNetLine(*this); // can throw
 
     disconnect(mHighlightChangedConnection);
-    SI_Base::removeFromSchematic(mGraphicsItem.data());
+    SI_Base::removeFromSchematic(true);
     sg.dismiss();
 }
 
 void SI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void SI_NetLine::serialize(SExpression& root) const
@@ -209,13 +214,29 @@ void SI_NetLine::serialize(SExpression& root) const
 
 QPainterPath SI_NetLine::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape();
 }
 
 void SI_NetLine::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+SGI_Base* SI_NetLine::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new SGI_NetLine(*this));
+    return mGraphicsItem.data();
+}
+
+void SI_NetLine::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -86,6 +86,8 @@ class SI_NetLine final : public SI_Base, public SerializableObject
         const Point& getPosition() const noexcept override {return mPosition;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        SGI_Base* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         SI_NetLine& operator=(const SI_NetLine& rhs) = delete;
@@ -98,7 +100,7 @@ class SI_NetLine final : public SI_Base, public SerializableObject
 
 
         // General
-        QScopedPointer<SGI_NetLine> mGraphicsItem;
+        QScopedPointer<SGI_NetLine> mGraphicsItem; ///< only exists while the scene is built
         Point mPosition; ///< the center of startpoint and endpoint
         QMetaObject::Connection mHighlightChangedConnection;
 
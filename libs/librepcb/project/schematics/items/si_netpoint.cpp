@@ -32,6 +32,7 @@
 #include "../../circuit/netsignal.h"
 #include "../../circuit/componentsignalinstance.h"
 #include "../../erc/ercmsg.h"
+#include "../../erc/ercmsglist.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/scopeguardlist.h>
 
@@ -94,10 +95,6 @@ SI_NetPoint::SI_NetPoint(SI_NetSegment& segment, SI_SymbolPin& pin) :
 
 void SI_NetPoint::init()
 {
-    // create the graphics item
-    mGraphicsItem.reset(new SGI_NetPoint(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-
     // create ERC messages
     mErcMsgDeadNetPoint.reset(new ErcMsg(mSchematic.getProject(), *this,
         mUuid.toStr(), "Dead", ErcMsg::ErcMsgType_t::SchematicError,
@@ -109,6 +106,7 @@ void SI_NetPoint::init()
 
 SI_NetPoint::~SI_NetPoint() noexcept
 {
+    getProject().getErcMsgList().unscheduleUpdate(*this);
     mGraphicsItem.reset();
 }
 
@@ -168,14 +166,18 @@ void SI_NetPoint::setPinToAttach(SI_SymbolPin* pin)
         sgl.dismiss();
     }
     mSymbolPin = pin;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 void SI_NetPoint::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) {
+            mGraphicsItem->setPos(mPosition.toPxQPointF());
+        }
         updateLines();
     }
 }
@@ -200,9 +202,11 @@ void SI_NetPoint::addToSchematic()
 
     mHighlightChangedConnection = connect(&getNetSignalOfNetSegment(),
                                           &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    mErcMsgDeadNetPoint->setVisible(true);
-    SI_Base::addToSchematic(mGraphicsItem.data());
+                                          [this](){
+                                              if (mGraphicsItem) mGraphicsItem->update();
+                                          });
+    scheduleErcMessagesUpdate();
+    SI_Base::addToSchematic(true);
 }
 
 void SI_NetPoint::removeFromSchematic()
@@ -220,8 +224,8 @@ void SI_NetPoint::removeFromSchematic()
     }
 
     disconnect(mHighlightChangedConnection);
-    mErcMsgDeadNetPoint->setVisible(false);
-    SI_Base::removeFromSchematic(mGraphicsItem.data());
+    scheduleErcMessagesUpdate();
+    SI_Base::removeFromSchematic(true);
 }
 
 void SI_NetPoint::registerNetLine(SI_NetLine& netline)
@@ -233,8 +237,10 @@ void SI_NetPoint::registerNetLine(SI_NetLine& netline)
     }
     mRegisteredLines.append(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
+    scheduleErcMessagesUpdate();
 }
 
 void SI_NetPoint::unregisterNetLine(SI_NetLine& netline)
@@ -244,8 +250,10 @@ void SI_NetPoint::unregisterNetLine(SI_NetLine& netline)
     }
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
-    mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
+    scheduleErcMessagesUpdate();
 }
 
 void SI_NetPoint::updateLines() const noexcept
@@ -274,13 +282,30 @@ void SI_NetPoint::serialize(SExpression& root) const
 
 QPainterPath SI_NetPoint::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 void SI_NetPoint::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
+}
+
+SGI_Base* SI_NetPoint::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new SGI_NetPoint(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    return mGraphicsItem.data();
+}
+
+void SI_NetPoint::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
 }
 
 /*****************************************************************************************
@@ -294,6 +319,16 @@ bool SI_NetPoint::checkAttributesValidity() const noexcept
     return true;
 }
 
+void SI_NetPoint::updateErcMessages() noexcept
+{
+    mErcMsgDeadNetPoint->setVisible(isAddedToSchematic() && mRegisteredLines.isEmpty());
+}
+
+void SI_NetPoint::scheduleErcMessagesUpdate() noexcept
+{
+    getProject().getErcMsgList().scheduleUpdate(*this);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
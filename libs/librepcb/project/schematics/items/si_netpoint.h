@@ -98,6 +98,8 @@ class SI_NetPoint final : public SI_Base, public SerializableObject,
         const Point& getPosition() const noexcept override {return mPosition;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        SGI_Base* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         SI_NetPoint& operator=(const SI_NetPoint& rhs) = delete;
@@ -109,10 +111,12 @@ class SI_NetPoint final : public SI_Base, public SerializableObject,
 
         void init();
         bool checkAttributesValidity() const noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
 
 
         // General
-        QScopedPointer<SGI_NetPoint> mGraphicsItem;
+        QScopedPointer<SGI_NetPoint> mGraphicsItem; ///< only exists while the scene is built
         QMetaObject::Connection mHighlightChangedConnection;
 
         // Attributes
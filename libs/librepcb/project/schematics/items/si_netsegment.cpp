@@ -427,7 +427,7 @@ void SI_NetSegment::addToSchematic()
         sgl.add([netlabel](){netlabel->removeFromSchematic();});
     }
 
-    SI_Base::addToSchematic(nullptr);
+    SI_Base::addToSchematic(false);
     sgl.dismiss();
 }
 
@@ -453,20 +453,10 @@ void SI_NetSegment::removeFromSchematic()
     mNetSignal->unregisterSchematicNetSegment(*this); // can throw
     sgl.add([&](){mNetSignal->registerSchematicNetSegment(*this);});
 
-    SI_Base::removeFromSchematic(nullptr);
+    SI_Base::removeFromSchematic(false);
     sgl.dismiss();
 }
 
-void SI_NetSegment::setSelectionRect(const QRectF rectPx) noexcept
-{
-    foreach (SI_NetPoint* netpoint, mNetPoints)
-        netpoint->setSelected(netpoint->getGrabAreaScenePx().intersects(rectPx));
-    foreach (SI_NetLine* netline, mNetLines)
-        netline->setSelected(netline->getGrabAreaScenePx().intersects(rectPx));
-    foreach (SI_NetLabel* netlabel, mNetLabels)
-        netlabel->setSelected(netlabel->getGrabAreaScenePx().intersects(rectPx));
-}
-
 void SI_NetSegment::clearSelection() const noexcept
 {
     foreach (SI_NetPoint* netpoint, mNetPoints)
@@ -99,7 +99,6 @@ class SI_NetSegment final : public SI_Base, public SerializableObject
         // General Methods
         void addToSchematic() override;
         void removeFromSchematic() override;
-        void setSelectionRect(const QRectF rectPx) noexcept;
         void clearSelection() const noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
@@ -84,10 +84,6 @@ void SI_Symbol::init(const Uuid& symbVarItemUuid)
             .arg(mSymbVarItem->getSymbolUuid().toStr()));
     }
 
-    mGraphicsItem.reset(new SGI_Symbol(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-
     for (const library::SymbolPin& libPin : mSymbol->getPins()) {
         SI_SymbolPin* pin = new SI_SymbolPin(*this, libPin.getUuid()); // can throw
         if (mPins.contains(libPin.getUuid())) {
@@ -133,8 +129,10 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept
 {
     if (newPos != mPosition) {
         mPosition = newPos;
-        mGraphicsItem->setPos(newPos.toPxQPointF());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setPos(newPos.toPxQPointF());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -145,8 +143,10 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept
 {
     if (newRotation != mRotation) {
         mRotation = newRotation;
-        mGraphicsItem->setRotation(-newRotation.toDeg());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setRotation(-newRotation.toDeg());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -169,7 +169,7 @@ void SI_Symbol::addToSchematic()
         pin->addToSchematic(); // can throw
         sgl.add([pin](){pin->removeFromSchematic();});
     }
-    SI_Base::addToSchematic(mGraphicsItem.data());
+    SI_Base::addToSchematic(true);
     sgl.dismiss();
 }
 
@@ -185,7 +185,7 @@ void SI_Symbol::removeFromSchematic()
     }
     mComponentInstance->unregisterSymbol(*this); // can throw
     sgl.add([&](){mComponentInstance->registerSymbol(*this);});
-    SI_Base::removeFromSchematic(mGraphicsItem.data());
+    SI_Base::removeFromSchematic(true);
     sgl.dismiss();
 }
 
@@ -233,25 +233,45 @@ QVector<const AttributeProvider*> SI_Symbol::getAttributeProviderParents() const
 
 QPainterPath SI_Symbol::getGrabAreaScenePx() const noexcept
 {
+    buildGraphicsItemForHitTesting();
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_Symbol::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) {
+        mGraphicsItem->update();
+    }
     foreach (SI_SymbolPin* pin, mPins) {
         pin->setSelected(selected);
     }
 }
 
+SGI_Base* SI_Symbol::createGraphicsItem() noexcept
+{
+    Q_ASSERT(!mGraphicsItem);
+    mGraphicsItem.reset(new SGI_Symbol(*this));
+    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    mGraphicsItem->setRotation(-mRotation.toDeg());
+    return mGraphicsItem.data();
+}
+
+void SI_Symbol::destroyGraphicsItem() noexcept
+{
+    mGraphicsItem.reset();
+}
+
 /*****************************************************************************************
  *  Private Slots
  ****************************************************************************************/
 
 void SI_Symbol::schematicOrComponentAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
 }
 
 /*****************************************************************************************
@@ -107,6 +107,8 @@ class SI_Symbol final : public SI_Base, public SerializableObject,
         const Point& getPosition() const noexcept override {return mPosition;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        SGI_Base* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         SI_Symbol& operator=(const SI_Symbol& rhs) = delete;
@@ -134,7 +136,7 @@ class SI_Symbol final : public SI_Base, public SerializableObject,
         const library::ComponentSymbolVariantItem* mSymbVarItem;
         const library::Symbol* mSymbol;
         QHash<Uuid, SI_SymbolPin*> mPins; ///< key: symbol pin UUID
-        QScopedPointer<SGI_Symbol> mGraphicsItem;
+        QScopedPointer<SGI_Symbol> mGraphicsItem; ///< only exists while the scene is built
 
         // Attributes
         Uuid mUuid;
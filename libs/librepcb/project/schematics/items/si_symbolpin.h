@@ -92,6 +92,8 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
         const Point& getPosition() const noexcept override {return mPosition;}
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
+        SGI_Base* createGraphicsItem() noexcept override;
+        void destroyGraphicsItem() noexcept override;
 
         // Operator Overloadings
         SI_SymbolPin& operator=(const SI_SymbolPin& rhs) = delete;
@@ -99,7 +101,8 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
 
     private slots:
 
-        void updateErcMessages() noexcept;
+        void updateErcMessages() noexcept override;
+        void scheduleErcMessagesUpdate() noexcept;
 
 
     private:
@@ -115,7 +118,7 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
         Point mPosition;
         Angle mRotation;
         SI_NetPoint* mRegisteredNetPoint;
-        QScopedPointer<SGI_SymbolPin> mGraphicsItem;
+        QScopedPointer<SGI_SymbolPin> mGraphicsItem; ///< only exists while the scene is built
 
         /// @brief The ERC message for unconnected required pins
         QScopedPointer<ErcMsg> mErcMsgUnconnectedRequiredPin;
@@ -33,6 +33,7 @@
 #include "items/si_netpoint.h"
 #include "items/si_netline.h"
 #include "items/si_netlabel.h"
+#include "graphicsitems/sgi_base.h"
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
@@ -52,12 +53,10 @@ namespace project {
 Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
                      bool readOnly, bool create, const QString& newName):
     QObject(&project), AttributeProvider(), mProject(project), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mSelectionRectActive(false)
 {
     try
     {
-        mGraphicsScene.reset(new GraphicsScene());
-
         // try to open/create the schematic file
         if (create)
         {
@@ -145,6 +144,20 @@ Schematic::~Schematic() noexcept
  *  Getters: General
  ****************************************************************************************/
 
+GraphicsScene& Schematic::getGraphicsScene() const noexcept
+{
+    // The scene and all its graphics items are only built when they are needed (e.g.
+    // when shown in a view the first time) to avoid wasting memory for pages which are
+    // never looked at.
+    if (!mGraphicsScene) {
+        mGraphicsScene.reset(new GraphicsScene());
+        foreach (SI_Base* owner, mSceneItems.keys()) {
+            createGraphicsItem(*owner);
+        }
+    }
+    return *mGraphicsScene;
+}
+
 bool Schematic::isEmpty() const noexcept
 {
     return (mSymbols.isEmpty() && mNetSegments.isEmpty());
@@ -239,6 +252,18 @@ void Schematic::setGridProperties(const GridProperties& grid) noexcept
     *mGridProperties = grid;
 }
 
+/*****************************************************************************************
+ *  Getters: Attributes
+ ****************************************************************************************/
+
+const QIcon& Schematic::getIcon() noexcept
+{
+    if (mIcon.isNull()) {
+        updateIcon();
+    }
+    return mIcon;
+}
+
 /*****************************************************************************************
  *  Symbol Methods
  ****************************************************************************************/
@@ -342,7 +367,7 @@ void Schematic::addToProject()
     }
 
     mIsAddedToProject = true;
-    updateIcon();
+    mIcon = QIcon(); // will be rendered on demand
     sgl.dismiss();
 }
 
@@ -394,27 +419,90 @@ bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
 
 void Schematic::showInView(GraphicsView& view) noexcept
 {
-    view.setScene(mGraphicsScene.data());
+    view.setScene(&getGraphicsScene()); // builds the scene on first use
+    mIcon = QIcon(); // the page may be modified while it is shown
+}
+
+void Schematic::releaseGraphicsScene() noexcept
+{
+    if (mGraphicsScene) {
+        updateIcon(); // keep the last state of the scene for the icon
+        for (auto it = mSceneItems.begin(); it != mSceneItems.end(); ++it) {
+            if (it.value()) {
+                mGraphicsScene->removeItem(*it.value());
+                it.key()->destroyGraphicsItem();
+                it.value() = nullptr;
+            }
+        }
+        mGraphicsItemOwners.clear();
+        mItemsInSelectionRect.clear();
+        mSelectionRectActive = false;
+        mGraphicsScene.reset();
+    }
+}
+
+void Schematic::addGraphicsItem(SI_Base& owner) noexcept
+{
+    Q_ASSERT(!mSceneItems.contains(&owner));
+    mSceneItems.insert(&owner, nullptr);
+    if (mGraphicsScene) {
+        createGraphicsItem(owner);
+    }
+}
+
+void Schematic::removeGraphicsItem(SI_Base& owner) noexcept
+{
+    Q_ASSERT(mSceneItems.contains(&owner));
+    mItemsInSelectionRect.remove(&owner);
+    if (QGraphicsItem* item = mSceneItems.take(&owner)) {
+        mGraphicsItemOwners.remove(item);
+        mGraphicsScene->removeItem(*item);
+        owner.destroyGraphicsItem();
+    }
 }
 
 void Schematic::setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept
 {
-    mGraphicsScene->setSelectionRect(p1, p2);
-    if (updateItems)
+    getGraphicsScene().setSelectionRect(p1, p2);
+    if (!updateItems) {
+        // the selection rect is released, keep the selection state of all items
+        mItemsInSelectionRect.clear();
+        mSelectionRectActive = false;
+        return;
+    }
+    if (!mSelectionRectActive) {
+        // a new selection rect replaces the previous selection
+        clearSelection();
+        mSelectionRectActive = true;
+    }
+
+    // Query candidates from the spatial index of the graphics scene instead of testing
+    // every item of the schematic, since this is called on every mouse move.
+    QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+    QSet<SI_Base*> items;
+    foreach (QGraphicsItem* graphicsItem,
+             mGraphicsScene->items(rectPx, Qt::IntersectsItemBoundingRect))
     {
-        QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
-        foreach (SI_Symbol* symbol, mSymbols) {
-            bool selectSymbol = symbol->getGrabAreaScenePx().intersects(rectPx);
-            symbol->setSelected(selectSymbol);
-            foreach (SI_SymbolPin* pin, symbol->getPins()) {
-                bool selectPin = pin->getGrabAreaScenePx().intersects(rectPx);
-                pin->setSelected(selectSymbol || selectPin);
+        SI_Base* item = mGraphicsItemOwners.value(graphicsItem, nullptr);
+        if ((!item) || (!item->getGrabAreaScenePx().intersects(rectPx))) continue;
+        items.insert(item);
+        if (item->getType() == SI_Base::Type_t::Symbol) {
+            // pins are always selected together with their symbol
+            foreach (SI_SymbolPin* pin, static_cast<SI_Symbol*>(item)->getPins()) {
+                items.insert(pin);
             }
         }
-        foreach (SI_NetSegment* segment, mNetSegments) {
-            segment->setSelectionRect(rectPx);
-        }
     }
+
+    // only touch items whose selection state has changed to avoid needless repaints
+    foreach (SI_Base* item, mItemsInSelectionRect) {
+        if (!items.contains(item)) item->setSelected(false);
+    }
+    foreach (SI_Base* item, items) {
+        // note: deselecting a symbol above has also deselected its pins
+        if (!item->isSelected()) item->setSelected(true);
+    }
+    mItemsInSelectionRect = items;
 }
 
 void Schematic::clearSelection() const noexcept
@@ -436,7 +524,8 @@ void Schematic::updateAllNetLabelAnchors() noexcept
 
 void Schematic::renderToQPainter(QPainter& painter) const noexcept
 {
-    mGraphicsScene->render(&painter, QRectF(), mGraphicsScene->itemsBoundingRect(), Qt::KeepAspectRatio);
+    GraphicsScene& scene = getGraphicsScene(); // builds the scene if not done yet
+    scene.render(&painter, QRectF(), scene.itemsBoundingRect(), Qt::KeepAspectRatio);
 }
 
 std::unique_ptr<SchematicSelectionQuery> Schematic::createSelectionQuery() const noexcept
@@ -471,16 +560,27 @@ QVector<const AttributeProvider*> Schematic::getAttributeProviderParents() const
 
 void Schematic::updateIcon() noexcept
 {
-    QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
     QRect target(0, 0, 297, 210); // DIN A4 format :-)
 
     QPixmap pixmap(target.size());
     pixmap.fill(Qt::white);
-    QPainter painter(&pixmap);
-    mGraphicsScene->render(&painter, target, source);
+    if (mGraphicsScene) { // don't build the scene just for the icon
+        QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
+        QPainter painter(&pixmap);
+        mGraphicsScene->render(&painter, target, source);
+    }
     mIcon = QIcon(pixmap);
 }
 
+void Schematic::createGraphicsItem(SI_Base& owner) const noexcept
+{
+    if (SGI_Base* item = owner.createGraphicsItem()) {
+        mSceneItems.insert(&owner, item);
+        mGraphicsItemOwners.insert(item, &owner);
+        mGraphicsScene->addItem(*item);
+    }
+}
+
 bool Schematic::checkAttributesValidity() const noexcept
 {
     if (mUuid.isNull())     return false;
@@ -115,7 +115,8 @@ class Schematic final : public QObject, public AttributeProvider,
         Project& getProject() const noexcept {return mProject;}
         const FilePath& getFilePath() const noexcept {return mFilePath;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
-        GraphicsScene& getGraphicsScene () const noexcept {return *mGraphicsScene;}
+        GraphicsScene& getGraphicsScene() const noexcept;
+        bool isGraphicsSceneBuilt() const noexcept {return !mGraphicsScene.isNull();}
         bool isEmpty() const noexcept;
         QList<SI_Base*> getItemsAtScenePos(const Point& pos) const noexcept;
         QList<SI_NetPoint*> getNetPointsAtScenePos(const Point& pos) const noexcept;
@@ -129,7 +130,14 @@ class Schematic final : public QObject, public AttributeProvider,
         // Getters: Attributes
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getName() const noexcept {return mName;}
-        const QIcon& getIcon() const noexcept {return mIcon;}
+
+        /**
+         * @brief Get a preview image of the page
+         *
+         * The icon is rendered from the graphics scene, but the scene is never built
+         * only for the icon. So as long as the page was not shown, the icon is empty.
+         */
+        const QIcon& getIcon() noexcept;
 
         // Symbol Methods
         SI_Symbol* getSymbolByUuid(const Uuid& uuid) const noexcept;
@@ -146,6 +154,9 @@ class Schematic final : public QObject, public AttributeProvider,
         void removeFromProject();
         bool save(bool toOriginal, QStringList& errors) noexcept;
         void showInView(GraphicsView& view) noexcept;
+        void releaseGraphicsScene() noexcept;
+        void addGraphicsItem(SI_Base& owner) noexcept;
+        void removeGraphicsItem(SI_Base& owner) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
         void setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept;
@@ -181,6 +192,7 @@ class Schematic final : public QObject, public AttributeProvider,
         Schematic(Project& project, const FilePath& filepath, bool restore,
                   bool readOnly, bool create, const QString& newName);
         void updateIcon() noexcept;
+        void createGraphicsItem(SI_Base& owner) const noexcept;
         bool checkAttributesValidity() const noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
@@ -193,14 +205,20 @@ class Schematic final : public QObject, public AttributeProvider,
         QScopedPointer<SmartSExprFile> mFile;
         bool mIsAddedToProject;
 
-        QScopedPointer<GraphicsScene> mGraphicsScene;
+        mutable QScopedPointer<GraphicsScene> mGraphicsScene; ///< built on demand
+        /// all items which belong to the scene, with their graphics item (if built)
+        mutable QHash<SI_Base*, QGraphicsItem*> mSceneItems;
+        /// the owners of all graphics items of the built scene
+        mutable QHash<QGraphicsItem*, SI_Base*> mGraphicsItemOwners;
+        QSet<SI_Base*> mItemsInSelectionRect; ///< items selected by the selection rect
+        bool mSelectionRectActive; ///< whether the selection rect is currently dragged
         QScopedPointer<GridProperties> mGridProperties;
         QRectF mViewRect;
 
         // Attributes
         Uuid mUuid;
         QString mName;
-        QIcon mIcon;
+        QIcon mIcon; ///< rendered from the scene (if built) by #getIcon()
 
         QList<SI_Symbol*> mSymbols;
         QList<SI_NetSegment*> mNetSegments;
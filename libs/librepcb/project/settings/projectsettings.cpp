@@ -100,6 +100,8 @@ void ProjectSettings::restoreDefaults() noexcept
 
 void ProjectSettings::triggerSettingsChanged() noexcept
 {
+    // the locale order is used to resolve some attributes (e.g. "#COMPONENT")
+    AttributeProvider::invalidateAttributeValues();
     emit settingsChanged();
 }
 
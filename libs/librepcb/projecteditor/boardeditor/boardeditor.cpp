@@ -245,6 +245,7 @@ bool BoardEditor::setActiveBoardIndex(int index) noexcept
         board->showInView(*mGraphicsView);
         mGraphicsView->setVisibleSceneRect(board->restoreViewSceneRect());
         mGraphicsView->setGridProperties(board->getGridProperties());
+        releaseUnusedGraphicsScenes(board->getUuid());
         // check QAction
         QAction* action = mBoardListActions.value(index); Q_ASSERT(action);
         if (action) action->setChecked(true);
@@ -525,6 +526,22 @@ void BoardEditor::toolActionGroupChangeTriggered(const QVariant& newTool) noexce
     }
 }
 
+void BoardEditor::releaseUnusedGraphicsScenes(const Uuid& shownBoard) noexcept
+{
+    // Graphics scenes are built when a board is shown the first time. To limit the memory
+    // usage of projects with many boards, release the scenes of the boards which were
+    // not shown recently (they will be rebuilt when they are shown again).
+    static const int keepCount = 3;
+    mRecentlyShownBoards.removeOne(shownBoard);
+    mRecentlyShownBoards.prepend(shownBoard);
+    while (mRecentlyShownBoards.count() > keepCount) {
+        Board* board = mProject.getBoardByUuid(mRecentlyShownBoards.takeLast());
+        if (board) {
+            board->releaseGraphicsScene();
+        }
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
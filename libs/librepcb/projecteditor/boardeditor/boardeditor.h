@@ -130,6 +130,7 @@ class BoardEditor final : public QMainWindow, public IF_GraphicsViewEventHandler
         // Private Methods
         bool graphicsViewEventHandler(QEvent* event);
         void toolActionGroupChangeTriggered(const QVariant& newTool) noexcept;
+        void releaseUnusedGraphicsScenes(const Uuid& shownBoard) noexcept;
 
         // General Attributes
         ProjectEditor& mProjectEditor;
@@ -141,6 +142,7 @@ class BoardEditor final : public QMainWindow, public IF_GraphicsViewEventHandler
 
         // Misc
         int mActiveBoardIndex;
+        QList<Uuid> mRecentlyShownBoards; ///< most recently shown first
         QList<QAction*> mBoardListActions;
         QActionGroup mBoardListActionGroup;
 
@@ -38,6 +38,7 @@
 #include <librepcb/project/boards/cmd/cmdboardviaedit.h>
 #include <librepcb/project/boards/cmd/cmdboardnetpointedit.h>
 #include <librepcb/project/boards/boardselectionquery.h>
+#include <librepcb/project/boards/graphicsitems/bgi_base.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -65,6 +66,9 @@ CmdFlipSelectedBoardItems::~CmdFlipSelectedBoardItems() noexcept
 
 bool CmdFlipSelectedBoardItems::performExecute()
 {
+    // update graphics items only once after all elements were flipped
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+
     // if an error occurs, undo all already executed child commands
     auto undoScopeGuard = scopeGuard([&](){performUndo();});
 
@@ -170,6 +174,18 @@ bool CmdFlipSelectedBoardItems::performExecute()
     return (getChildCount() > 0);
 }
 
+void CmdFlipSelectedBoardItems::performUndo()
+{
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+    UndoCommandGroup::performUndo(); // can throw
+}
+
+void CmdFlipSelectedBoardItems::performRedo()
+{
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+    UndoCommandGroup::performRedo(); // can throw
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -60,6 +60,12 @@ class CmdFlipSelectedBoardItems final : public UndoCommandGroup
 
         /// @copydoc UndoCommand::performExecute()
         bool performExecute() override;
+
+        /// @copydoc UndoCommand::performUndo()
+        void performUndo() override;
+
+        /// @copydoc UndoCommand::performRedo()
+        void performRedo() override;
         void flipDevice(BI_Device& device, const Point& center);
 
 
@@ -36,6 +36,7 @@
 #include <librepcb/project/boards/cmd/cmdboardnetpointedit.h>
 #include <librepcb/project/boards/cmd/cmdboardplaneedit.h>
 #include <librepcb/project/boards/boardselectionquery.h>
+#include <librepcb/project/boards/graphicsitems/bgi_base.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -100,6 +101,11 @@ void CmdMoveSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept
     delta.mapToGrid(mBoard.getGridProperties().getInterval());
 
     if (delta != mDeltaPos) {
+        // Moving elements triggers lots of redundant graphics item updates (e.g. netlines
+        // between two moved footprints), so they are collected and updated only once
+        // when the guard goes out of scope.
+        BGI_Base::DeferUpdatesGuard guard(mBoard);
+
         // move selected elements
         foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
             cmd->setDeltaToStartPos(delta, true);
@@ -153,9 +159,22 @@ bool CmdMoveSelectedBoardItems::performExecute()
     }
 
     // execute all child commands
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
     return UndoCommandGroup::performExecute(); // can throw
 }
 
+void CmdMoveSelectedBoardItems::performUndo()
+{
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+    UndoCommandGroup::performUndo(); // can throw
+}
+
+void CmdMoveSelectedBoardItems::performRedo()
+{
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+    UndoCommandGroup::performRedo(); // can throw
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -70,6 +70,12 @@ class CmdMoveSelectedBoardItems final : public UndoCommandGroup
         /// @copydoc UndoCommand::performExecute()
         bool performExecute() override;
 
+        /// @copydoc UndoCommand::performUndo()
+        void performUndo() override;
+
+        /// @copydoc UndoCommand::performRedo()
+        void performRedo() override;
+
 
         // Private Member Variables
         Board& mBoard;
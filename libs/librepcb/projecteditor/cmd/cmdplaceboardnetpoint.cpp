@@ -107,7 +107,7 @@ BI_NetPoint* CmdPlaceBoardNetPoint::createNewNetPoint()
         return createNewNetPointAtPad();
     } else if (viasUnderCursor.count() == 1) {
         BI_Via* via = viasUnderCursor.first();
-        BI_NetPoint* netpoint = via->getNetPointOfLayer(mLayer.getName());
+        BI_NetPoint* netpoint = via->getNetPointOfLayer(mLayer.getId());
         if (netpoint) {
             return netpoint;
         } else {
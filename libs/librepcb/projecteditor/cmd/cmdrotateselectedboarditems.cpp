@@ -38,6 +38,7 @@
 #include <librepcb/project/boards/cmd/cmdboardnetpointedit.h>
 #include <librepcb/project/boards/cmd/cmdboardplaneedit.h>
 #include <librepcb/project/boards/boardselectionquery.h>
+#include <librepcb/project/boards/graphicsitems/bgi_base.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -65,6 +66,9 @@ CmdRotateSelectedBoardItems::~CmdRotateSelectedBoardItems() noexcept
 
 bool CmdRotateSelectedBoardItems::performExecute()
 {
+    // update graphics items only once after all elements were rotated
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+
     // get all selected items
     std::unique_ptr<BoardSelectionQuery> query(mBoard.createSelectionQuery());
     query->addSelectedFootprints();
@@ -142,6 +146,18 @@ bool CmdRotateSelectedBoardItems::performExecute()
     return UndoCommandGroup::performExecute(); // can throw
 }
 
+void CmdRotateSelectedBoardItems::performUndo()
+{
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+    UndoCommandGroup::performUndo(); // can throw
+}
+
+void CmdRotateSelectedBoardItems::performRedo()
+{
+    BGI_Base::DeferUpdatesGuard guard(mBoard);
+    UndoCommandGroup::performRedo(); // can throw
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "projecteditor.h"
 #include <librepcb/common/undostack.h>
+#include <librepcb/common/fileio/backgroundfilewriter.h>
 #include <librepcb/workspace/workspace.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/project/project.h>
@@ -70,6 +71,12 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
         // autosaving is enabled --> start the timer
         connect(&mAutoSaveTimer, &QTimer::timeout, this, &ProjectEditor::autosaveProject);
         mAutoSaveTimer.start(1000 * intervalSecs);
+
+        // autosaved files are written asynchronously, so errors are reported by a signal
+        if (BackgroundFileWriter* writer = BackgroundFileWriter::instance()) {
+            connect(writer, &BackgroundFileWriter::writeFailed,
+                    this, &ProjectEditor::backupFileWriteFailed, Qt::QueuedConnection);
+        }
     }
 }
 
@@ -163,6 +170,14 @@ bool ProjectEditor::saveProject() noexcept
         qDebug() << "Begin saving the project to temporary files...";
         mProject.save(false);
 
+        // wait until the background writer has written all temporary files
+        if (BackgroundFileWriter* writer = BackgroundFileWriter::instance()) {
+            QStringList errors;
+            if (!writer->flush(errors)) {
+                throw RuntimeError(__FILE__, __LINE__, errors.join("\n"));
+            }
+        }
+
         // step 2: save whole project to original files
         qDebug() << "Begin saving the project to original files...";
         mProject.save(true);
@@ -198,6 +213,9 @@ bool ProjectEditor::autosaveProject() noexcept
 
     try
     {
+        // Note: If a background file writer exists, files are written asynchronously
+        // and further autosaves of the same files are coalesced. Write errors are
+        // reported by backupFileWriteFailed().
         qDebug() << "Begin autosaving the project to temporary files...";
         mProject.save(false);
         qDebug() << "Project successfully autosaved";
@@ -205,6 +223,8 @@ bool ProjectEditor::autosaveProject() noexcept
     }
     catch (Exception& exc)
     {
+        qCritical() << "Could not autosave the project:" << exc.getMsg();
+        showAutosaveError(exc.getMsg());
         return false;
     }
 }
@@ -260,6 +280,22 @@ int ProjectEditor::getCountOfVisibleEditorWindows() const noexcept
     return count;
 }
 
+void ProjectEditor::backupFileWriteFailed(const FilePath& filepath,
+                                          const QString& error) noexcept
+{
+    if (filepath.isLocatedInDir(mProject.getPath())) {
+        showAutosaveError(error); // the writer logged the error already
+    }
+}
+
+void ProjectEditor::showAutosaveError(const QString& error) noexcept
+{
+    // the message stays until it gets replaced, so it's not missed easily
+    QString msg = tr("Autosave failed: %1").arg(error);
+    mSchematicEditor->statusBar()->showMessage(msg);
+    mBoardEditor->statusBar()->showMessage(msg);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -207,6 +207,8 @@ class ProjectEditor final : public QObject
     private: // Methods
 
         int getCountOfVisibleEditorWindows() const noexcept;
+        void backupFileWriteFailed(const FilePath& filepath, const QString& error) noexcept;
+        void showAutosaveError(const QString& error) noexcept;
 
 
     private: // Data
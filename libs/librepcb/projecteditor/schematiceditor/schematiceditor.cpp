@@ -223,6 +223,7 @@ bool SchematicEditor::setActiveSchematicIndex(int index) noexcept
         schematic->showInView(*mGraphicsView);
         mGraphicsView->setVisibleSceneRect(schematic->restoreViewSceneRect());
         mGraphicsView->setGridProperties(schematic->getGridProperties());
+        releaseUnusedGraphicsScenes(schematic->getUuid());
     }
     else
     {
@@ -411,6 +412,22 @@ void SchematicEditor::toolActionGroupChangeTriggered(const QVariant& newTool) no
     }
 }
 
+void SchematicEditor::releaseUnusedGraphicsScenes(const Uuid& shownSchematic) noexcept
+{
+    // Graphics scenes are built when a page is shown the first time. To limit the memory
+    // usage of projects with many pages, release the scenes of the pages which were
+    // not shown recently (they will be rebuilt when they are shown again).
+    static const int keepCount = 5;
+    mRecentlyShownSchematics.removeOne(shownSchematic);
+    mRecentlyShownSchematics.prepend(shownSchematic);
+    while (mRecentlyShownSchematics.count() > keepCount) {
+        Schematic* schematic = mProject.getSchematicByUuid(mRecentlyShownSchematics.takeLast());
+        if (schematic) {
+            schematic->releaseGraphicsScene();
+        }
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
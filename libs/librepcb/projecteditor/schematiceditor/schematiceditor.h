@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include <librepcb/common/graphics/if_graphicsvieweventhandler.h>
+#include <librepcb/common/uuid.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -118,6 +119,7 @@ class SchematicEditor final : public QMainWindow, public IF_GraphicsViewEventHan
         // Private Methods
         bool graphicsViewEventHandler(QEvent* event);
         void toolActionGroupChangeTriggered(const QVariant& newTool) noexcept;
+        void releaseUnusedGraphicsScenes(const Uuid& shownSchematic) noexcept;
 
         // General Attributes
         ProjectEditor& mProjectEditor;
@@ -129,6 +131,7 @@ class SchematicEditor final : public QMainWindow, public IF_GraphicsViewEventHan
         QScopedPointer<ExclusiveActionGroup> mToolsActionGroup;
 
         int mActiveSchematicIndex;
+        QList<Uuid> mRecentlyShownSchematics; ///< most recently shown first
 
         // Docks
         SchematicPagesDock* mPagesDock;
@@ -87,7 +87,14 @@ void SchematicPagesDock::resizeEvent(QResizeEvent* event)
 
 void SchematicPagesDock::activeSchematicChanged(int oldIndex, int newIndex)
 {
-    Q_UNUSED(oldIndex);
+    // the icons are only rendered for pages which have been shown
+    foreach (int index, QList<int>{oldIndex, newIndex}) {
+        Schematic* schematic = mProject.getSchematicByIndex(index);
+        QListWidgetItem* item = mUi->listWidget->item(index);
+        if (schematic && item) {
+            item->setIcon(schematic->getIcon());
+        }
+    }
     mUi->listWidget->setCurrentRow(newIndex);
 }
 
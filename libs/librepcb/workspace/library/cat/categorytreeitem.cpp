@@ -40,20 +40,19 @@ using namespace library;
 
 template <typename ElementType>
 CategoryTreeItem<ElementType>::CategoryTreeItem(const WorkspaceLibraryDb& library,
-        const QStringList localeOrder, CategoryTreeItem* parent, const Uuid& uuid) noexcept :
-    mLocaleOrder(localeOrder), mParent(parent), mUuid(uuid),
-    mDepth(parent ? parent->getDepth() + 1 : 0), mExceptionMessage()
+        const QStringList localeOrder, CategoryTreeItem* parent,
+        const WorkspaceLibraryDb::ElementMetadata_t& metadata) noexcept :
+    mLocaleOrder(localeOrder), mParent(parent), mUuid(metadata.uuid), mName(metadata.name),
+    mDescription(metadata.description), mDepth(parent ? parent->getDepth() + 1 : 0),
+    mExceptionMessage()
 {
     try {
-        if (!mUuid.isNull()) {
-            FilePath fp = getLatestCategory(library);
-            if (fp.isValid()) mCategory.reset(new ElementType(fp, true));
-        }
-
         if ((!mUuid.isNull()) || (!mParent)) {
-            QSet<Uuid> childs = getCategoryChilds(library);
-            foreach (const Uuid& childUuid, childs) {
-                ChildType child(new CategoryTreeItem(library, mLocaleOrder, this, childUuid));
+            // names and descriptions of all childs are fetched with a single query, so
+            // there's no need to open the category files
+            QList<WorkspaceLibraryDb::ElementMetadata_t> childs = getCategoryChilds(library);
+            foreach (const WorkspaceLibraryDb::ElementMetadata_t& childMetadata, childs) {
+                ChildType child(new CategoryTreeItem(library, mLocaleOrder, this, childMetadata));
                 mChilds.append(child);
             }
 
@@ -65,7 +64,8 @@ CategoryTreeItem<ElementType>::CategoryTreeItem(const WorkspaceLibraryDb& librar
 
         if (!mParent) {
             // add category for elements without category
-            ChildType child(new CategoryTreeItem(library, mLocaleOrder, this, Uuid()));
+            ChildType child(new CategoryTreeItem(library, mLocaleOrder, this,
+                                                 WorkspaceLibraryDb::ElementMetadata_t()));
             mChilds.append(child);
         }
     } catch (const Exception& e) {
@@ -105,10 +105,8 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept
         case Qt::DisplayRole:
             if (mUuid.isNull())
                 return "(Without Category)";
-            else if (mCategory)
-                return mCategory->getNames().value(mLocaleOrder);
             else
-                return "(ERROR)";
+                return mName;
 
         case Qt::DecorationRole:
             break;
@@ -120,8 +118,8 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept
         case Qt::ToolTipRole:
             if (mUuid.isNull())
                 return "All library elements without a category";
-            else if (mCategory)
-                return mCategory->getDescriptions().value(mLocaleOrder);
+            else if (mExceptionMessage.isEmpty())
+                return mDescription;
             else
                 return mExceptionMessage;
 
@@ -138,28 +136,11 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept
  *  Private Methods
  ****************************************************************************************/
 
-template <>
-FilePath CategoryTreeItem<ComponentCategory>::getLatestCategory(const WorkspaceLibraryDb& lib) const
-{
-    return lib.getLatestComponentCategory(mUuid);
-}
-
-template <>
-FilePath CategoryTreeItem<PackageCategory>::getLatestCategory(const WorkspaceLibraryDb& lib) const
-{
-    return lib.getLatestPackageCategory(mUuid);
-}
-
-template <>
-QSet<Uuid> CategoryTreeItem<ComponentCategory>::getCategoryChilds(const WorkspaceLibraryDb& lib) const
-{
-    return lib.getComponentCategoryChilds(mUuid);
-}
-
-template <>
-QSet<Uuid> CategoryTreeItem<PackageCategory>::getCategoryChilds(const WorkspaceLibraryDb& lib) const
+template <typename ElementType>
+QList<WorkspaceLibraryDb::ElementMetadata_t> CategoryTreeItem<ElementType>::getCategoryChilds(
+    const WorkspaceLibraryDb& lib) const
 {
-    return lib.getPackageCategoryChilds(mUuid);
+    return lib.getCategoryChildsMetadata<ElementType>(mUuid, mLocaleOrder);
 }
 
 /*****************************************************************************************
@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/uuid.h>
+#include "../workspacelibrarydb.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -38,8 +39,6 @@ class PackageCategory;
 
 namespace workspace {
 
-class WorkspaceLibraryDb;
-
 /*****************************************************************************************
  *  Class CategoryTreeItem
  ****************************************************************************************/
@@ -56,7 +55,8 @@ class CategoryTreeItem final
         CategoryTreeItem() = delete;
         CategoryTreeItem(const CategoryTreeItem& other) = delete;
         CategoryTreeItem(const WorkspaceLibraryDb& library, const QStringList localeOrder,
-                         CategoryTreeItem* parent, const Uuid& uuid) noexcept;
+                         CategoryTreeItem* parent,
+                         const WorkspaceLibraryDb::ElementMetadata_t& metadata) noexcept;
         ~CategoryTreeItem() noexcept;
 
         // Getters
@@ -79,14 +79,15 @@ class CategoryTreeItem final
         using ChildType = QSharedPointer<CategoryTreeItem<ElementType>>;
 
         // Methods
-        FilePath getLatestCategory(const WorkspaceLibraryDb& lib) const;
-        QSet<Uuid> getCategoryChilds(const WorkspaceLibraryDb& lib) const;
+        QList<WorkspaceLibraryDb::ElementMetadata_t> getCategoryChilds(
+            const WorkspaceLibraryDb& lib) const;
 
         // Attributes
         QStringList mLocaleOrder;
         CategoryTreeItem* mParent;
         Uuid mUuid;
-        QScopedPointer<ElementType> mCategory;
+        QString mName;
+        QString mDescription;
         unsigned int mDepth; ///< this is to avoid endless recursion in the parent-child relationship
         QString mExceptionMessage;
         QList<ChildType> mChilds;
@@ -0,0 +1,199 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include "libraryelementlistmodel.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+LibraryElementListModel::LibraryElementListModel(const QIcon& icon, QObject* parent) noexcept :
+    QAbstractListModel(parent), mIcon(icon)
+{
+}
+
+LibraryElementListModel::~LibraryElementListModel() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+FilePath LibraryElementListModel::getFilePath(const QModelIndex& index) const noexcept
+{
+    if (index.isValid() && mErrorMessage.isNull() && (index.row() < mElements.count())) {
+        return mElements.at(index.row()).filepath;
+    } else {
+        return FilePath();
+    }
+}
+
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void LibraryElementListModel::setElements(
+    QList<WorkspaceLibraryDb::ElementMetadata_t> elements) noexcept
+{
+    qSort(elements.begin(), elements.end(),
+          [](const WorkspaceLibraryDb::ElementMetadata_t& a,
+             const WorkspaceLibraryDb::ElementMetadata_t& b)
+          {return QString::localeAwareCompare(a.name, b.name) < 0;});
+
+    if ((!mErrorMessage.isNull()) || mElements.isEmpty()) {
+        // nothing to keep, so just replace all rows at once
+        beginResetModel();
+        mErrorMessage = QString();
+        mElements = elements;
+        endResetModel();
+        return;
+    }
+
+    // remove rows of elements which no longer exist
+    QSet<FilePath> newFilePaths;
+    foreach (const WorkspaceLibraryDb::ElementMetadata_t& element, elements) {
+        newFilePaths.insert(element.filepath);
+    }
+    for (int i = mElements.count() - 1; i >= 0; --i) {
+        if (!newFilePaths.contains(mElements.at(i).filepath)) {
+            beginRemoveRows(QModelIndex(), i, i);
+            mElements.removeAt(i);
+            endRemoveRows();
+        }
+    }
+
+    // update, move or insert the remaining rows to get the new (sorted) list
+    QHash<FilePath, int> oldIndices; // without the offset of the inserted rows
+    for (int i = 0; i < mElements.count(); ++i) {
+        oldIndices.insert(mElements.at(i).filepath, i);
+    }
+    int insertedRows = 0;
+    for (int i = 0; i < elements.count(); ++i) {
+        const WorkspaceLibraryDb::ElementMetadata_t& element = elements.at(i);
+        auto it = oldIndices.constFind(element.filepath);
+        int oldIndex = (it != oldIndices.constEnd()) ? (it.value() + insertedRows) : -1;
+        if (oldIndex < 0) {
+            // shifts all remaining rows by one
+            beginInsertRows(QModelIndex(), i, i);
+            mElements.insert(i, element);
+            endInsertRows();
+            ++insertedRows;
+            continue;
+        } else if (oldIndex > i) {
+            beginMoveRows(QModelIndex(), oldIndex, oldIndex, QModelIndex(), i);
+            mElements.move(oldIndex, i);
+            endMoveRows();
+            // shifts only the rows between the old and the new index by one
+            for (int k = i + 1; k <= oldIndex; ++k) {
+                ++oldIndices[mElements.at(k).filepath];
+            }
+        }
+        WorkspaceLibraryDb::ElementMetadata_t& current = mElements[i];
+        if ((current.uuid != element.uuid) || (current.name != element.name) ||
+            (current.description != element.description))
+        {
+            current = element;
+            emit dataChanged(index(i), index(i));
+        }
+    }
+    Q_ASSERT(mElements.count() == elements.count());
+}
+
+void LibraryElementListModel::setErrorMessage(const QString& message) noexcept
+{
+    beginResetModel();
+    mErrorMessage = message.isNull() ? QString("") : message;
+    mElements.clear();
+    endResetModel();
+}
+
+/*****************************************************************************************
+ *  Inherited from QAbstractListModel
+ ****************************************************************************************/
+
+int LibraryElementListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    } else if (!mErrorMessage.isNull()) {
+        return 1;
+    } else {
+        return mElements.count();
+    }
+}
+
+QVariant LibraryElementListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid()) {
+        return QVariant();
+    }
+
+    if (!mErrorMessage.isNull()) {
+        switch (role) {
+            case Qt::DisplayRole:
+            case Qt::ToolTipRole:
+                return mErrorMessage;
+            case Qt::DecorationRole:
+                return QIcon(":/img/status/dialog_error.png");
+            case Qt::BackgroundRole:
+                return QBrush(Qt::red);
+            case Qt::ForegroundRole:
+                return QBrush(Qt::white);
+            default:
+                return QVariant();
+        }
+    }
+
+    if (index.row() >= mElements.count()) {
+        return QVariant();
+    }
+    const WorkspaceLibraryDb::ElementMetadata_t& element = mElements.at(index.row());
+    switch (role) {
+        case Qt::DisplayRole:
+        case Qt::ToolTipRole:
+            return element.name;
+        case Qt::StatusTipRole:
+            return element.description;
+        case Qt::DecorationRole:
+            return mIcon;
+        case Qt::UserRole:
+            return element.filepath.toStr();
+        default:
+            return QVariant();
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
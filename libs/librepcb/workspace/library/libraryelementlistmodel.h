@@ -0,0 +1,97 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WORKSPACE_LIBRARYELEMENTLISTMODEL_H
+#define LIBREPCB_WORKSPACE_LIBRARYELEMENTLISTMODEL_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include <librepcb/common/fileio/filepath.h>
+#include "workspacelibrarydb.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Class LibraryElementListModel
+ ****************************************************************************************/
+
+/**
+ * @brief A list model of library elements, sorted by name
+ *
+ * The elements are set with #setElements(), typically with the result of one of the
+ * bulk metadata getters of librepcb::workspace::WorkspaceLibraryDb. Only the rows which
+ * actually changed are inserted, moved, removed or updated, so the selection and the
+ * scroll position of attached views are kept when the list is refreshed.
+ */
+class LibraryElementListModel final : public QAbstractListModel
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        LibraryElementListModel() = delete;
+        LibraryElementListModel(const LibraryElementListModel& other) = delete;
+        explicit LibraryElementListModel(const QIcon& icon, QObject* parent = nullptr) noexcept;
+        ~LibraryElementListModel() noexcept;
+
+        // Getters
+        FilePath getFilePath(const QModelIndex& index) const noexcept;
+
+        // Setters
+        void setElements(QList<WorkspaceLibraryDb::ElementMetadata_t> elements) noexcept;
+
+        /**
+         * @brief Replace all elements by a single row showing an error message
+         *
+         * The error row is removed again by the next call to #setElements().
+         */
+        void setErrorMessage(const QString& message) noexcept;
+
+        // Inherited from QAbstractListModel
+        int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+        // Operator Overloadings
+        LibraryElementListModel& operator=(const LibraryElementListModel& rhs) = delete;
+
+
+    private:
+
+        // Attributes
+        QIcon mIcon;
+        QString mErrorMessage;
+        QList<WorkspaceLibraryDb::ElementMetadata_t> mElements;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
+
+#endif // LIBREPCB_WORKSPACE_LIBRARYELEMENTLISTMODEL_H
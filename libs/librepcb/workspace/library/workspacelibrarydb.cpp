@@ -257,6 +257,90 @@ void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid
     if (pkgUuid) *pkgUuid = uuid;
 }
 
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getLibraryElementsMetadata<ComponentCategory>(
+    const FilePath& lib, const QStringList& localeOrder) const
+{
+    return getLibraryElementsMetadata("component_categories", "cat_id", lib, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getLibraryElementsMetadata<PackageCategory>(
+    const FilePath& lib, const QStringList& localeOrder) const
+{
+    return getLibraryElementsMetadata("package_categories", "cat_id", lib, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getLibraryElementsMetadata<Symbol>(
+    const FilePath& lib, const QStringList& localeOrder) const
+{
+    return getLibraryElementsMetadata("symbols", "symbol_id", lib, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getLibraryElementsMetadata<Package>(
+    const FilePath& lib, const QStringList& localeOrder) const
+{
+    return getLibraryElementsMetadata("packages", "package_id", lib, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getLibraryElementsMetadata<Component>(
+    const FilePath& lib, const QStringList& localeOrder) const
+{
+    return getLibraryElementsMetadata("components", "component_id", lib, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getLibraryElementsMetadata<Device>(
+    const FilePath& lib, const QStringList& localeOrder) const
+{
+    return getLibraryElementsMetadata("devices", "device_id", lib, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getElementsMetadataByCategory<Symbol>(
+    const Uuid& category, const QStringList& localeOrder) const
+{
+    return getElementsMetadataByCategory("symbols", "symbol_id", category, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getElementsMetadataByCategory<Package>(
+    const Uuid& category, const QStringList& localeOrder) const
+{
+    return getElementsMetadataByCategory("packages", "package_id", category, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getElementsMetadataByCategory<Component>(
+    const Uuid& category, const QStringList& localeOrder) const
+{
+    return getElementsMetadataByCategory("components", "component_id", category, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getElementsMetadataByCategory<Device>(
+    const Uuid& category, const QStringList& localeOrder) const
+{
+    return getElementsMetadataByCategory("devices", "device_id", category, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getCategoryChildsMetadata<ComponentCategory>(
+    const Uuid& parent, const QStringList& localeOrder) const
+{
+    return getCategoryChildsMetadata("component_categories", parent, localeOrder); // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getCategoryChildsMetadata<PackageCategory>(
+    const Uuid& parent, const QStringList& localeOrder) const
+{
+    return getCategoryChildsMetadata("package_categories", parent, localeOrder); // can throw
+}
+
 /*****************************************************************************************
  *  Getters: Special
  ****************************************************************************************/
@@ -388,6 +472,104 @@ void WorkspaceLibraryDb::getElementTranslations(const QString& table,
     if (keywords) *keywords = keywordsMap.value(localeOrder);
 }
 
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getLibraryElementsMetadata(
+    const QString& table, const QString& idRow, const FilePath& lib,
+    const QStringList& localeOrder) const
+{
+    QVariantMap values;
+    values.insert(":lib_id", getLibraryId(lib)); // can throw
+    return getElementsMetadata(table, idRow, "WHERE elements.lib_id = :lib_id", values,
+                               localeOrder); // can throw
+}
+
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getElementsMetadataByCategory(
+    const QString& table, const QString& idRow, const Uuid& category,
+    const QStringList& localeOrder) const
+{
+    QVariantMap values;
+    QString condition = "LEFT JOIN " % table % "_cat "
+                        "ON elements.id=" % table % "_cat." % idRow % " "
+                        "WHERE " % table % "_cat.category_uuid ";
+    if (category.isNull()) {
+        condition += "IS NULL";
+    } else {
+        condition += "= :category_uuid";
+        values.insert(":category_uuid", category.toStr());
+    }
+    return getElementsMetadata(table, idRow, condition, values, localeOrder); // can throw
+}
+
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getCategoryChildsMetadata(
+    const QString& table, const Uuid& parent, const QStringList& localeOrder) const
+{
+    QVariantMap values;
+    QString condition = "WHERE elements.parent_uuid ";
+    if (parent.isNull()) {
+        condition += "IS NULL";
+    } else {
+        condition += "= :parent_uuid";
+        values.insert(":parent_uuid", parent.toStr());
+    }
+    return getElementsMetadata(table, "cat_id", condition, values, localeOrder); // can throw
+}
+
+QList<WorkspaceLibraryDb::ElementMetadata_t> WorkspaceLibraryDb::getElementsMetadata(
+    const QString& table, const QString& idRow, const QString& condition,
+    const QVariantMap& values, const QStringList& localeOrder) const
+{
+    // Build a subquery which picks the translation of the first locale of localeOrder
+    // which has a value for the given column, with the empty locale as fallback. This
+    // is the same lookup as LocalizedNameMap::value() does, but without fetching all
+    // translations of all elements.
+    QString rank = "CASE " % table % "_tr.locale";
+    for (int i = 0; i < localeOrder.count(); ++i) {
+        QString locale = localeOrder.at(i);
+        rank += QString(" WHEN '%1' THEN %2").arg(locale.replace("'", "''")).arg(i);
+    }
+    rank += QString(" WHEN '' THEN %1 END").arg(localeOrder.count());
+    auto bestTranslation = [&](const QString& column) {
+        return QString("(SELECT " % column % " FROM " % table % "_tr "
+                       "WHERE " % table % "_tr." % idRow % "=elements.id "
+                       "AND " % column % " IS NOT NULL AND " % rank % " IS NOT NULL "
+                       "ORDER BY " % rank % " LIMIT 1)");
+    };
+
+    QSqlQuery query = mDb->prepareQuery(
+        "SELECT elements.filepath, elements.uuid, elements.version, " %
+        bestTranslation("name") % ", " % bestTranslation("description") % " "
+        "FROM " % table % " AS elements " % condition);
+    foreach (const QString& placeholder, values.keys()) {
+        query.bindValue(placeholder, values.value(placeholder));
+    }
+    mDb->exec(query);
+
+    QList<ElementMetadata_t> elements;
+    QList<Version> versions;
+    QHash<Uuid, int> indices; // to return only the latest version of each element
+    while (query.next()) {
+        ElementMetadata_t element;
+        element.filepath = FilePath::fromRelative(mWorkspace.getLibrariesPath(),
+                                                  query.value(0).toString());
+        element.uuid = Uuid(query.value(1).toString());
+        Version version(query.value(2).toString());
+        element.name = query.value(3).toString();
+        element.description = query.value(4).toString();
+        if ((!element.filepath.isValid()) || element.uuid.isNull() || (!version.isValid())) {
+            throw LogicError(__FILE__, __LINE__);
+        }
+        int index = indices.value(element.uuid, -1);
+        if (index < 0) {
+            indices.insert(element.uuid, elements.count());
+            elements.append(element);
+            versions.append(version);
+        } else if (version > versions.at(index)) {
+            elements[index] = element;
+            versions[index] = version;
+        }
+    }
+    return elements;
+}
+
 QMultiMap<Version, FilePath> WorkspaceLibraryDb::getElementFilePathsFromDb(
     const QString& tablename, const Uuid& uuid) const
 {
@@ -54,6 +54,18 @@ class WorkspaceLibraryDb final : public QObject
 
     public:
 
+        // Types
+
+        /**
+         * @brief Metadata of a library element, returned by the bulk metadata getters
+         */
+        struct ElementMetadata_t {
+            FilePath filepath;
+            Uuid uuid;
+            QString name;           ///< the name in the best matching locale
+            QString description;    ///< the description in the best matching locale
+        };
+
         // Constructors / Destructor
         WorkspaceLibraryDb() = delete;
         WorkspaceLibraryDb(const WorkspaceLibraryDb& other) = delete;
@@ -96,6 +108,49 @@ class WorkspaceLibraryDb final : public QObject
                                     QString* keywords = nullptr) const;
         void getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid = nullptr) const;
 
+        /**
+         * @brief Get the metadata of all elements of a specific type in a library
+         *
+         * In contrast to calling #getElementTranslations() for each element, this needs
+         * only a single query. The translations are chosen within the query in the same
+         * way as LocalizedNameMap::value() does it.
+         *
+         * @param lib           The library directory
+         * @param localeOrder   The preferred locales, best match first
+         *
+         * @return The metadata of all elements of the library (in no particular order)
+         */
+        template <typename ElementType>
+        QList<ElementMetadata_t> getLibraryElementsMetadata(const FilePath& lib,
+                                                            const QStringList& localeOrder) const;
+
+        /**
+         * @brief Get the metadata of all symbols/packages/components/devices of a category
+         *
+         * Like #getLibraryElementsMetadata(), but for the elements returned by
+         * #getSymbolsByCategory() and friends. If an element exists in several versions,
+         * only the latest one is returned.
+         *
+         * @param category      The category UUID (null for elements without category)
+         * @param localeOrder   The preferred locales, best match first
+         */
+        template <typename ElementType>
+        QList<ElementMetadata_t> getElementsMetadataByCategory(const Uuid& category,
+            const QStringList& localeOrder) const;
+
+        /**
+         * @brief Get the metadata of all child categories of a category
+         *
+         * Like #getElementsMetadataByCategory(), but for the categories returned by
+         * #getComponentCategoryChilds() and #getPackageCategoryChilds().
+         *
+         * @param parent        The parent category UUID (null for the root categories)
+         * @param localeOrder   The preferred locales, best match first
+         */
+        template <typename ElementType>
+        QList<ElementMetadata_t> getCategoryChildsMetadata(const Uuid& parent,
+            const QStringList& localeOrder) const;
+
         // Getters: Special
         QSet<Uuid> getComponentCategoryChilds(const Uuid& parent) const;
         QSet<Uuid> getPackageCategoryChilds(const Uuid& parent) const;
@@ -133,6 +188,16 @@ class WorkspaceLibraryDb final : public QObject
         void getElementTranslations(const QString& table, const QString& idRow,
                                     const FilePath& elemDir, const QStringList& localeOrder,
                                     QString* name, QString* desc, QString* keywords) const;
+        QList<ElementMetadata_t> getLibraryElementsMetadata(const QString& table,
+            const QString& idRow, const FilePath& lib, const QStringList& localeOrder) const;
+        QList<ElementMetadata_t> getElementsMetadataByCategory(const QString& table,
+            const QString& idRow, const Uuid& category, const QStringList& localeOrder) const;
+        QList<ElementMetadata_t> getCategoryChildsMetadata(const QString& table,
+            const Uuid& parent, const QStringList& localeOrder) const;
+        QList<ElementMetadata_t> getElementsMetadata(const QString& table, const QString& idRow,
+                                                     const QString& condition,
+                                                     const QVariantMap& values,
+                                                     const QStringList& localeOrder) const;
         QMultiMap<Version, FilePath> getElementFilePathsFromDb(const QString& tablename,
                                                                const Uuid& uuid) const;
         FilePath getLatestVersionFilePath(const QMultiMap<Version, FilePath>& list) const noexcept;
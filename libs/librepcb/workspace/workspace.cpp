@@ -180,6 +180,13 @@ FavoriteProjectsModel& Workspace::getFavoriteProjectsModel() const noexcept
     return *mFavoriteProjectsModel;
 }
 
+FilePath Workspace::getProjectCacheFilePath(const FilePath& projectFile) const noexcept
+{
+    QByteArray hash = QCryptographicHash::hash(projectFile.toUnique().toStr().toUtf8(),
+                                               QCryptographicHash::Sha1);
+    return mMetadataPath.getPathTo("cache/" % QString(hash.toHex()) % ".lpcache");
+}
+
 /*****************************************************************************************
  *  Library Management
  ****************************************************************************************/
@@ -111,6 +111,20 @@ class Workspace final : public QObject
          */
         const FilePath& getLibrariesPath() const {return mLibrariesPath;}
 
+        /**
+         * @brief Get the filepath to the binary file cache of a project
+         *
+         * The cache files are stored in "v#/cache" and named by a hash of the project
+         * filepath, so they never pollute the project directory itself.
+         *
+         * @param projectFile   The filepath to the *.lpp project file
+         *
+         * @return The filepath to the cache file (may not exist)
+         *
+         * @see librepcb::SExprFileCache
+         */
+        FilePath getProjectCacheFilePath(const FilePath& projectFile) const noexcept;
+
         ProjectTreeModel& getProjectTreeModel() const noexcept;
         RecentProjectsModel& getRecentProjectsModel() const noexcept;
         FavoriteProjectsModel& getFavoriteProjectsModel() const noexcept;
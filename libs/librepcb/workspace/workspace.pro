@@ -25,6 +25,7 @@ SOURCES += \
     fileiconprovider.cpp \
     library/cat/categorytreeitem.cpp \
     library/cat/categorytreemodel.cpp \
+    library/libraryelementlistmodel.cpp \
     library/workspacelibrarydb.cpp \
     library/workspacelibraryscanner.cpp \
     projecttreemodel.cpp \
@@ -47,6 +48,7 @@ HEADERS += \
     fileiconprovider.h \
     library/cat/categorytreeitem.h \
     library/cat/categorytreemodel.h \
+    library/libraryelementlistmodel.h \
     library/workspacelibrarydb.h \
     library/workspacelibraryscanner.h \
     projecttreemodel.h \
@@ -0,0 +1,117 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/attributes/attributeprovider.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+/**
+ * @brief Attribute provider which counts how often its values are requested
+ */
+class CountingAttributeProvider final : public AttributeProvider
+{
+    public:
+        CountingAttributeProvider() noexcept :
+            mValue("foo"), mParent(nullptr), mCount(0) {}
+
+        QString getUserDefinedAttributeValue(const QString& key) const noexcept override {
+            ++mCount;
+            return (key == "KEY") ? mValue : QString();
+        }
+        QVector<const AttributeProvider*> getAttributeProviderParents() const noexcept override {
+            return QVector<const AttributeProvider*>{mParent};
+        }
+
+        QString mValue;
+        const AttributeProvider* mParent;
+        mutable int mCount;
+
+    signals:
+        void attributesChanged() override {}
+};
+
+class AttributeProviderTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(AttributeProviderTest, testValuesAreMemoized)
+{
+    CountingAttributeProvider ap;
+    EXPECT_EQ("foo", ap.getAttributeValue("KEY"));
+    EXPECT_EQ("foo", ap.getAttributeValue("KEY"));
+    EXPECT_EQ("", ap.getAttributeValue("FOO"));
+    EXPECT_EQ("", ap.getAttributeValue("FOO"));
+    EXPECT_EQ(2, ap.mCount);
+}
+
+TEST_F(AttributeProviderTest, testInvalidation)
+{
+    CountingAttributeProvider ap;
+    EXPECT_EQ("foo", ap.getAttributeValue("KEY"));
+    ap.mValue = "bar";
+    AttributeProvider::invalidateAttributeValues();
+    EXPECT_EQ("bar", ap.getAttributeValue("KEY"));
+}
+
+TEST_F(AttributeProviderTest, testChildIsInvalidatedByParentChange)
+{
+    CountingAttributeProvider parent;
+    CountingAttributeProvider child;
+    child.mValue = QString();
+    child.mParent = &parent;
+    EXPECT_EQ("foo", child.getAttributeValue("KEY"));
+    parent.mValue = "bar";
+    AttributeProvider::invalidateAttributeValues();
+    EXPECT_EQ("bar", child.getAttributeValue("KEY"));
+}
+
+TEST_F(AttributeProviderTest, testDestroyedProviderIsRemovedFromCache)
+{
+    QScopedPointer<CountingAttributeProvider> ap(new CountingAttributeProvider());
+    EXPECT_EQ("foo", ap->getAttributeValue("KEY"));
+    ap.reset(new CountingAttributeProvider()); // might get the same address
+    ap->mValue = "bar";
+    EXPECT_EQ("bar", ap->getAttributeValue("KEY"));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -62,6 +62,16 @@ TEST_P(AttributeSubstitutorTest, testData)
     EXPECT_EQ(data.output, output) << "Actual value: '" << qPrintable(output) << "'";
 }
 
+TEST_P(AttributeSubstitutorTest, testDataWithTemplate)
+{
+    const AttributeSubstitutorTestData& data = GetParam();
+
+    AttributeProviderDummy ap;
+    AttributeSubstitutionTemplate tmpl(data.input);
+    QString output = AttributeSubstitutor::substitute(tmpl, &ap);
+    EXPECT_EQ(data.output, output) << "Actual value: '" << qPrintable(output) << "'";
+}
+
 /*****************************************************************************************
  *  Test Data
  ****************************************************************************************/
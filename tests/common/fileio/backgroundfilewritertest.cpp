@@ -0,0 +1,197 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/backgroundfilewriter.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/smartsexprfile.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BackgroundFileWriterTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath()
+                       .getPathTo("BackgroundFileWriterTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+            mFile = mTempDir.getPathTo("file.lp");
+
+            // a file can't be written if its parent "directory" is a regular file
+            FileUtils::writeFile(mTempDir.getPathTo("nodir"), "");
+            mInvalidFile = mTempDir.getPathTo("nodir/file.lp");
+
+            mWriter.reset(new BackgroundFileWriter());
+        }
+
+        virtual void TearDown() override
+        {
+            mWriter.reset(); // blocks until all files are written
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        static SExpression createDom(int value, int children = 0) noexcept {
+            SExpression dom = SExpression::createList("test");
+            dom.appendToken(value);
+            for (int i = 0; i < children; ++i) {
+                dom.appendTokenChild("child", i, true);
+            }
+            return dom;
+        }
+
+        static QByteArray content(const SExpression& dom) {
+            QString str = dom.toString(0);
+            if (!str.endsWith('\n')) {
+                str.append('\n');
+            }
+            return str.toUtf8();
+        }
+
+        /**
+         * @brief Queue a large file to keep the worker thread busy for a while
+         */
+        void keepWorkerBusy() noexcept {
+            mWriter->write(mTempDir.getPathTo("large.lp"), createDom(0, 200000));
+        }
+
+        FilePath mTempDir;
+        FilePath mFile;
+        FilePath mInvalidFile;
+        QScopedPointer<BackgroundFileWriter> mWriter;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BackgroundFileWriterTest, testNewestContentIsWritten)
+{
+    for (int i = 1; i <= 3; ++i) {
+        mWriter->write(mFile, createDom(i));
+    }
+    QStringList errors;
+    EXPECT_TRUE(mWriter->flush(errors));
+    EXPECT_TRUE(errors.isEmpty());
+    EXPECT_EQ(content(createDom(3)), FileUtils::readFile(mFile));
+}
+
+TEST_F(BackgroundFileWriterTest, testPendingJobsAreCoalesced)
+{
+    QAtomicInt failedWrites;
+    QObject::connect(mWriter.data(), &BackgroundFileWriter::writeFailed,
+                     [&failedWrites](){failedWrites.ref();}); // direct connection
+
+    // while the worker is busy, all jobs for the same file are merged into one
+    keepWorkerBusy();
+    for (int i = 1; i <= 3; ++i) {
+        mWriter->write(mInvalidFile, createDom(i));
+    }
+    QStringList errors;
+    EXPECT_FALSE(mWriter->flush(errors));
+    EXPECT_EQ(1, errors.count());
+    EXPECT_EQ(1, failedWrites.load());
+}
+
+TEST_F(BackgroundFileWriterTest, testUnchangedContentIsNotWrittenAgain)
+{
+    QStringList errors;
+    mWriter->write(mFile, createDom(1));
+    EXPECT_TRUE(mWriter->flush(errors));
+    FileUtils::writeFile(mFile, "modified");
+
+    // the writer only compares with the content it has written the last time
+    mWriter->write(mFile, createDom(1));
+    EXPECT_TRUE(mWriter->flush(errors));
+    EXPECT_EQ(QByteArray("modified"), FileUtils::readFile(mFile));
+    mWriter->write(mFile, createDom(2));
+    EXPECT_TRUE(mWriter->flush(errors));
+    EXPECT_EQ(content(createDom(2)), FileUtils::readFile(mFile));
+}
+
+TEST_F(BackgroundFileWriterTest, testFlushReportsErrorsOnlyOnce)
+{
+    mWriter->write(mFile, createDom(1));
+    mWriter->write(mInvalidFile, createDom(1));
+    QStringList errors;
+    EXPECT_FALSE(mWriter->flush(errors));
+    EXPECT_EQ(1, errors.count());
+    EXPECT_TRUE(mFile.isExistingFile()); // all files are written when flush() returns
+    errors.clear();
+    EXPECT_TRUE(mWriter->flush(errors));
+    EXPECT_TRUE(errors.isEmpty());
+}
+
+TEST_F(BackgroundFileWriterTest, testDiscard)
+{
+    keepWorkerBusy();
+    mWriter->write(mFile, createDom(1));
+    mWriter->write(mInvalidFile, createDom(1));
+    mWriter->discard(mFile); // the job is still pending
+    mWriter->discard(mInvalidFile); // also drops the error if the job already failed
+    QStringList errors;
+    EXPECT_TRUE(mWriter->flush(errors));
+    EXPECT_TRUE(errors.isEmpty());
+    EXPECT_FALSE(mFile.isExistingFile());
+}
+
+TEST_F(BackgroundFileWriterTest, testFlushBeforeSavingSmartFile)
+{
+    QScopedPointer<SmartSExprFile> file(SmartSExprFile::create(mFile));
+    FilePath backupFile(mFile.toStr() % "~");
+
+    // the backup file is written in the background, flush() waits for it
+    file->save(createDom(1), false);
+    QStringList errors;
+    EXPECT_TRUE(mWriter->flush(errors));
+    EXPECT_EQ(content(createDom(1)), FileUtils::readFile(backupFile));
+
+    // saving to the original file is done synchronously
+    file->save(createDom(2), true);
+    EXPECT_EQ(content(createDom(2)), FileUtils::readFile(mFile));
+
+    // the backup file is removed together with the smart file
+    file.reset();
+    EXPECT_FALSE(backupFile.isExistingFile());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
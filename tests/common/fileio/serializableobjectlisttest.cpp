@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 
+#include <iostream>
 #include <QtCore>
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/serializableobjectlist.h>
@@ -162,6 +163,65 @@ TEST_F(SerializableObjectListTest, testIndexOfName)
     EXPECT_EQ(2, l.indexOf(mMocks[2]->mName));
 }
 
+TEST_F(SerializableObjectListTest, testIndexOfAfterModifications)
+{
+    List l{mMocks[0], mMocks[1]};
+    EXPECT_EQ(1, l.indexOf(mMocks[1]->mUuid)); // builds the indices
+    EXPECT_EQ(1, l.indexOf(mMocks[1]->mName));
+    l.append(mMocks[2]);
+    EXPECT_EQ(2, l.indexOf(mMocks[2]->mUuid));
+    EXPECT_EQ(2, l.indexOf(mMocks[2]->mName));
+    l.swap(0, 2);
+    EXPECT_EQ(0, l.indexOf(mMocks[2]->mUuid));
+    EXPECT_EQ(2, l.indexOf(mMocks[0]->mName));
+    l.remove(1);
+    EXPECT_EQ(-1, l.indexOf(mMocks[1]->mUuid));
+    EXPECT_EQ(-1, l.indexOf(mMocks[1]->mName));
+    EXPECT_EQ(1, l.indexOf(mMocks[0]->mUuid));
+    l.insert(0, mMocks[1]);
+    EXPECT_EQ(0, l.indexOf(mMocks[1]->mUuid));
+    EXPECT_EQ(2, l.indexOf(mMocks[0]->mName));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfRenamedElement)
+{
+    List l{mMocks[0], mMocks[1], mMocks[2]};
+    EXPECT_EQ(1, l.indexOf(QString("bar"))); // builds the index
+    mMocks[1]->mName = "baz";
+    List::invalidateIndices();
+    EXPECT_EQ(-1, l.indexOf(QString("bar")));
+    EXPECT_EQ(1, l.indexOf(QString("baz")));
+    mMocks[2]->mName = "bar";
+    List::invalidateIndices();
+    EXPECT_EQ(2, l.indexOf(QString("bar")));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfElementWithChangedUuid)
+{
+    List l{mMocks[0], mMocks[1], mMocks[2]};
+    Uuid oldUuid = mMocks[1]->mUuid;
+    EXPECT_EQ(1, l.indexOf(oldUuid)); // builds the index
+    mMocks[1]->mUuid = Uuid::createRandom(); // without invalidating the index
+    EXPECT_EQ(-1, l.indexOf(oldUuid));
+    EXPECT_EQ(1, l.indexOf(mMocks[1]->mUuid));
+    mMocks[2]->mUuid = oldUuid;
+    List::invalidateIndices();
+    EXPECT_EQ(2, l.indexOf(oldUuid));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfReturnsFirstOccurrence)
+{
+    List l{mMocks[0], mMocks[1], mMocks[0]};
+    EXPECT_EQ(0, l.indexOf(mMocks[0]->mUuid));
+    EXPECT_EQ(0, l.indexOf(mMocks[0]->mName));
+    l.remove(0);
+    EXPECT_EQ(1, l.indexOf(mMocks[0]->mUuid));
+    EXPECT_EQ(1, l.indexOf(mMocks[0]->mName));
+    l.append(mMocks[0]);
+    EXPECT_EQ(1, l.indexOf(mMocks[0]->mUuid));
+    EXPECT_EQ(1, l.indexOf(mMocks[0]->mName));
+}
+
 TEST_F(SerializableObjectListTest, testContainsPointer)
 {
     List l{mMocks[0], mMocks[1], mMocks[2]};
@@ -340,6 +400,50 @@ TEST_F(SerializableObjectListTest, testOperatorMove)
     EXPECT_EQ(mMocks[1], l2[1]);
 }
 
+/**
+ * @brief Lookup benchmark with as many elements as a large BGA package has pads
+ *
+ * Compares the indexed lookups with a linear search (the previous implementation). The
+ * disabled test can be run with "--gtest_also_run_disabled_tests --gtest_filter=*benchmark*".
+ */
+TEST_F(SerializableObjectListTest, DISABLED_benchmarkLookup2000Pads)
+{
+    List l;
+    for (int i = 0; i < 2000; ++i) {
+        l.append(std::make_shared<Mock>(Uuid::createRandom(), QString("P%1").arg(i)));
+    }
+
+    // map all pads once by UUID and by name, like it's done e.g. for pad-signal maps
+    QElapsedTimer timer;
+    timer.start();
+    int sum = 0;
+    const List& cl = l;
+    for (const Mock& pad : cl) {
+        int k = 0;
+        for (const Mock& other : cl) {
+            if (other.mUuid == pad.mUuid) {sum += k; break;}
+            ++k;
+        }
+        k = 0;
+        for (const Mock& other : cl) {
+            if (other.mName == pad.mName) {sum += k; break;}
+            ++k;
+        }
+    }
+    qint64 linearMs = timer.elapsed();
+    timer.restart();
+    for (const Mock& pad : cl) {
+        sum -= l.indexOf(pad.mUuid);
+        sum -= l.indexOf(pad.mName);
+    }
+    qint64 indexedMs = timer.elapsed();
+    EXPECT_EQ(0, sum);
+    std::cout << "linear search: " << linearMs << " ms" << std::endl;
+    std::cout << "indexed lookup: " << indexedMs << " ms" << std::endl;
+    RecordProperty("linear_ms", int(linearMs));
+    RecordProperty("indexed_ms", int(indexedMs));
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -0,0 +1,159 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/sexprfilecache.h>
+#include <librepcb/common/fileio/fileutils.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class SExprFileCacheTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("SExprFileCacheTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+            mCacheFile = mTempDir.getPathTo("cache.lpcache");
+            mSExprFile = mTempDir.getPathTo("file.lp");
+            mContent = "(test 42 \"foo bar\"\n (child (uuid 1234)) (empty)\n)\n";
+            FileUtils::writeFile(mSExprFile, mContent); // can throw
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        FilePath mTempDir;
+        FilePath mCacheFile;
+        FilePath mSExprFile;
+        QByteArray mContent;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(SExprFileCacheTest, testMissOnEmptyCache)
+{
+    SExprFileCache cache(mCacheFile);
+    SExpression dom;
+    EXPECT_FALSE(cache.get(mSExprFile, mContent, dom));
+}
+
+TEST_F(SExprFileCacheTest, testHitAfterReload)
+{
+    SExpression parsed = SExpression::parse(mContent, mSExprFile);
+    {
+        SExprFileCache cache(mCacheFile);
+        cache.put(mSExprFile, mContent, parsed);
+        cache.save();
+    }
+    EXPECT_TRUE(mCacheFile.isExistingFile());
+    SExprFileCache cache(mCacheFile);
+    SExpression dom;
+    EXPECT_TRUE(cache.get(mSExprFile, mContent, dom));
+    EXPECT_EQ(parsed.toString(0), dom.toString(0));
+    EXPECT_EQ(mSExprFile, dom.getFilePath());
+}
+
+TEST_F(SExprFileCacheTest, testMissOnModifiedContent)
+{
+    SExprFileCache cache(mCacheFile);
+    cache.put(mSExprFile, mContent, SExpression::parse(mContent, mSExprFile));
+    QByteArray modified = mContent;
+    modified.replace("42", "43"); // same size, but different hash
+    SExpression dom;
+    EXPECT_FALSE(cache.get(mSExprFile, modified, dom));
+}
+
+TEST_F(SExprFileCacheTest, testCorruptCacheFileIsIgnored)
+{
+    FileUtils::writeFile(mCacheFile, "garbage"); // can throw
+    SExprFileCache cache(mCacheFile);
+    SExpression dom;
+    EXPECT_FALSE(cache.get(mSExprFile, mContent, dom));
+}
+
+TEST_F(SExprFileCacheTest, testMissOnCorruptData)
+{
+    {
+        SExprFileCache cache(mCacheFile);
+        cache.put(mSExprFile, mContent, SExpression::parse(mContent, mSExprFile));
+        cache.save();
+    }
+    // modify the binary DOM tree without breaking its structure ("foo" -> "fob")
+    QByteArray fileContent = FileUtils::readFile(mCacheFile); // can throw
+    QByteArray original("\0f\0o\0o", 6);
+    ASSERT_EQ(1, fileContent.count(original));
+    fileContent.replace(original, QByteArray("\0f\0o\0b", 6));
+    FileUtils::writeFile(mCacheFile, fileContent); // can throw
+
+    SExprFileCache cache(mCacheFile);
+    SExpression dom;
+    EXPECT_FALSE(cache.get(mSExprFile, mContent, dom));
+}
+
+TEST_F(SExprFileCacheTest, testReadBinaryRejectsTooManyChildren)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out << quint8(0) << QString("list") << qint32(0x7FFFFFFF);
+    QDataStream in(data);
+    EXPECT_THROW(SExpression::readBinary(in, mSExprFile), RuntimeError);
+}
+
+TEST_F(SExprFileCacheTest, testReadBinaryRejectsTooDeepNesting)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    for (int i = 0; i < 100000; ++i) {
+        out << quint8(0) << QString("list") << qint32(1);
+    }
+    out << quint8(0) << QString("list") << qint32(0);
+    QDataStream in(data);
+    EXPECT_THROW(SExpression::readBinary(in, mSExprFile), RuntimeError);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,161 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/sexprfilepreloader.h>
+#include <librepcb/common/fileio/smartsexprfile.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class SExprFilePreloaderTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath()
+                       .getPathTo("SExprFilePreloaderTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+
+            // some valid files and a file with a syntax error
+            for (int i = 0; i < 10; ++i) {
+                FilePath fp = mTempDir.getPathTo(QString("file%1.lp").arg(i));
+                QString content = QString("(test %1 \"foo bar\"\n (child (uuid %1))\n)\n")
+                                  .arg(i);
+                FileUtils::writeFile(fp, content.toUtf8()); // can throw
+                mValidFiles.append(fp);
+            }
+            mInvalidFile = mTempDir.getPathTo("invalid.lp");
+            FileUtils::writeFile(mInvalidFile, "(test 42\n (child)\n"); // can throw
+        }
+
+        virtual void TearDown() override
+        {
+            // remove temporary directory
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        /**
+         * @brief Parse a file with librepcb::SmartSExprFile (preloaded if possible)
+         */
+        static QString parse(const FilePath& fp) {
+            SmartSExprFile file(fp, false, true); // can throw
+            return file.parseFileAndBuildDomTree().toString(0); // can throw
+        }
+
+        static QString parseError(const FilePath& fp) {
+            try {
+                parse(fp);
+            } catch (const Exception& e) {
+                return e.getMsg();
+            }
+            return QString();
+        }
+
+        FilePath mTempDir;
+        QList<FilePath> mValidFiles;
+        FilePath mInvalidFile;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(SExprFilePreloaderTest, testResultsMatchSynchronousParsing)
+{
+    QStringList expected;
+    foreach (const FilePath& fp, mValidFiles) {
+        expected.append(parse(fp));
+    }
+    QString expectedError = parseError(mInvalidFile);
+    ASSERT_FALSE(expectedError.isEmpty());
+
+    SExprFilePreloader preloader;
+    preloader.preload(mValidFiles + QList<FilePath>{mInvalidFile}, false);
+    QStringList actual;
+    foreach (const FilePath& fp, mValidFiles) {
+        actual.append(parse(fp));
+    }
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(expectedError, parseError(mInvalidFile));
+}
+
+TEST_F(SExprFilePreloaderTest, testTake)
+{
+    const FilePath& fp = mValidFiles.first();
+    SExprFilePreloader preloader;
+    preloader.preload({fp}, false);
+    QByteArray content;
+    SExpression dom;
+    EXPECT_FALSE(preloader.take(mValidFiles.last(), content, dom)); // not preloaded
+    ASSERT_TRUE(preloader.take(fp, content, dom));
+    EXPECT_EQ(FileUtils::readFile(fp), content);
+    EXPECT_EQ(fp, dom.getFilePath());
+    EXPECT_FALSE(preloader.take(fp, content, dom)); // already taken
+    EXPECT_FALSE(preloader.take(mInvalidFile, content, dom)); // not preloaded
+}
+
+TEST_F(SExprFilePreloaderTest, testTakeThrowsParseError)
+{
+    SExprFilePreloader preloader;
+    preloader.preload({mInvalidFile}, false);
+    QByteArray content;
+    SExpression dom;
+    EXPECT_THROW(preloader.take(mInvalidFile, content, dom), Exception);
+}
+
+TEST_F(SExprFilePreloaderTest, testRestoreLoadsBackupFiles)
+{
+    const FilePath& fp = mValidFiles.first();
+    FilePath backup(fp.toStr() % "~");
+    FileUtils::writeFile(backup, "(backup)\n"); // can throw
+    SExprFilePreloader preloader;
+    preloader.preload({fp, mValidFiles.last()}, true);
+    QByteArray content;
+    SExpression dom;
+    EXPECT_FALSE(preloader.take(fp, content, dom));
+    ASSERT_TRUE(preloader.take(backup, content, dom));
+    EXPECT_EQ(QString("(backup)"), dom.toString(0).trimmed());
+    EXPECT_TRUE(preloader.take(mValidFiles.last(), content, dom)); // has no backup
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,129 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/smartsexprfile.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class SmartSExprFileTest : public ::testing::Test
+{
+    protected:
+
+        virtual void SetUp() override
+        {
+            // create temporary, empty directory
+            mTempDir = FilePath::getApplicationTempPath().getPathTo("SmartSExprFileTest");
+            if (mTempDir.isExistingDir()) {
+                FileUtils::removeDirRecursively(mTempDir); // can throw
+            }
+            FileUtils::makePath(mTempDir);
+            mFile = mTempDir.getPathTo("file.lp");
+        }
+
+        virtual void TearDown() override
+        {
+            FileUtils::removeDirRecursively(mTempDir); // can throw
+        }
+
+        static SExpression createDom(int value) noexcept {
+            SExpression dom = SExpression::createList("test");
+            dom.appendToken(value);
+            return dom;
+        }
+
+        /**
+         * @brief Replace the file content by a marker to detect whether it gets written
+         */
+        void markFile() {
+            FileUtils::writeFile(mFile, "marker"); // can throw
+        }
+
+        bool isFileMarked() const {
+            return FileUtils::readFile(mFile) == QByteArray("marker"); // can throw
+        }
+
+        FilePath mTempDir;
+        FilePath mFile;
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(SmartSExprFileTest, testSavingUnmodifiedCreatedFile)
+{
+    QScopedPointer<SmartSExprFile> file(SmartSExprFile::create(mFile));
+    file->save(createDom(1), true);
+    EXPECT_FALSE(isFileMarked());
+
+    markFile();
+    file->save(createDom(1), true);
+    EXPECT_TRUE(isFileMarked()); // unmodified content is not written again
+    file->save(createDom(2), true);
+    EXPECT_FALSE(isFileMarked());
+}
+
+TEST_F(SmartSExprFileTest, testSavingUnmodifiedOpenedFile)
+{
+    {
+        QScopedPointer<SmartSExprFile> file(SmartSExprFile::create(mFile));
+        file->save(createDom(1), true);
+    }
+    SmartSExprFile file(mFile, false, false);
+    SExpression dom = file.parseFileAndBuildDomTree();
+
+    // the content of the loaded file is known, so it doesn't need to be written
+    markFile();
+    file.save(dom, true);
+    EXPECT_TRUE(isFileMarked());
+    file.save(createDom(2), true);
+    EXPECT_FALSE(isFileMarked());
+    EXPECT_EQ(createDom(2).toString(0), file.parseFileAndBuildDomTree().toString(0));
+}
+
+TEST_F(SmartSExprFileTest, testSavingUnmodifiedRemovedFile)
+{
+    QScopedPointer<SmartSExprFile> file(SmartSExprFile::create(mFile));
+    file->save(createDom(1), true);
+    FileUtils::removeFile(mFile);
+    file->save(createDom(1), true);
+    EXPECT_TRUE(mFile.isExistingFile());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,131 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/font/strokefont.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class StrokeFontTest : public ::testing::Test
+{
+    protected:
+
+        // returns the bounding rect of all vertices in millimeters
+        static QRectF boundingRectMm(const QVector<Path>& paths) noexcept
+        {
+            QPolygonF points;
+            foreach (const Path& path, paths) {
+                foreach (const Vertex& vertex, path.getVertices()) {
+                    points.append(QPointF(vertex.getPos().getX().toMm(),
+                                          vertex.getPos().getY().toMm()));
+                }
+            }
+            return points.boundingRect();
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(StrokeFontTest, testEmptyText)
+{
+    Alignment align(HAlign::left(), VAlign::bottom());
+    EXPECT_TRUE(StrokeFont::instance().stroke("", Length(1000000), align).isEmpty());
+    EXPECT_TRUE(StrokeFont::instance().stroke("  ", Length(1000000), align).isEmpty());
+}
+
+TEST_F(StrokeFontTest, testGlyph)
+{
+    StrokeFont font;
+    StrokeFont::Glyph glyph = font.getGlyph('A');
+    EXPECT_EQ(6.0, glyph.advance);
+    EXPECT_EQ(2, glyph.strokes.count());
+
+    // the second call returns the cached glyph
+    StrokeFont::Glyph cached = font.getGlyph('A');
+    EXPECT_EQ(glyph.advance, cached.advance);
+    EXPECT_EQ(glyph.strokes, cached.strokes);
+}
+
+TEST_F(StrokeFontTest, testUnknownCharacterIsDrawnAsBox)
+{
+    StrokeFont::Glyph glyph = StrokeFont::instance().getGlyph(QChar(0x4E2D));
+    ASSERT_EQ(1, glyph.strokes.count());
+    EXPECT_EQ(5, glyph.strokes.first().count());
+    EXPECT_TRUE(glyph.strokes.first().isClosed());
+}
+
+TEST_F(StrokeFontTest, testAlignment)
+{
+    const StrokeFont& font = StrokeFont::instance();
+    Length height(6000000); // 1 font unit = 1mm
+
+    QRectF rect = boundingRectMm(font.stroke("H", height,
+                                             Alignment(HAlign::left(), VAlign::bottom())));
+    EXPECT_EQ(QRectF(0, 0, 4, 6), rect);
+
+    rect = boundingRectMm(font.stroke("H", height,
+                                      Alignment(HAlign::center(), VAlign::center())));
+    EXPECT_EQ(QRectF(-2, -3, 4, 6), rect);
+
+    rect = boundingRectMm(font.stroke("H", height,
+                                      Alignment(HAlign::right(), VAlign::top())));
+    EXPECT_EQ(QRectF(-4, -6, 4, 6), rect);
+}
+
+TEST_F(StrokeFontTest, testLetterSpacing)
+{
+    QRectF rect = boundingRectMm(StrokeFont::instance().stroke("HH", Length(6000000),
+                                 Alignment(HAlign::left(), VAlign::bottom())));
+    EXPECT_EQ(QRectF(0, 0, 10, 6), rect);
+}
+
+TEST_F(StrokeFontTest, testMultipleLines)
+{
+    QRectF rect = boundingRectMm(StrokeFont::instance().stroke("H\nH", Length(6000000),
+                                 Alignment(HAlign::left(), VAlign::bottom())));
+    EXPECT_EQ(QRectF(0, 0, 4, 15), rect);
+}
+
+TEST_F(StrokeFontTest, testStrokeWidth)
+{
+    EXPECT_EQ(Length(250000), StrokeFont::calcStrokeWidth(Length(2000000)));
+    EXPECT_LT(Length(0), StrokeFont::calcStrokeWidth(Length(0)));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
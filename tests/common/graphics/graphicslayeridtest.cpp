@@ -0,0 +1,117 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GraphicsLayerIdTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GraphicsLayerIdTest, testDefaultConstructor)
+{
+    GraphicsLayerId id;
+    EXPECT_FALSE(id.isValid());
+    EXPECT_EQ(QString(), id.getName());
+    EXPECT_EQ(id, id.getMirrored());
+    EXPECT_FALSE(id.isCopperLayer());
+}
+
+TEST_F(GraphicsLayerIdTest, testEmptyName)
+{
+    EXPECT_FALSE(GraphicsLayerId(QString()).isValid());
+    EXPECT_FALSE(GraphicsLayerId::find(QString()).isValid());
+}
+
+TEST_F(GraphicsLayerIdTest, testInterning)
+{
+    GraphicsLayerId id1(GraphicsLayer::sTopCopper);
+    GraphicsLayerId id2(QString(GraphicsLayer::sTopCopper));
+    EXPECT_TRUE(id1.isValid());
+    EXPECT_EQ(id1, id2);
+    EXPECT_EQ(id1, GraphicsLayerId::find(GraphicsLayer::sTopCopper));
+    EXPECT_EQ(QString(GraphicsLayer::sTopCopper), id1.getName());
+    EXPECT_NE(id1, GraphicsLayerId(GraphicsLayer::sTopPlacement));
+}
+
+TEST_F(GraphicsLayerIdTest, testFindDoesNotIntern)
+{
+    QString name = "GraphicsLayerIdTest_never_interned";
+    EXPECT_FALSE(GraphicsLayerId::find(name).isValid());
+    EXPECT_FALSE(GraphicsLayerId::find(name).isValid());
+}
+
+TEST_F(GraphicsLayerIdTest, testMirrored)
+{
+    GraphicsLayerId top(GraphicsLayer::sTopStopMask);
+    GraphicsLayerId bot(GraphicsLayer::sBotStopMask);
+    GraphicsLayerId outlines(GraphicsLayer::sBoardOutlines);
+    EXPECT_EQ(bot, top.getMirrored());
+    EXPECT_EQ(top, bot.getMirrored());
+    EXPECT_EQ(outlines, outlines.getMirrored());
+}
+
+TEST_F(GraphicsLayerIdTest, testMirroredOfNewName)
+{
+    // the mirrored layer must be interned together with the layer itself
+    GraphicsLayerId id("top_GraphicsLayerIdTest");
+    EXPECT_TRUE(GraphicsLayerId::find("bot_GraphicsLayerIdTest").isValid());
+    EXPECT_EQ(QString("bot_GraphicsLayerIdTest"), id.getMirrored().getName());
+    EXPECT_EQ(id, id.getMirrored().getMirrored());
+}
+
+TEST_F(GraphicsLayerIdTest, testIsCopperLayer)
+{
+    EXPECT_TRUE(GraphicsLayerId(GraphicsLayer::sTopCopper).isCopperLayer());
+    EXPECT_TRUE(GraphicsLayerId(GraphicsLayer::getInnerLayerName(3)).isCopperLayer());
+    EXPECT_TRUE(GraphicsLayerId(GraphicsLayer::sBotCopper).isCopperLayer());
+    EXPECT_FALSE(GraphicsLayerId(GraphicsLayer::sBoardPadsTht).isCopperLayer());
+}
+
+TEST_F(GraphicsLayerIdTest, testGraphicsLayerId)
+{
+    GraphicsLayer layer(GraphicsLayer::sTopNames);
+    EXPECT_EQ(GraphicsLayerId(GraphicsLayer::sTopNames), layer.getId());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,239 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <iostream>
+#include <QtCore>
+#include <QtWidgets>
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicsview.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/common/gridproperties.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GraphicsViewTest : public ::testing::Test
+{
+    protected:
+
+        /**
+         * @brief Fill a scene with items similar to a large, dense board
+         *
+         * @return All added items (owned by the caller)
+         */
+        static QList<QGraphicsItem*> populateScene(GraphicsScene& scene, int count) noexcept
+        {
+            QList<QGraphicsItem*> items;
+            int columns = qCeil(qSqrt(count));
+            for (int i = 0; i < count; ++i) {
+                qreal x = (i % columns) * 20.0;
+                qreal y = (i / columns) * 20.0;
+                QGraphicsItem* item = nullptr;
+                if (i % 2) {
+                    // trace with some segments
+                    QPainterPath path(QPointF(x, y));
+                    path.lineTo(x + 10, y + 5);
+                    path.lineTo(x + 18, y + 5);
+                    QGraphicsPathItem* pathItem = new QGraphicsPathItem(path);
+                    pathItem->setPen(QPen(QColor(255, 0, 0, 150), 2.0, Qt::SolidLine,
+                                          Qt::RoundCap, Qt::RoundJoin));
+                    item = pathItem;
+                } else {
+                    // pad
+                    QGraphicsRectItem* rectItem = new QGraphicsRectItem(x, y, 6, 4);
+                    rectItem->setPen(Qt::NoPen);
+                    rectItem->setBrush(QColor(0, 0, 255, 150));
+                    item = rectItem;
+                }
+                scene.addItem(*item);
+                items.append(item);
+            }
+            return items;
+        }
+
+        /**
+         * @brief Run a scripted pan/zoom/highlight session and measure the repaint rate
+         *
+         * @return Processed frames per second
+         */
+        static qreal measureFramesPerSecond(GraphicsView& view,
+                                            const QList<QGraphicsItem*>& items) noexcept
+        {
+            view.zoomAll();
+            processEventsFor(1000); // wait for the zoom animation
+
+            QElapsedTimer timer;
+            timer.start();
+            int frames = 0;
+            // pan
+            for (int i = 0; i < 40; ++i, ++frames) {
+                view.horizontalScrollBar()->setValue(view.horizontalScrollBar()->value() + 15);
+                view.verticalScrollBar()->setValue(view.verticalScrollBar()->value() + 10);
+                processEventsFor(0);
+            }
+            // zoom
+            for (int i = 0; i < 20; ++i, ++frames) {
+                (i < 10) ? view.zoomIn() : view.zoomOut();
+                processEventsFor(0);
+            }
+            // highlight single items (like hovering over them)
+            for (int i = 0; i < 40; ++i, ++frames) {
+                items.at((i * 7919) % items.count())->update();
+                processEventsFor(0);
+            }
+            qreal fps = frames * 1000.0 / qMax(qint64(1), timer.elapsed());
+            return fps;
+        }
+
+        /**
+         * @brief Check if there is a non-background pixel within +/-1px of a position
+         */
+        static bool hasGridPixelAt(const QImage& image, const QPoint& pos) noexcept
+        {
+            for (int dx = -1; dx <= 1; ++dx) {
+                for (int dy = -1; dy <= 1; ++dy) {
+                    if (image.pixel(pos + QPoint(dx, dy)) != qRgb(0, 0, 0)) return true;
+                }
+            }
+            return false;
+        }
+
+        static void processEventsFor(int ms) noexcept
+        {
+            QElapsedTimer timer;
+            timer.start();
+            do {
+                QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+            } while (timer.elapsed() < ms);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GraphicsViewTest, testDefaultUpdateMode)
+{
+    GraphicsView view;
+    EXPECT_FALSE(view.getUseOpenGl());
+    EXPECT_EQ(QGraphicsView::SmartViewportUpdate, view.viewportUpdateMode());
+    EXPECT_TRUE(view.cacheMode().testFlag(QGraphicsView::CacheBackground));
+}
+
+TEST_F(GraphicsViewTest, testRasterUpdateMode)
+{
+    GraphicsView view;
+    view.setRasterViewportUpdateMode(QGraphicsView::BoundingRectViewportUpdate);
+    EXPECT_EQ(QGraphicsView::BoundingRectViewportUpdate, view.getRasterViewportUpdateMode());
+    EXPECT_EQ(QGraphicsView::BoundingRectViewportUpdate, view.viewportUpdateMode());
+}
+
+TEST_F(GraphicsViewTest, testOpenGlUsesFullViewportUpdate)
+{
+    GraphicsView view;
+    view.setUseOpenGl(true);
+    EXPECT_EQ(QGraphicsView::FullViewportUpdate, view.viewportUpdateMode());
+    EXPECT_FALSE(view.cacheMode().testFlag(QGraphicsView::CacheBackground));
+    view.setUseOpenGl(false);
+    EXPECT_EQ(QGraphicsView::SmartViewportUpdate, view.viewportUpdateMode());
+}
+
+TEST_F(GraphicsViewTest, testGridIsAlignedToSceneWhilePanning)
+{
+    GraphicsScene scene;
+    GraphicsView view;
+    view.resize(400, 300);
+    view.setBackgroundBrush(Qt::black);
+    view.setOriginCrossVisible(false);
+    view.setGridProperties(GridProperties(GridProperties::Type_t::Lines,
+                                          Length::fromMm(2.54), LengthUnit()));
+    view.setScene(&scene);
+    view.setTransform(QTransform::fromScale(4, 4));
+    qreal interval = Length::fromMm(2.54).toPx() * 4;
+    for (int pan = 0; pan < 3; ++pan) {
+        view.centerOn(QPointF(pan * 3.3, pan * 1.7));
+        QImage image = view.viewport()->grab().toImage();
+        QPoint origin = view.mapFromScene(QPointF(0, 0));
+        for (int i = -2; i <= 2; ++i) {
+            QPoint onLine(origin.x() + qRound(i * interval),
+                          origin.y() + qRound(0.5 * interval));
+            QPoint betweenLines(origin.x() + qRound((i + 0.5) * interval),
+                                origin.y() + qRound(0.5 * interval));
+            EXPECT_TRUE(hasGridPixelAt(image, onLine));
+            EXPECT_FALSE(hasGridPixelAt(image, betweenLines));
+        }
+    }
+}
+
+/**
+ * @brief Repaint rate benchmark (disabled by default since it takes some time)
+ *
+ * Run it with "--gtest_also_run_disabled_tests --gtest_filter=*benchmark*". To benchmark
+ * the OpenGL viewport on a headless machine, use Mesa's software renderer, e.g.
+ * "QT_QPA_PLATFORM=offscreen LIBGL_ALWAYS_SOFTWARE=1".
+ */
+TEST_F(GraphicsViewTest, DISABLED_benchmarkRepaintRate)
+{
+    GraphicsScene scene;
+    QList<QGraphicsItem*> items = populateScene(scene, 20000);
+
+    struct Config {const char* name; bool openGl; QGraphicsView::ViewportUpdateMode mode;};
+    QList<Config> configs = {
+        {"raster, full update",         false, QGraphicsView::FullViewportUpdate},
+        {"raster, bounding rect update",false, QGraphicsView::BoundingRectViewportUpdate},
+        {"raster, minimal update",      false, QGraphicsView::MinimalViewportUpdate},
+        {"raster, smart update",        false, QGraphicsView::SmartViewportUpdate},
+        {"opengl",                      true,  QGraphicsView::FullViewportUpdate},
+    };
+    foreach (const Config& config, configs) {
+        GraphicsView view;
+        view.resize(1280, 800);
+        view.setRasterViewportUpdateMode(config.mode);
+        view.setUseOpenGl(config.openGl);
+        view.setScene(&scene);
+        view.show();
+        qreal fps = measureFramesPerSecond(view, items);
+        std::cout << config.name << ": " << qRound(fps) << " fps" << std::endl;
+        RecordProperty(config.name, qRound(fps));
+        view.setScene(nullptr);
+    }
+
+    foreach (QGraphicsItem* item, items) {
+        scene.removeItem(*item);
+    }
+    qDeleteAll(items);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
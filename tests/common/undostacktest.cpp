@@ -0,0 +1,196 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/common/undocommand.h>
+#include <librepcb/common/fileio/cmd/cmdlistelementremove.h>
+#include "fileio/serializableobjectmock.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+/**
+ * @brief Command which sets an integer and pretends to hold some data
+ */
+class DummyCommand final : public UndoCommand
+{
+    public:
+        DummyCommand(int& value, int newValue, qint64 payload) noexcept :
+            UndoCommand("dummy"), mValue(value), mOldValue(value), mNewValue(newValue),
+            mPayload(payload) {}
+        qint64 getMemoryUsage() const noexcept override {
+            return UndoCommand::getMemoryUsage() + mPayload;
+        }
+    private:
+        bool performExecute() override {performRedo(); return true;}
+        void performUndo() override {mValue = mOldValue;}
+        void performRedo() override {mValue = mNewValue;}
+        int& mValue;
+        int mOldValue;
+        int mNewValue;
+        qint64 mPayload;
+};
+
+struct UndoStackTestTagName {static constexpr const char* tagname = "test";};
+using MockList = SerializableObjectList<SerializableObjectMock, UndoStackTestTagName>;
+using CmdMockRemove = CmdListElementRemove<SerializableObjectMock, UndoStackTestTagName>;
+
+class UndoStackTest : public ::testing::Test
+{
+    protected:
+        static qint64 usage(qint64 payload) noexcept {
+            int value = 0;
+            return DummyCommand(value, 0, payload).getMemoryUsage();
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(UndoStackTest, testMemoryUsage)
+{
+    int value = 0;
+    UndoStack stack;
+    EXPECT_EQ(0, stack.getMemoryUsage());
+    stack.execCmd(new DummyCommand(value, 1, 100));
+    stack.execCmd(new DummyCommand(value, 2, 200));
+    EXPECT_EQ(usage(100) + usage(200), stack.getMemoryUsage());
+    stack.undo();
+    EXPECT_EQ(usage(100) + usage(200), stack.getMemoryUsage()); // redo still possible
+    stack.execCmd(new DummyCommand(value, 3, 300));
+    EXPECT_EQ(usage(100) + usage(300), stack.getMemoryUsage());
+    stack.clear();
+    EXPECT_EQ(0, stack.getMemoryUsage());
+}
+
+TEST_F(UndoStackTest, testMemoryUsageOfAbortedCommandGroup)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.execCmd(new DummyCommand(value, 1, 100));
+    qint64 usageBefore = stack.getMemoryUsage();
+    stack.beginCmdGroup("group");
+    stack.appendToCmdGroup(new DummyCommand(value, 2, 1000));
+    EXPECT_GT(stack.getMemoryUsage(), usageBefore + 1000);
+    stack.abortCmdGroup();
+    EXPECT_EQ(usageBefore, stack.getMemoryUsage());
+    EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testUndoLimitDropsOldestCommands)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setUndoLimit(3);
+    for (int i = 1; i <= 5; ++i) {
+        stack.execCmd(new DummyCommand(value, i, 0));
+    }
+    EXPECT_EQ(3 * usage(0), stack.getMemoryUsage());
+    while (stack.canUndo()) stack.undo();
+    EXPECT_EQ(2, value);
+}
+
+TEST_F(UndoStackTest, testMemoryLimitKeepsNewestCommand)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setMemoryLimit(usage(1000) * 2);
+    stack.execCmd(new DummyCommand(value, 1, 1000));
+    stack.execCmd(new DummyCommand(value, 2, 1000));
+    EXPECT_EQ(usage(1000) * 2, stack.getMemoryUsage());
+    stack.execCmd(new DummyCommand(value, 3, 5000));
+    EXPECT_EQ(usage(5000), stack.getMemoryUsage());
+    EXPECT_TRUE(stack.canUndo());
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_EQ(2, value);
+}
+
+TEST_F(UndoStackTest, testDroppingCommandsMovesCleanState)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setUndoLimit(2);
+    stack.execCmd(new DummyCommand(value, 1, 0));
+    stack.setClean();
+    stack.execCmd(new DummyCommand(value, 2, 0));
+    stack.execCmd(new DummyCommand(value, 3, 0));
+    EXPECT_FALSE(stack.isClean());
+    while (stack.canUndo()) stack.undo();
+    EXPECT_TRUE(stack.isClean());
+    EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testDroppingCleanStateMakesItUnreachable)
+{
+    int value = 0;
+    UndoStack stack;
+    stack.setUndoLimit(2);
+    EXPECT_TRUE(stack.isClean());
+    stack.execCmd(new DummyCommand(value, 1, 0));
+    stack.execCmd(new DummyCommand(value, 2, 0));
+    stack.execCmd(new DummyCommand(value, 3, 0));
+    while (stack.canUndo()) stack.undo();
+    EXPECT_FALSE(stack.isClean());
+    EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testMemoryLimitDropsCommandsHoldingRemovedObjects)
+{
+    MockList list;
+    for (int i = 0; i < 4; ++i) {
+        list.append(std::make_shared<SerializableObjectMock>(Uuid::createRandom(),
+                                                             QString(10000, 'x')));
+    }
+    UndoStack stack;
+    stack.execCmd(new CmdMockRemove(list, list.value(0).get()));
+    qint64 usagePerCmd = stack.getMemoryUsage(); // all elements have the same size
+    EXPECT_GT(usagePerCmd, qint64(10000 * sizeof(QChar)));
+
+    // only the two newest commands fit into the limit
+    stack.setMemoryLimit(usagePerCmd * 2);
+    stack.execCmd(new CmdMockRemove(list, list.value(0).get()));
+    stack.execCmd(new CmdMockRemove(list, list.value(0).get()));
+    EXPECT_EQ(usagePerCmd * 2, stack.getMemoryUsage());
+    EXPECT_EQ(1, list.count());
+    stack.undo();
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_EQ(3, list.count());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
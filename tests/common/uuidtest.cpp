@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 
+#include <iostream>
 #include <QtCore>
 #include <gtest/gtest.h>
 #include <librepcb/common/uuid.h>
@@ -217,6 +218,84 @@ TEST(UuidTest, testCreateRandom)
     }
 }
 
+TEST(UuidTest, testHashLookup)
+{
+    QHash<Uuid, int> hash;
+    QList<Uuid> uuids;
+    for (int i = 0; i < 1000; i++) {
+        uuids.append(Uuid::createRandom());
+        hash.insert(uuids.last(), i);
+    }
+    for (int i = 0; i < uuids.count(); i++) {
+        EXPECT_EQ(i, hash.value(Uuid(uuids.at(i).toStr()), -1));
+    }
+    EXPECT_FALSE(hash.contains(Uuid()));
+}
+
+/**
+ * @brief Compare the previous string based UUID representation with the current one
+ *
+ * Uses as many UUIDs as a large project contains (library elements, components, devices,
+ * net signals, net segments, ...). The disabled test can be run with
+ * "--gtest_also_run_disabled_tests --gtest_filter=*benchmark*".
+ */
+TEST(UuidTest, DISABLED_benchmarkMemoryAndHashLookup)
+{
+    const int count = 200000;
+    QStringList strings;
+    for (int i = 0; i < count; i++) {
+        strings.append(Uuid::createRandom().toStr());
+    }
+
+    // memory (the string representation needs a heap allocated buffer for 36 characters)
+    qint64 stringBytes = count * (sizeof(QString) + sizeof(QArrayData) + 37 * sizeof(QChar));
+    qint64 uuidBytes = count * sizeof(Uuid);
+    std::cout << "memory as QString: " << stringBytes / 1024 << " kB" << std::endl;
+    std::cout << "memory as Uuid: " << uuidBytes / 1024 << " kB" << std::endl;
+    RecordProperty("memory_qstring_kb", int(stringBytes / 1024));
+    RecordProperty("memory_uuid_kb", int(uuidBytes / 1024));
+
+    // parsing
+    QElapsedTimer timer;
+    timer.start();
+    QVector<Uuid> uuids;
+    uuids.reserve(count);
+    foreach (const QString& str, strings) {
+        uuids.append(Uuid(str));
+    }
+    qint64 parseMs = timer.elapsed();
+    std::cout << "parse: " << parseMs << " ms" << std::endl;
+    RecordProperty("parse_ms", int(parseMs));
+
+    // hash lookups
+    QHash<QString, int> stringHash;
+    QHash<Uuid, int> uuidHash;
+    for (int i = 0; i < count; i++) {
+        stringHash.insert(strings.at(i), i);
+        uuidHash.insert(uuids.at(i), i);
+    }
+    qint64 sum = 0;
+    timer.restart();
+    for (int round = 0; round < 10; round++) {
+        foreach (const QString& str, strings) {
+            sum += stringHash.value(str);
+        }
+    }
+    qint64 stringLookupMs = timer.elapsed();
+    timer.restart();
+    for (int round = 0; round < 10; round++) {
+        foreach (const Uuid& uuid, uuids) {
+            sum -= uuidHash.value(uuid);
+        }
+    }
+    qint64 uuidLookupMs = timer.elapsed();
+    EXPECT_EQ(0, sum);
+    std::cout << "10x lookup with QString keys: " << stringLookupMs << " ms" << std::endl;
+    std::cout << "10x lookup with Uuid keys: " << uuidLookupMs << " ms" << std::endl;
+    RecordProperty("lookup_qstring_ms", int(stringLookupMs));
+    RecordProperty("lookup_uuid_ms", int(uuidLookupMs));
+}
+
 /*****************************************************************************************
  *  Test Data
  ****************************************************************************************/
@@ -0,0 +1,132 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <parseagle/library.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <EagleImport/batchconverter.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BatchConverterTest : public ::testing::Test
+{
+    protected:
+        FilePath mTempDir;
+        FilePath mOutputDir;
+        FilePath mEagleLibFp;
+
+        BatchConverterTest() : mTempDir(FilePath::getRandomTempPath()) {
+            QDir().mkpath(mTempDir.toStr());
+            mOutputDir = mTempDir.getPathTo("output");
+            mEagleLibFp = FilePath(TEST_DATA_DIR).getPathTo("eagleimport/resistor.lbr");
+        }
+
+        virtual ~BatchConverterTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
+
+        FilePath copyEagleLibrary(const QString& relPath) {
+            FilePath fp = mTempDir.getPathTo(relPath);
+            FileUtils::makePath(fp.getParentDir()); // can throw
+            FileUtils::copyFile(mEagleLibFp, fp); // can throw
+            return fp;
+        }
+
+        int countOutputElements(const QString& subdir) const noexcept {
+            QDir dir(mOutputDir.getPathTo(subdir).toStr());
+            return dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot).count();
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BatchConverterTest, testConversion)
+{
+    parseagle::Library eagleLibrary(mEagleLibFp.toStr());
+    int elementsPerLibrary = eagleLibrary.getSymbols().count()
+                             + eagleLibrary.getPackages().count()
+                             + eagleLibrary.getDeviceSets().count();
+    ASSERT_GT(elementsPerLibrary, 0);
+
+    // load converter database
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    db.importIniFile(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
+
+    // convert two different libraries and one with an already used file name
+    QList<FilePath> files;
+    files.append(copyEagleLibrary("a/resistor.lbr"));
+    files.append(copyEagleLibrary("b/resistor2.lbr"));
+    files.append(copyEagleLibrary("b/resistor.lbr"));
+    BatchConverter converter(db, mOutputDir);
+    converter.setMaxThreadCount(2);
+    converter.convert(files);
+
+    // only the duplicate file name is reported, all other elements are written
+    QStringList errors = converter.getErrors();
+    ASSERT_EQ(1, errors.count());
+    EXPECT_TRUE(errors.first().contains(files.at(2).toNative()));
+    EXPECT_EQ(2 * elementsPerLibrary, converter.getReadElementsCount());
+    EXPECT_EQ(2 * eagleLibrary.getSymbols().count(), countOutputElements("sym"));
+    EXPECT_EQ(2 * eagleLibrary.getPackages().count(), countOutputElements("pkg"));
+    EXPECT_EQ(converter.getWrittenElementsCount(),
+              countOutputElements("sym") + countOutputElements("pkg") +
+              countOutputElements("cmp") + countOutputElements("dev"));
+}
+
+TEST_F(BatchConverterTest, testErrorsDoNotAbortConversion)
+{
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    db.importIniFile(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
+
+    QList<FilePath> files;
+    files.append(mTempDir.getPathTo("nonexistent.lbr"));
+    files.append(copyEagleLibrary("resistor.lbr"));
+    BatchConverter converter(db, mOutputDir);
+    converter.setMaxThreadCount(2);
+    converter.convert(files);
+
+    QStringList errors = converter.getErrors();
+    ASSERT_EQ(1, errors.count());
+    EXPECT_TRUE(errors.first().contains(files.at(0).toNative()));
+    EXPECT_GT(converter.getWrittenElementsCount(), 0);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace eagleimport
+} // namespace librepcb
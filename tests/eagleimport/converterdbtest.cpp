@@ -0,0 +1,275 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <iostream>
+#include <QtCore>
+#include <QtXml>
+#include <QtConcurrent>
+#include <gtest/gtest.h>
+#include <parseagle/library.h>
+#include <librepcb/eagleimport/converterdb.h>
+#include <librepcb/eagleimport/symbolconverter.h>
+#include <librepcb/eagleimport/packageconverter.h>
+#include <librepcb/eagleimport/devicesetconverter.h>
+#include <librepcb/eagleimport/deviceconverter.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/library/dev/device.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace eagleimport {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class ConverterDbTest : public ::testing::Test
+{
+    protected:
+        FilePath mTempDir;
+        FilePath mDbFilePath;
+
+        ConverterDbTest() : mTempDir(FilePath::getRandomTempPath()) {
+            QDir().mkpath(mTempDir.toStr());
+            mDbFilePath = mTempDir.getPathTo("db.sqlite");
+        }
+
+        virtual ~ConverterDbTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
+
+        /**
+         * @brief Create a large library by duplicating all elements of resistor.lbr
+         *
+         * @return The number of elements (symbols, packages and device sets)
+         */
+        static int createLargeLibrary(const FilePath& fp, int copies) {
+            QFile input(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/resistor.lbr").toStr());
+            if (!input.open(QIODevice::ReadOnly)) return 0;
+            QDomDocument doc;
+            if (!doc.setContent(&input)) return 0;
+            QDomElement library = doc.documentElement().firstChildElement("drawing")
+                                                       .firstChildElement("library");
+            int count = 0;
+            foreach (const QString& listName, QStringList{"symbols", "packages", "devicesets"}) {
+                QDomElement list = library.firstChildElement(listName);
+                QList<QDomElement> originals;
+                for (QDomElement e = list.firstChildElement(); !e.isNull();
+                     e = e.nextSiblingElement()) {
+                    originals.append(e);
+                }
+                for (int i = 1; i < copies; ++i) {
+                    QString suffix = QString("_%1").arg(i);
+                    foreach (const QDomElement& original, originals) {
+                        QDomElement copy = original.cloneNode(true).toElement();
+                        copy.setAttribute("name", copy.attribute("name") % suffix);
+                        QDomNodeList gates = copy.elementsByTagName("gate");
+                        for (int k = 0; k < gates.count(); ++k) {
+                            QDomElement gate = gates.at(k).toElement();
+                            gate.setAttribute("symbol", gate.attribute("symbol") % suffix);
+                        }
+                        QDomNodeList devices = copy.elementsByTagName("device");
+                        for (int k = 0; k < devices.count(); ++k) {
+                            QDomElement device = devices.at(k).toElement();
+                            if (device.hasAttribute("package")) {
+                                device.setAttribute("package",
+                                                    device.attribute("package") % suffix);
+                            }
+                        }
+                        list.appendChild(copy);
+                    }
+                }
+                count += originals.count() * copies;
+            }
+            QFile output(fp.toStr());
+            if (!output.open(QIODevice::WriteOnly)) return 0;
+            output.write(doc.toByteArray());
+            return count;
+        }
+
+        static void convertLibrary(const parseagle::Library& library, ConverterDb& db) {
+            foreach (const parseagle::Symbol& symbol, library.getSymbols()) {
+                SymbolConverter(symbol, db).generate();
+            }
+            foreach (const parseagle::Package& package, library.getPackages()) {
+                PackageConverter(package, db).generate();
+            }
+            foreach (const parseagle::DeviceSet& deviceSet, library.getDeviceSets()) {
+                DeviceSetConverter(deviceSet, db).generate();
+                foreach (const parseagle::Device& device, deviceSet.getDevices()) {
+                    DeviceConverter(deviceSet, device, db).generate();
+                }
+            }
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(ConverterDbTest, testUuidsAreStable)
+{
+    Uuid symbolUuid;
+    Uuid pinUuid;
+    {
+        ConverterDb db(mDbFilePath);
+        db.setCurrentLibraryFilePath(FilePath("/libs/foo.lbr"));
+        symbolUuid = db.getSymbolUuid("R");
+        pinUuid = db.getSymbolPinUuid(symbolUuid, "1");
+        EXPECT_FALSE(symbolUuid.isNull());
+        EXPECT_FALSE(pinUuid.isNull());
+        EXPECT_NE(symbolUuid, pinUuid);
+        EXPECT_EQ(symbolUuid, db.getSymbolUuid("R"));
+        EXPECT_NE(symbolUuid, db.getSymbolUuid("C"));
+        db.setCurrentLibraryFilePath(FilePath("/libs/bar.lbr"));
+        EXPECT_NE(symbolUuid, db.getSymbolUuid("R"));
+    } // destructor writes the database
+
+    ConverterDb db(mDbFilePath);
+    db.setCurrentLibraryFilePath(FilePath("/libs/foo.lbr"));
+    EXPECT_EQ(symbolUuid, db.getSymbolUuid("R"));
+    EXPECT_EQ(pinUuid, db.getSymbolPinUuid(symbolUuid, "1"));
+}
+
+TEST_F(ConverterDbTest, testKeysAreEscapedLikeInIniFiles)
+{
+    ConverterDb db(mDbFilePath);
+    db.setCurrentLibraryFilePath(FilePath("/libs/my lib.lbr"));
+    db.getSymbolUuid(QString::fromUtf8("R{1}/\xC3\xA4"));
+    EXPECT_EQ(QStringList{"symbols/my_lib.lbr_R1__U2F____UE4___"}, db.getAllKeys());
+}
+
+TEST_F(ConverterDbTest, testImportIniFile)
+{
+    FilePath iniFilePath = mTempDir.getPathTo("db.ini");
+    Uuid uuid = Uuid::createRandom();
+    {
+        QSettings ini(iniFilePath.toStr(), QSettings::IniFormat);
+        ini.setValue("symbols/foo.lbr_R_", uuid.toStr());
+        ini.setValue("packages_to_packages/foo.lbr_0603_", Uuid::createRandom().toStr());
+    }
+
+    {
+        ConverterDb db(mDbFilePath);
+        EXPECT_EQ(2, db.importIniFile(iniFilePath));
+        EXPECT_EQ(0, db.importIniFile(iniFilePath)); // already imported
+    }
+
+    ConverterDb db(mDbFilePath);
+    db.setCurrentLibraryFilePath(FilePath("/libs/foo.lbr"));
+    EXPECT_EQ(uuid, db.getSymbolUuid("R"));
+    EXPECT_EQ(2, db.getAllKeys().count());
+}
+
+TEST_F(ConverterDbTest, testImportInvalidIniFile)
+{
+    FilePath iniFilePath = mTempDir.getPathTo("db.ini");
+    {
+        QSettings ini(iniFilePath.toStr(), QSettings::IniFormat);
+        ini.setValue("symbols/foo.lbr_R_", Uuid::createRandom().toStr());
+        ini.setValue("symbols/foo.lbr_C_", "invalid");
+    }
+
+    ConverterDb db(mDbFilePath);
+    EXPECT_THROW(db.importIniFile(iniFilePath), Exception);
+    EXPECT_THROW(db.importIniFile(mTempDir.getPathTo("nonexistent.ini")), Exception);
+    EXPECT_TRUE(db.getAllKeys().isEmpty());
+}
+
+TEST_F(ConverterDbTest, testViewsShareUuidsBetweenThreads)
+{
+    QList<QFuture<Uuid>> futures;
+    {
+        ConverterDb db(mDbFilePath);
+        for (int i = 0; i < 8; ++i) {
+            FilePath lbrFilePath(QString("/libs/lib%1.lbr").arg(i % 2));
+            futures.append(QtConcurrent::run([&db, lbrFilePath]() {
+                ConverterDb view(db, lbrFilePath);
+                for (int k = 0; k < 100; ++k) {
+                    view.getSymbolUuid(QString::number(k));
+                }
+                return view.getSymbolUuid("R");
+            }));
+        }
+        for (int i = 0; i < futures.count(); ++i) {
+            EXPECT_EQ(futures.at(i % 2).result(), futures.at(i).result());
+        }
+        EXPECT_NE(futures.at(0).result(), futures.at(1).result());
+        EXPECT_EQ(2 * 101, db.getAllKeys().count());
+    } // destructor writes the mappings created by the views
+
+    ConverterDb db(mDbFilePath);
+    db.setCurrentLibraryFilePath(FilePath("/libs/lib1.lbr"));
+    EXPECT_EQ(futures.at(1).result(), db.getSymbolUuid("R"));
+}
+
+/**
+ * @brief Benchmark converting a library with thousands of elements
+ *
+ * Run it with "--gtest_also_run_disabled_tests --gtest_filter=*benchmark*".
+ */
+TEST_F(ConverterDbTest, DISABLED_benchmarkConvertLargeLibrary)
+{
+    FilePath lbrFilePath = mTempDir.getPathTo("large.lbr");
+    int count = createLargeLibrary(lbrFilePath, 2000);
+    ASSERT_GT(count, 0);
+    parseagle::Library library(lbrFilePath.toStr());
+
+    QElapsedTimer timer;
+    timer.start();
+    {
+        ConverterDb db(mDbFilePath);
+        db.setCurrentLibraryFilePath(lbrFilePath);
+        convertLibrary(library, db); // creates all UUIDs
+        qint64 convertTime = timer.restart();
+        db.flush();
+        qint64 flushTime = timer.restart();
+        std::cout << "convert " << count << " new elements: " << convertTime << " ms" << std::endl;
+        std::cout << "write database: " << flushTime << " ms" << std::endl;
+        RecordProperty("convert_new_ms", convertTime);
+        RecordProperty("flush_ms", flushTime);
+    }
+
+    timer.restart();
+    ConverterDb db(mDbFilePath);
+    db.setCurrentLibraryFilePath(lbrFilePath);
+    qint64 loadTime = timer.restart();
+    convertLibrary(library, db); // all UUIDs exist already
+    qint64 convertTime = timer.restart();
+    std::cout << "load database: " << loadTime << " ms" << std::endl;
+    std::cout << "convert " << count << " existing elements: " << convertTime << " ms" << std::endl;
+    RecordProperty("load_ms", loadTime);
+    RecordProperty("convert_existing_ms", convertTime);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace eagleimport
+} // namespace librepcb
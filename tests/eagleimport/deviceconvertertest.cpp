@@ -40,6 +40,16 @@ namespace tests {
 
 class DeviceConverterTest : public ::testing::Test
 {
+    protected:
+        FilePath mTempDir;
+
+        DeviceConverterTest() : mTempDir(FilePath::getRandomTempPath()) {
+            QDir().mkpath(mTempDir.toStr());
+        }
+
+        virtual ~DeviceConverterTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
 };
 
 /*****************************************************************************************
@@ -57,7 +67,8 @@ TEST_F(DeviceConverterTest, testConversion)
     const parseagle::Device& eagleDevice = eagleDeviceSet.getDevices().first();
 
     // load converter database
-    ConverterDb db(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    db.importIniFile(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
 
     // convert device set
     DeviceConverter converter(eagleDeviceSet, eagleDevice, db);
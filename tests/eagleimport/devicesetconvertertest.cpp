@@ -40,6 +40,16 @@ namespace tests {
 
 class DeviceSetConverterTest : public ::testing::Test
 {
+    protected:
+        FilePath mTempDir;
+
+        DeviceSetConverterTest() : mTempDir(FilePath::getRandomTempPath()) {
+            QDir().mkpath(mTempDir.toStr());
+        }
+
+        virtual ~DeviceSetConverterTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
 };
 
 /*****************************************************************************************
@@ -55,7 +65,8 @@ TEST_F(DeviceSetConverterTest, testConversion)
     const parseagle::DeviceSet& eagleDeviceSet = eagleLibrary.getDeviceSets().first();
 
     // load converter database
-    ConverterDb db(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    db.importIniFile(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
 
     // convert device set
     DeviceSetConverter converter(eagleDeviceSet, db);
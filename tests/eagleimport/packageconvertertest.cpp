@@ -40,6 +40,16 @@ namespace tests {
 
 class PackageConverterTest : public ::testing::Test
 {
+    protected:
+        FilePath mTempDir;
+
+        PackageConverterTest() : mTempDir(FilePath::getRandomTempPath()) {
+            QDir().mkpath(mTempDir.toStr());
+        }
+
+        virtual ~PackageConverterTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
 };
 
 /*****************************************************************************************
@@ -55,7 +65,8 @@ TEST_F(PackageConverterTest, testConversion)
     const parseagle::Package& eaglePackage = eagleLibrary.getPackages().first();
 
     // load converter database
-    ConverterDb db(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    db.importIniFile(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
 
     // convert package
     PackageConverter converter(eaglePackage, db);
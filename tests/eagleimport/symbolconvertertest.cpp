@@ -40,6 +40,16 @@ namespace tests {
 
 class SymbolConverterTest : public ::testing::Test
 {
+    protected:
+        FilePath mTempDir;
+
+        SymbolConverterTest() : mTempDir(FilePath::getRandomTempPath()) {
+            QDir().mkpath(mTempDir.toStr());
+        }
+
+        virtual ~SymbolConverterTest() {
+            QDir(mTempDir.toStr()).removeRecursively();
+        }
 };
 
 /*****************************************************************************************
@@ -55,7 +65,8 @@ TEST_F(SymbolConverterTest, testConversion)
     const parseagle::Symbol& eagleSymbol = eagleLibrary.getSymbols().first();
 
     // load converter database
-    ConverterDb db(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
+    ConverterDb db(mTempDir.getPathTo("db.sqlite"));
+    db.importIniFile(FilePath(TEST_DATA_DIR).getPathTo("eagleimport/db.ini"));
 
     // convert symbol
     SymbolConverter converter(eagleSymbol, db);
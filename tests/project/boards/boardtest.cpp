@@ -0,0 +1,418 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <iostream>
+#include <QtCore>
+#include <QtWidgets>
+#include <gtest/gtest.h>
+#include <librepcb/common/geometry/path.h>
+#include <librepcb/common/geometry/text.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/common/undocommandgroup.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/cmd/cmdboardnetpointedit.h>
+#include <librepcb/project/boards/graphicsitems/bgi_plane.h>
+#include <librepcb/project/boards/items/bi_device.h>
+#include <librepcb/project/boards/items/bi_footprint.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/componentinstance.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/library/projectlibrary.h>
+#include "../temporaryprojecttest.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BoardTest : public TemporaryProjectTest
+{
+    protected:
+        Board* mBoard;
+
+        BoardTest() : mBoard(mProject->createBoard("board")) {
+            mProject->addBoard(*mBoard);
+        }
+
+        /**
+         * @brief Add a grid of 1x1mm filled polygons with a pitch of 2mm
+         *
+         * @return All added polygons, row by row
+         */
+        QList<BI_Polygon*> addPolygons(int columns, int rows) {
+            QList<BI_Polygon*> polygons;
+            for (int y = 0; y < rows; ++y) {
+                for (int x = 0; x < columns; ++x) {
+                    Point p1(Length::fromMm(x * 2), Length::fromMm(y * 2));
+                    Point p2 = p1 + Point::fromMm(1, 1);
+                    BI_Polygon* polygon = new BI_Polygon(*mBoard, Uuid::createRandom(),
+                        GraphicsLayer::sTopPlacement, Length::fromMm(0.1), true, true,
+                        Path::rect(p1, p2));
+                    mBoard->addPolygon(*polygon);
+                    polygons.append(polygon);
+                }
+            }
+            return polygons;
+        }
+
+        /**
+         * @brief Add a net segment with unconnected netpoints in a row with 1mm pitch
+         */
+        QList<BI_NetPoint*> addNetPoints(int count) {
+            Circuit& circuit = mProject->getCircuit();
+            NetClass* netclass = new NetClass(circuit, "test");
+            circuit.addNetClass(*netclass);
+            NetSignal* netsignal = new NetSignal(circuit, *netclass, "net", false);
+            circuit.addNetSignal(*netsignal);
+            BI_NetSegment* netsegment = new BI_NetSegment(*mBoard, *netsignal);
+            mBoard->addNetSegment(*netsegment);
+            BoardLayerStack& layers = mBoard->getLayerStack();
+            GraphicsLayer* layer = layers.getLayer(GraphicsLayer::sTopCopper);
+            QList<BI_NetPoint*> netpoints;
+            for (int i = 0; i < count; ++i) {
+                netpoints.append(new BI_NetPoint(*netsegment, *layer,
+                                                 Point(Length::fromMm(i), Length(0))));
+            }
+            netsegment->addElements({}, netpoints, {});
+            return netpoints;
+        }
+
+        /**
+         * @brief Add a device whose footprint contains only a single text
+         */
+        BI_Device* addDevice(const QString& text) {
+            library::Component* cmp = new library::Component(Uuid::createRandom(),
+                Version("0.1"), "test", "component", "", "");
+            cmp->getSymbolVariants().append(
+                std::make_shared<library::ComponentSymbolVariant>(Uuid::createRandom(),
+                                                                  "", "default", ""));
+            library::Package* pkg = new library::Package(Uuid::createRandom(),
+                Version("0.1"), "test", "package", "", "");
+            std::shared_ptr<library::Footprint> footprint =
+                std::make_shared<library::Footprint>(Uuid::createRandom(), "default", "");
+            footprint->getTexts().append(std::make_shared<Text>(Uuid::createRandom(),
+                GraphicsLayer::sTopNames, text, Point(), Angle(), Length::fromMm(1),
+                Alignment(HAlign::left(), VAlign::bottom())));
+            pkg->getFootprints().append(footprint);
+            library::Device* dev = new library::Device(Uuid::createRandom(),
+                Version("0.1"), "test", "device", "", "");
+            dev->setComponentUuid(cmp->getUuid());
+            dev->setPackageUuid(pkg->getUuid());
+            ProjectLibrary& library = mProject->getLibrary();
+            library.addComponent(*cmp);
+            library.addPackage(*pkg);
+            library.addDevice(*dev);
+
+            Circuit& circuit = mProject->getCircuit();
+            ComponentInstance* cmpInstance = new ComponentInstance(circuit, *cmp,
+                cmp->getSymbolVariants().first()->getUuid(), "R1");
+            circuit.addComponentInstance(*cmpInstance);
+            BI_Device* device = new BI_Device(*mBoard, *cmpInstance, dev->getUuid(),
+                footprint->getUuid(), Point(), Angle(), false);
+            mBoard->addDeviceInstance(*device);
+            return device;
+        }
+
+        static QList<bool> getSelectionStates(const QList<BI_Polygon*>& polygons) {
+            QList<bool> states;
+            foreach (const BI_Polygon* polygon, polygons) {
+                states.append(polygon->isSelected());
+            }
+            return states;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BoardTest, testSelectionRect)
+{
+    QList<BI_Polygon*> polygons = addPolygons(3, 1);
+    polygons.first()->setSelected(true); // must be deselected by the selection rect
+
+    // select the middle polygon
+    mBoard->setSelectionRect(Point::fromMm(1.5, 0.2), Point::fromMm(3.5, 0.8), true);
+    EXPECT_EQ((QList<bool>{false, true, false}), getSelectionStates(polygons));
+
+    // enlarge the rect (in the opposite direction)
+    mBoard->setSelectionRect(Point::fromMm(5.5, 0.8), Point::fromMm(1.5, 0.2), true);
+    EXPECT_EQ((QList<bool>{false, true, true}), getSelectionStates(polygons));
+
+    // shrink the rect
+    mBoard->setSelectionRect(Point::fromMm(3.5, 0.2), Point::fromMm(5.5, 0.8), true);
+    EXPECT_EQ((QList<bool>{false, false, true}), getSelectionStates(polygons));
+
+    // release the rect, the selection must be kept
+    mBoard->setSelectionRect(Point(), Point(), false);
+    EXPECT_EQ((QList<bool>{false, false, true}), getSelectionStates(polygons));
+
+    // a new rect replaces the previous selection
+    mBoard->setSelectionRect(Point::fromMm(0.2, 0.2), Point::fromMm(0.8, 0.8), true);
+    EXPECT_EQ((QList<bool>{true, false, false}), getSelectionStates(polygons));
+}
+
+TEST_F(BoardTest, testSelectionRectWithRemovedItem)
+{
+    QList<BI_Polygon*> polygons = addPolygons(2, 1);
+    mBoard->setSelectionRect(Point::fromMm(0, 0), Point::fromMm(4, 1), true);
+    EXPECT_EQ((QList<bool>{true, true}), getSelectionStates(polygons));
+
+    // the removed item must not be accessed by the next update of the selection rect
+    mBoard->removePolygon(*polygons.last());
+    delete polygons.takeLast();
+    mBoard->setSelectionRect(Point::fromMm(4.5, 0), Point::fromMm(5, 1), true);
+    EXPECT_EQ((QList<bool>{false}), getSelectionStates(polygons));
+}
+
+TEST_F(BoardTest, testGraphicsSceneIsBuiltOnDemand)
+{
+    QList<BI_Polygon*> polygons = addPolygons(2, 1);
+    EXPECT_FALSE(mBoard->isGraphicsSceneBuilt());
+    int emptySceneItems = GraphicsScene().items().count();
+
+    // building the scene creates the graphics items of all board items
+    GraphicsScene& scene = mBoard->getGraphicsScene();
+    EXPECT_TRUE(mBoard->isGraphicsSceneBuilt());
+    int itemsPerPolygon = (scene.items().count() - emptySceneItems) / 2;
+    EXPECT_GT(itemsPerPolygon, 0);
+
+    // the graphics items of removed board items are destroyed immediately
+    mBoard->removePolygon(*polygons.last());
+    delete polygons.takeLast();
+    EXPECT_EQ(emptySceneItems + itemsPerPolygon, scene.items().count());
+
+    // releasing the scene destroys all graphics items, they are rebuilt on demand
+    mBoard->releaseGraphicsScene();
+    EXPECT_FALSE(mBoard->isGraphicsSceneBuilt());
+    addPolygons(1, 1);
+    EXPECT_FALSE(mBoard->isGraphicsSceneBuilt());
+    EXPECT_EQ(emptySceneItems + 2 * itemsPerPolygon,
+              mBoard->getGraphicsScene().items().count());
+}
+
+TEST_F(BoardTest, testHitTestingWithoutGraphicsScene)
+{
+    BI_Polygon* polygon = addPolygons(1, 1).first();
+    QList<BI_NetPoint*> netpoints = addNetPoints(2);
+    BI_NetLine* netline = new BI_NetLine(*netpoints[0], *netpoints[1],
+                                         Length::fromMm(0.5));
+    netpoints[0]->getNetSegment().addElements({}, {}, {netline});
+    EXPECT_FALSE(mBoard->isGraphicsSceneBuilt());
+
+    // hit testing must not depend on whether the board was shown before
+    EXPECT_EQ(QList<BI_NetPoint*>{netpoints[0]},
+              mBoard->getNetPointsAtScenePos(Point(), nullptr, nullptr));
+    EXPECT_EQ(QList<BI_NetLine*>{netline},
+              mBoard->getNetLinesAtScenePos(Point::fromMm(0.5, 0), nullptr, nullptr));
+    mBoard->releaseGraphicsScene();
+    EXPECT_TRUE(mBoard->getItemsAtScenePos(Point::fromMm(0.5, 0.5)).contains(polygon));
+    mBoard->releaseGraphicsScene();
+    EXPECT_TRUE(netline->isSelectable());
+    EXPECT_FALSE(polygon->getGrabAreaScenePx().isEmpty());
+}
+
+TEST_F(BoardTest, testConsecutiveNetPointEditsAreMerged)
+{
+    BI_NetPoint* netpoint = addNetPoints(1).first();
+    UndoStack stack;
+
+    // drag the netpoint around, each step is executed as a separate command
+    for (int i = 1; i <= 10; ++i) {
+        CmdBoardNetPointEdit* cmd = new CmdBoardNetPointEdit(*netpoint);
+        cmd->setPosition(Point::fromMm(0, i), true);
+        stack.execCmd(cmd);
+    }
+    EXPECT_EQ(Point::fromMm(0, 10), netpoint->getPosition());
+
+    // all edits must be reverted with a single undo step
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_EQ(Point::fromMm(0, 0), netpoint->getPosition());
+    stack.redo();
+    EXPECT_EQ(Point::fromMm(0, 10), netpoint->getPosition());
+}
+
+TEST_F(BoardTest, testConsecutiveNetPointGroupEditsAreMerged)
+{
+    QList<BI_NetPoint*> netpoints = addNetPoints(3);
+    UndoStack stack;
+
+    // move the first two netpoints several times (like the "move" command does)
+    for (int i = 1; i <= 5; ++i) {
+        UndoCommandGroup* group = new UndoCommandGroup("move");
+        for (int k = 0; k < 2; ++k) {
+            CmdBoardNetPointEdit* cmd = new CmdBoardNetPointEdit(*netpoints[k]);
+            cmd->setDeltaToStartPos(Point::fromMm(0, 1), false);
+            group->appendChild(cmd);
+        }
+        stack.execCmd(group);
+    }
+    EXPECT_EQ(Point::fromMm(1, 5), netpoints[1]->getPosition());
+
+    // moving another netpoint must not be merged into the previous command
+    UndoCommandGroup* group = new UndoCommandGroup("move");
+    for (int k = 2; k > 0; --k) {
+        CmdBoardNetPointEdit* cmd = new CmdBoardNetPointEdit(*netpoints[k]);
+        cmd->setDeltaToStartPos(Point::fromMm(0, 1), false);
+        group->appendChild(cmd);
+    }
+    stack.execCmd(group);
+    EXPECT_EQ(Point::fromMm(1, 6), netpoints[1]->getPosition());
+
+    stack.undo();
+    EXPECT_EQ(Point::fromMm(2, 0), netpoints[2]->getPosition());
+    EXPECT_EQ(Point::fromMm(1, 5), netpoints[1]->getPosition());
+    stack.undo();
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_EQ(Point::fromMm(0, 0), netpoints[0]->getPosition());
+    EXPECT_EQ(Point::fromMm(1, 0), netpoints[1]->getPosition());
+}
+
+/**
+ * @brief Selection rect benchmark (disabled by default since it takes some time)
+ *
+ * Run it with "--gtest_also_run_disabled_tests --gtest_filter=*benchmark*".
+ */
+TEST_F(BoardTest, testFootprintTextPathsAreKeptIfUnaffected)
+{
+    BI_Device* device = addDevice("#NAME");
+    BI_Footprint& footprint = device->getFootprint();
+    const Text& text = *footprint.getLibFootprint().getTexts().first();
+    QVector<Path> paths = footprint.getTextPaths(text);
+    ASSERT_FALSE(paths.isEmpty());
+
+    // moving the device or changing other attributes must not lay out the text again
+    device->setPosition(Point::fromMm(10, 10));
+    Board* board = mProject->createBoard("board2");
+    mProject->addBoard(*board); // changes the attributes of the project
+    EXPECT_EQ(paths.constData(), footprint.getTextPaths(text).constData());
+
+    // changing the substituted attribute lays out the text again
+    device->getComponentInstance().setName("R2");
+    emit mProject->attributesChanged(); // not yet forwarded to the board by the circuit
+    QVector<Path> newPaths = footprint.getTextPaths(text);
+    EXPECT_NE(paths.constData(), newPaths.constData());
+    EXPECT_NE(paths, newPaths);
+}
+
+TEST_F(BoardTest, testPlaneTilesAreInvalidatedOnlyWhereFragmentsChanged)
+{
+    Circuit& circuit = mProject->getCircuit();
+    NetClass* netclass = new NetClass(circuit, "plane");
+    circuit.addNetClass(*netclass);
+    NetSignal* gnd = new NetSignal(circuit, *netclass, "gnd", false);
+    circuit.addNetSignal(*gnd);
+    NetSignal* signal = new NetSignal(circuit, *netclass, "signal", false);
+    circuit.addNetSignal(*signal);
+
+    // a plane which is split into two fragments by a trace of another net
+    BI_Plane* plane = new BI_Plane(*mBoard, Uuid::createRandom(),
+        GraphicsLayer::sTopCopper, *gnd,
+        Path::rect(Point::fromMm(0, 0), Point::fromMm(40, 10)));
+    plane->setKeepOrphans(true); // the fragments are not connected to anything
+    mBoard->addPlane(*plane);
+    BI_NetSegment* netsegment = new BI_NetSegment(*mBoard, *signal);
+    mBoard->addNetSegment(*netsegment);
+    GraphicsLayer* layer = mBoard->getLayerStack().getLayer(GraphicsLayer::sTopCopper);
+    BI_NetPoint* p1 = new BI_NetPoint(*netsegment, *layer, Point::fromMm(20, -5));
+    BI_NetPoint* p2 = new BI_NetPoint(*netsegment, *layer, Point::fromMm(20, 15));
+    BI_NetLine* netline = new BI_NetLine(*p1, *p2, Length::fromMm(1));
+    netsegment->addElements({}, {p1, p2}, {netline});
+    mBoard->rebuildAllPlanes();
+    ASSERT_EQ(2, plane->getFragments().count());
+
+    // render the plane to fill the tile cache (with tiles of about 2.5mm)
+    GraphicsScene& scene = mBoard->getGraphicsScene();
+    BGI_Plane* item = nullptr;
+    foreach (QGraphicsItem* graphicsItem, scene.items()) {
+        item = dynamic_cast<BGI_Plane*>(graphicsItem);
+        if (item) break;
+    }
+    ASSERT_TRUE(item != nullptr);
+    QImage image(4000, 1000, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    scene.render(&painter, QRectF(image.rect()), item->boundingRect());
+    painter.end();
+    QRectF leftRect = QRectF(Point::fromMm(2, 2).toPxQPointF(),
+                             Point::fromMm(15, 8).toPxQPointF()).normalized();
+    QRectF rightRect = QRectF(Point::fromMm(25, 2).toPxQPointF(),
+                              Point::fromMm(38, 8).toPxQPointF()).normalized();
+    int leftTiles = item->getCachedTilesCount(leftRect);
+    ASSERT_GT(leftTiles, 0);
+    ASSERT_GT(item->getCachedTilesCount(rightRect), 0);
+
+    // a via in the right fragment must not invalidate the tiles of the left fragment
+    BI_Via* via = new BI_Via(*netsegment, Point::fromMm(30, 5), BI_Via::Shape::Round,
+                             Length::fromMm(1), Length::fromMm(0.5));
+    netsegment->addElements({via}, {}, {});
+    mBoard->rebuildAllPlanes();
+    EXPECT_EQ(2, plane->getFragments().count());
+    EXPECT_EQ(leftTiles, item->getCachedTilesCount(leftRect));
+    EXPECT_EQ(0, item->getCachedTilesCount(rightRect));
+}
+
+TEST_F(BoardTest, DISABLED_benchmarkSelectionRect)
+{
+    addPolygons(200, 100); // 20k selectable items
+
+    // drag a selection rect diagonally over the board like with the mouse
+    QElapsedTimer timer;
+    timer.start();
+    int steps = 200;
+    for (int i = 1; i <= steps; ++i) {
+        Point p2 = Point::fromMm(i * 2, i);
+        mBoard->setSelectionRect(Point(), p2, true);
+    }
+    mBoard->setSelectionRect(Point(), Point(), false);
+    qreal msPerUpdate = timer.elapsed() / qreal(steps);
+    std::cout << "selection rect update: " << msPerUpdate << " ms" << std::endl;
+    RecordProperty("ms_per_update", QString::number(msPerUpdate).toStdString());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
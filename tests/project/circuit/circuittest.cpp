@@ -0,0 +1,97 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include "../temporaryprojecttest.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class CircuitTest : public TemporaryProjectTest
+{
+    protected:
+        NetSignal* addAutoNamedNetSignal(NetClass& netclass) {
+            Circuit& circuit = mProject->getCircuit();
+            NetSignal* netsignal = new NetSignal(circuit, netclass,
+                                                 circuit.generateAutoNetSignalName(), true);
+            circuit.addNetSignal(*netsignal);
+            return netsignal;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(CircuitTest, testAutoNetSignalNames)
+{
+    Circuit& circuit = mProject->getCircuit();
+    NetClass* netclass = new NetClass(circuit, "test");
+    circuit.addNetClass(*netclass);
+
+    QList<NetSignal*> nets;
+    for (int i = 0; i < 3; ++i) {
+        nets.append(addAutoNamedNetSignal(*netclass));
+    }
+    EXPECT_EQ(QString("N1"), nets[0]->getName());
+    EXPECT_EQ(QString("N2"), nets[1]->getName());
+    EXPECT_EQ(QString("N3"), nets[2]->getName());
+    EXPECT_EQ(nets[1], circuit.getNetSignalByName("N2"));
+
+    // the numbers of removed net signals are reused
+    circuit.removeNetSignal(*nets[1]);
+    delete nets.takeAt(1);
+    EXPECT_EQ(nullptr, circuit.getNetSignalByName("N2"));
+    EXPECT_EQ(QString("N2"), circuit.generateAutoNetSignalName());
+
+    // renamed net signals are found by their new name only
+    circuit.setNetSignalName(*nets[0], "GND", false);
+    EXPECT_EQ(nets[0], circuit.getNetSignalByName("GND"));
+    EXPECT_EQ(nullptr, circuit.getNetSignalByName("N1"));
+    EXPECT_EQ(QString("N1"), circuit.generateAutoNetSignalName());
+
+    // names which are already in use are skipped
+    circuit.setNetSignalName(*nets[0], "N1", false);
+    nets.append(addAutoNamedNetSignal(*netclass));
+    EXPECT_EQ(QString("N2"), nets.last()->getName());
+    EXPECT_EQ(QString("N4"), circuit.generateAutoNetSignalName());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
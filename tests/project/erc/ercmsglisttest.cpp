@@ -0,0 +1,160 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <iostream>
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/project/erc/ercmsg.h>
+#include <librepcb/project/erc/ercmsglist.h>
+#include <librepcb/project/erc/if_ercmsgprovider.h>
+#include "../temporaryprojecttest.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class DummyErcMsgProvider final : public IF_ErcMsgProvider
+{
+        DECLARE_ERC_MSG_CLASS_NAME(DummyErcMsgProvider)
+
+    public:
+        DummyErcMsgProvider() noexcept : mUpdateCount(0) {}
+        void updateErcMessages() noexcept override {++mUpdateCount;}
+
+        int mUpdateCount;
+};
+
+class ErcMsgListTest : public TemporaryProjectTest
+{
+    protected:
+        DummyErcMsgProvider mOwner;
+
+        /**
+         * @brief Create visible messages with two messages per owner key
+         *
+         * @return All created messages (owned by the caller)
+         */
+        QList<ErcMsg*> createMessages(Project& project, int count) {
+            QList<ErcMsg*> msgs;
+            for (int i = 0; i < count; ++i) {
+                ErcMsg* msg = new ErcMsg(project, mOwner, QString("owner %1").arg(i / 2),
+                    QString("msg %1").arg(i % 2), ErcMsg::ErcMsgType_t::CircuitWarning);
+                msg->setVisible(true);
+                msgs.append(msg);
+            }
+            return msgs;
+        }
+
+        static QList<bool> getIgnoreStates(const QList<ErcMsg*>& msgs) {
+            QList<bool> states;
+            foreach (const ErcMsg* msg, msgs) {
+                states.append(msg->isIgnored());
+            }
+            return states;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(ErcMsgListTest, testRestoreIgnoreState)
+{
+    // save the project with some ignored messages
+    QList<ErcMsg*> msgs = createMessages(*mProject, 4);
+    msgs[1]->setIgnored(true);
+    msgs[2]->setIgnored(true);
+    mProject->save(true);
+    qDeleteAll(msgs);
+
+    // re-open the project, create the same messages and restore their ignore state
+    mProject.reset();
+    mProject.reset(new Project(mProjectFile, false));
+    msgs = createMessages(*mProject, 4);
+    EXPECT_EQ((QList<bool>{false, false, false, false}), getIgnoreStates(msgs));
+    mProject->getErcMsgList().restoreIgnoreState();
+    EXPECT_EQ((QList<bool>{false, true, true, false}), getIgnoreStates(msgs));
+    qDeleteAll(msgs);
+}
+
+/**
+ * @brief Restore ignore state benchmark (disabled by default since it takes some time)
+ *
+ * Run it with "--gtest_also_run_disabled_tests --gtest_filter=*benchmark*".
+ */
+TEST_F(ErcMsgListTest, DISABLED_benchmarkRestoreIgnoreState)
+{
+    // save the project with 10k messages and 5k approvals
+    QList<ErcMsg*> msgs = createMessages(*mProject, 10000);
+    for (int i = 0; i < msgs.count(); i += 2) {
+        msgs[i]->setIgnored(true);
+    }
+    mProject->save(true);
+    qDeleteAll(msgs);
+
+    // re-open the project and measure restoring the ignore state
+    mProject.reset();
+    mProject.reset(new Project(mProjectFile, false));
+    msgs = createMessages(*mProject, 10000);
+    QElapsedTimer timer;
+    timer.start();
+    mProject->getErcMsgList().restoreIgnoreState();
+    qint64 ms = timer.elapsed();
+    std::cout << "restore ignore state: " << ms << " ms" << std::endl;
+    RecordProperty("ms", QString::number(ms).toStdString());
+    EXPECT_EQ(5000, getIgnoreStates(msgs).count(true));
+    qDeleteAll(msgs);
+}
+
+TEST_F(ErcMsgListTest, testScheduledUpdatesAreCoalesced)
+{
+    ErcMsgList& list = mProject->getErcMsgList();
+    list.updateScheduledProviders(); // evaluate objects scheduled by creating the project
+    quint64 evaluationCount = list.getEvaluationCount();
+
+    // several invalidations within the same event loop pass must not evaluate immediately
+    for (int i = 0; i < 5; ++i) {
+        list.scheduleUpdate(mOwner);
+    }
+    EXPECT_EQ(0, mOwner.mUpdateCount);
+    EXPECT_EQ(evaluationCount, list.getEvaluationCount());
+
+    // but only once when the event loop runs
+    processEventsFor(100);
+    EXPECT_EQ(1, mOwner.mUpdateCount);
+    EXPECT_EQ(evaluationCount + 1, list.getEvaluationCount());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
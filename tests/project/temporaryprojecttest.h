@@ -0,0 +1,86 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEMPORARYPROJECTTEST_H
+#define TEMPORARYPROJECTTEST_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/project/project.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Class TemporaryProjectTest
+ ****************************************************************************************/
+
+/**
+ * @brief Test fixture which creates a new project in a random temporary directory
+ *
+ * The directory is removed again after the test.
+ */
+class TemporaryProjectTest : public ::testing::Test
+{
+    protected:
+        FilePath mProjectDir;
+        FilePath mProjectFile;
+        QScopedPointer<Project> mProject;
+
+        TemporaryProjectTest() {
+            mProjectDir = FilePath::getRandomTempPath();
+            mProjectFile = mProjectDir.getPathTo("project.lpp");
+            mProject.reset(Project::create(mProjectFile));
+        }
+
+        virtual ~TemporaryProjectTest() {
+            mProject.reset();
+            QDir(mProjectDir.toStr()).removeRecursively();
+        }
+
+        /**
+         * @brief Run the event loop for some time (e.g. to trigger zero-timeout timers)
+         */
+        static void processEventsFor(int ms) noexcept {
+            QElapsedTimer timer;
+            timer.start();
+            do {
+                QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+            } while (timer.elapsed() < ms);
+        }
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
+
+#endif // TEMPORARYPROJECTTEST_H
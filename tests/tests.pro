@@ -39,6 +39,7 @@ INCLUDEPATH += \
     ../libs/parseagle \
     ../libs/quazip \
     ../libs \
+    ../apps \
 
 DEPENDPATH += \
     ../libs/librepcb/eagleimport \
@@ -64,11 +65,19 @@ PRE_TARGETDEPS += \
 
 SOURCES += \
     common/applicationtest.cpp \
+    common/attributes/attributeprovidertest.cpp \
     common/attributes/attributesubstitutortest.cpp \
     common/directorylocktest.cpp \
     common/filedownloadtest.cpp \
+    common/fileio/backgroundfilewritertest.cpp \
     common/fileio/serializableobjectlisttest.cpp \
+    common/fileio/sexprfilecachetest.cpp \
+    common/fileio/sexprfilepreloadertest.cpp \
+    common/fileio/smartsexprfiletest.cpp \
     common/filepathtest.cpp \
+    common/font/strokefonttest.cpp \
+    common/graphics/graphicslayeridtest.cpp \
+    common/graphics/graphicsviewtest.cpp \
     common/networkrequesttest.cpp \
     common/pointtest.cpp \
     common/ratiotest.cpp \
@@ -76,20 +85,31 @@ SOURCES += \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
     common/toolboxtest.cpp \
+    common/undostacktest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
+    eagleimport/batchconvertertest.cpp \
+    eagleimport/converterdbtest.cpp \
     eagleimport/deviceconvertertest.cpp \
     eagleimport/devicesetconvertertest.cpp \
     eagleimport/packageconvertertest.cpp \
     eagleimport/symbolconvertertest.cpp \
     main.cpp \
+    project/boards/boardtest.cpp \
+    project/circuit/circuittest.cpp \
+    project/erc/ercmsglisttest.cpp \
     project/projecttest.cpp \
+    workspace/library/libraryelementlistmodeltest.cpp \
+    workspace/library/workspacelibrarydbtest.cpp \
     workspace/workspacetest.cpp \
+    ../apps/EagleImport/batchconverter.cpp \
+    ../apps/EagleImport/polygonsimplifier.cpp \
 
 HEADERS += \
     common/attributes/attributeproviderdummy.h \
     common/fileio/serializableobjectmock.h \
     common/networkrequestbasesignalreceiver.h \
+    project/temporaryprojecttest.h \
 
 FORMS += \
 
@@ -0,0 +1,146 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/workspace/library/libraryelementlistmodel.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class LibraryElementListModelTest : public ::testing::Test
+{
+    protected:
+        LibraryElementListModel mModel;
+        int mInserted;
+        int mRemoved;
+        int mMoved;
+        int mChanged;
+        int mResets;
+
+        LibraryElementListModelTest() :
+            mModel(QIcon()), mInserted(0), mRemoved(0), mMoved(0), mChanged(0), mResets(0)
+        {
+            QObject::connect(&mModel, &QAbstractItemModel::rowsInserted,
+                             [this](const QModelIndex&, int first, int last)
+                             {mInserted += last - first + 1;});
+            QObject::connect(&mModel, &QAbstractItemModel::rowsRemoved,
+                             [this](const QModelIndex&, int first, int last)
+                             {mRemoved += last - first + 1;});
+            QObject::connect(&mModel, &QAbstractItemModel::rowsMoved,
+                             [this](){++mMoved;});
+            QObject::connect(&mModel, &QAbstractItemModel::dataChanged,
+                             [this](){++mChanged;});
+            QObject::connect(&mModel, &QAbstractItemModel::modelReset,
+                             [this](){++mResets;});
+        }
+
+        static WorkspaceLibraryDb::ElementMetadata_t element(const QString& file,
+                                                             const QString& name)
+        {
+            WorkspaceLibraryDb::ElementMetadata_t element;
+            element.filepath = FilePath("/lib").getPathTo(file);
+            element.uuid = Uuid::createRandom();
+            element.name = name;
+            return element;
+        }
+
+        QStringList getNames() const
+        {
+            QStringList names;
+            for (int i = 0; i < mModel.rowCount(); ++i) {
+                names.append(mModel.data(mModel.index(i)).toString());
+            }
+            return names;
+        }
+
+        void resetCounters()
+        {
+            mInserted = mRemoved = mMoved = mChanged = mResets = 0;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(LibraryElementListModelTest, testInitialElementsAreSorted)
+{
+    mModel.setElements({element("c", "C"), element("a", "A"), element("b", "B")});
+    EXPECT_EQ(QStringList({"A", "B", "C"}), getNames());
+    EXPECT_EQ(FilePath("/lib/b"), mModel.getFilePath(mModel.index(1)));
+}
+
+TEST_F(LibraryElementListModelTest, testUnchangedElementsEmitNoSignals)
+{
+    QList<WorkspaceLibraryDb::ElementMetadata_t> elements = {element("a", "A"),
+                                                             element("b", "B")};
+    mModel.setElements(elements);
+    resetCounters();
+    mModel.setElements(elements);
+    EXPECT_EQ(0, mInserted + mRemoved + mMoved + mChanged + mResets);
+}
+
+TEST_F(LibraryElementListModelTest, testIncrementalUpdate)
+{
+    WorkspaceLibraryDb::ElementMetadata_t a = element("a", "A");
+    WorkspaceLibraryDb::ElementMetadata_t b = element("b", "B");
+    WorkspaceLibraryDb::ElementMetadata_t c = element("c", "C");
+    WorkspaceLibraryDb::ElementMetadata_t d = element("d", "D");
+    mModel.setElements({a, b, c});
+    resetCounters();
+
+    // remove "b", add "d" and rename "a" to "E"
+    a.name = "E";
+    mModel.setElements({a, c, d});
+    EXPECT_EQ(QStringList({"C", "D", "E"}), getNames());
+    EXPECT_EQ(1, mRemoved);
+    EXPECT_EQ(1, mInserted);
+    EXPECT_EQ(0, mResets);
+    EXPECT_EQ(FilePath("/lib/a"), mModel.getFilePath(mModel.index(2)));
+}
+
+TEST_F(LibraryElementListModelTest, testErrorMessage)
+{
+    mModel.setElements({element("a", "A"), element("b", "B")});
+    mModel.setErrorMessage("error");
+    EXPECT_EQ(QStringList({"error"}), getNames());
+    EXPECT_FALSE(mModel.getFilePath(mModel.index(0)).isValid());
+    mModel.setElements({element("a", "A")});
+    EXPECT_EQ(QStringList({"A"}), getNames());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace workspace
+} // namespace librepcb
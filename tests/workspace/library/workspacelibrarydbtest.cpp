@@ -0,0 +1,173 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/application.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/workspace.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class WorkspaceLibraryDbTest : public ::testing::Test
+{
+    protected:
+        FilePath mWsDir;
+        FilePath mLocalLibsDir;
+        QScopedPointer<Workspace> mWorkspace;
+
+        WorkspaceLibraryDbTest() {
+            mWsDir = FilePath::getRandomTempPath().getPathTo("workspace");
+            mLocalLibsDir = mWsDir.getPathTo("v" % qApp->getFileFormatVersion().toStr())
+                            .getPathTo("libraries/local");
+            Workspace::createNewWorkspace(mWsDir);
+        }
+
+        virtual ~WorkspaceLibraryDbTest() {
+            mWorkspace.reset();
+            QDir(mWsDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        /**
+         * @brief Create a local library (must be called before #openWorkspace())
+         */
+        FilePath createLibrary(const QString& dirname) {
+            library::Library lib(Uuid::createRandom(), Version("0.1"), "test", dirname,
+                                 "", "");
+            FilePath libDir = mLocalLibsDir.getPathTo(dirname);
+            lib.saveTo(libDir); // can throw
+            return libDir;
+        }
+
+        static void createSymbol(const FilePath& libDir, const Uuid& uuid,
+                                 const QString& version,
+                                 const QHash<QString, QString>& names,
+                                 const QString& description_en_US) {
+            library::Symbol symbol(uuid, Version(version), "test",
+                                   names.value("en_US"), description_en_US, "");
+            foreach (const QString& locale, names.keys()) {
+                symbol.setName(locale, names.value(locale));
+            }
+            symbol.saveIntoParentDirectory(libDir.getPathTo("sym")); // can throw
+        }
+
+        /**
+         * @brief Open the workspace and fill its library database
+         */
+        void openWorkspace() {
+            mWorkspace.reset(new Workspace(mWsDir)); // can throw
+            WorkspaceLibraryDb& db = mWorkspace->getLibraryDb();
+            bool finished = false;
+            QObject context; // disconnects the lambdas when leaving this scope
+            QObject::connect(&db, &WorkspaceLibraryDb::scanSucceeded, &context,
+                             [&finished](){finished = true;});
+            QObject::connect(&db, &WorkspaceLibraryDb::scanFailed, &context,
+                             [&finished](){finished = true;});
+            db.startLibraryRescan();
+            QElapsedTimer timer;
+            timer.start();
+            while ((!finished) && (timer.elapsed() < 10000)) {
+                QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+            }
+            ASSERT_TRUE(finished);
+        }
+
+        static QHash<Uuid, WorkspaceLibraryDb::ElementMetadata_t> byUuid(
+            const QList<WorkspaceLibraryDb::ElementMetadata_t>& elements) {
+            QHash<Uuid, WorkspaceLibraryDb::ElementMetadata_t> hash;
+            foreach (const WorkspaceLibraryDb::ElementMetadata_t& element, elements) {
+                hash.insert(element.uuid, element);
+            }
+            return hash;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testMetadataLocaleFallback)
+{
+    FilePath libDir = createLibrary("Test.lplib");
+    Uuid translated = Uuid::createRandom();
+    Uuid untranslated = Uuid::createRandom();
+    createSymbol(libDir, translated, "0.1", {{"en_US", "R"}, {"de_DE", "Widerstand"}},
+                 "resistor");
+    createSymbol(libDir, untranslated, "0.1", {{"en_US", "C"}}, "capacitor");
+    openWorkspace();
+
+    QList<WorkspaceLibraryDb::ElementMetadata_t> elements =
+        mWorkspace->getLibraryDb().getLibraryElementsMetadata<library::Symbol>(
+            libDir, {"de_DE", "en_US"});
+    ASSERT_EQ(2, elements.count());
+    QHash<Uuid, WorkspaceLibraryDb::ElementMetadata_t> metadata = byUuid(elements);
+
+    // the best matching locale is chosen for each column separately
+    EXPECT_EQ(QString("Widerstand"), metadata.value(translated).name);
+    EXPECT_EQ(QString("resistor"), metadata.value(translated).description);
+    EXPECT_EQ(QString("C"), metadata.value(untranslated).name);
+    EXPECT_EQ(libDir.getPathTo("sym").getPathTo(untranslated.toStr()),
+              metadata.value(untranslated).filepath);
+
+    // the same as LocalizedNameMap::value() returns
+    elements = mWorkspace->getLibraryDb().getLibraryElementsMetadata<library::Symbol>(
+        libDir, {"fr_FR"});
+    EXPECT_EQ(QString("R"), byUuid(elements).value(translated).name);
+}
+
+TEST_F(WorkspaceLibraryDbTest, testMetadataOfLatestVersion)
+{
+    FilePath oldLibDir = createLibrary("Old.lplib");
+    FilePath newLibDir = createLibrary("New.lplib");
+    Uuid uuid = Uuid::createRandom();
+    createSymbol(newLibDir, uuid, "0.10", {{"en_US", "new"}}, "");
+    createSymbol(oldLibDir, uuid, "0.9", {{"en_US", "old"}}, "");
+    openWorkspace();
+
+    QList<WorkspaceLibraryDb::ElementMetadata_t> elements =
+        mWorkspace->getLibraryDb().getElementsMetadataByCategory<library::Symbol>(
+            Uuid(), {"en_US"});
+    ASSERT_EQ(1, elements.count());
+    EXPECT_EQ(uuid, elements.first().uuid);
+    EXPECT_EQ(QString("new"), elements.first().name);
+    EXPECT_EQ(newLibDir.getPathTo("sym").getPathTo(uuid.toStr()),
+              elements.first().filepath);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace workspace
+} // namespace librepcb